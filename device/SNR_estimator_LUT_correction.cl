@@ -1,12 +1,36 @@
 
 #include "cordic.h"
 #include "SNR_estimator_LUT_coefficients_AGC_at_21.h"
+// Build with -DSNR_FLOAT_INDEX for the original float log10 lookup_index
+#ifndef SNR_FLOAT_INDEX
+#include "snr_index.h"
+#endif
+// Build with -DSNR_SEQ_PRECISION=P to write each dwell's estimate as soon as
+// it is within P tenths of a dB (see snr_sequential.h), at the latest at the
+// end of the dwell.  There is still one estimate per dwell.
+#ifdef SNR_SEQ_PRECISION
+#if defined(SNR_HOP_LENGTH) || defined(SNR_FLOAT_INDEX)
+#error "SNR_SEQ_PRECISION needs the integer lookup_index and one estimate per dwell"
+#endif
+#include "snr_sequential.h"
+#endif
+// Build with -DSNR_POLAR_LUT to replace the magnitude CORDIC with a table lookup
+#ifdef SNR_POLAR_LUT
+#include "polar_lut.h"
+#endif
 
 //#define SNR_SYMBOL_LENGTH  1040  //Use more samples than num_samp_to_average
 #define SNR_SYMBOL_LENGTH  512  //Use more samples than num_samp_to_average
 //#define SNR_SYMBOL_LENGTH  1024  //Use more samples than num_samp_to_average
 //#define SNR_SYMBOL_LENGTH  90  //Use QPSK frame preamble to estimate SNR
 
+// Build with -DSNR_HOP_LENGTH=H (64, 128, ...) for an estimate every H samples
+// instead of one per dwell.  data_in then only raises sof on the first sample,
+// the accumulators run on, and noiseVarSum slides like abs_energy_sum: each
+// sample adds its noise term and retires the one from num_samp_to_average
+// samples ago.  Every estimate covers the last 2*num_samp_to_average samples
+// and equals the estimate of a dwell ending on the same sample.
+
 
 __kernel 
 //__attribute__((task))
@@ -14,17 +38,16 @@ void snr_est_LUT_correction(	unsigned int slotLen  // do I need SOF indicator he
 			) 
 {
 	
-	char2 shift_reg[SNR_SYMBOL_LENGTH+1];
-	#pragma unroll
-	for(uint i=0; i<=SNR_SYMBOL_LENGTH; i++){
-		shift_reg[i].x = 0;
-		shift_reg[i].y = 0;
-	}
+	// Circular delay line of sample magnitudes.  delay_line[head] holds the magnitude of the
+	// sample written SNR_SYMBOL_LENGTH+1 samples ago, so each sample reads the oldest entry
+	// and overwrites it in place instead of shifting the whole window.  Keeping the magnitude
+	// rather than the I/Q sample means it never has to be run through the CORDIC a second time.
+	// Magnitudes of char inputs scaled by 2^8 are at most 46341, so they fit in a ushort.
+	ushort delay_line[SNR_SYMBOL_LENGTH+1];
+	uint head = 0;
 	unsigned long numerator=0;
 	unsigned long noiseVarSum=0;
 	unsigned long noiseVarSum_final=0;
-	int tmpI_last = 0;
-	int tmpQ_last = 0;
 	int tmpI_first = 0;
 	int tmpQ_first = 0;
 	int cordic_abs = 0;
@@ -38,6 +61,19 @@ void snr_est_LUT_correction(	unsigned int slotLen  // do I need SOF indicator he
 	int bits_to_shift = 9;
 	int while_loop_cntr = 0;	
 	int carry = 0;
+#ifdef SNR_HOP_LENGTH
+	unsigned long noise_line[512];  // noise terms of the last num_samp_to_average samples
+	uint noise_head = 0;
+	uint hop_cntr = 0;
+	unsigned long noise_term = 0;
+#endif
+#ifdef SNR_SEQ_PRECISION
+	unsigned long noise_term = 0;
+	unsigned long noise_shifted_sum = 0;     // sum of the noise terms >> SNR_SEQ_TERM_SHIFT
+	unsigned long noise_shifted_sq_sum = 0;  // and of their squares
+	int seq_terms = 0;
+	bool seq_done = 0;                       // this dwell's estimate has been written
+#endif
 	
 	while(1){
 		__freqDetIn freqDetIn;
@@ -51,13 +87,22 @@ void snr_est_LUT_correction(	unsigned int slotLen  // do I need SOF indicator he
 			while_loop_cntr = 0;		
 			noiseVarSum = 0;
 			abs_energy_sum = 0;
-			#pragma unroll
-			for(uint i=0; i<=SNR_SYMBOL_LENGTH; i++){
-				shift_reg[i].x = 0;
-				shift_reg[i].y = 0;
-			}
+#ifdef SNR_HOP_LENGTH
+			hop_cntr = 0;
+#endif
+#ifdef SNR_SEQ_PRECISION
+			noise_shifted_sum = 0;
+			noise_shifted_sq_sum = 0;
+			seq_done = 0;
+#endif
 		}
+#ifdef SNR_HOP_LENGTH
+		// stops once the window is full, so it never wraps on a continuous stream
+		if (while_loop_cntr <= 2*num_samp_to_average)
+			while_loop_cntr += 1;
+#else
 		while_loop_cntr += 1;
+#endif
 
 // Remove last sample and add newest
 				// ********************************
@@ -66,29 +111,44 @@ void snr_est_LUT_correction(	unsigned int slotLen  // do I need SOF indicator he
 				//  We also don't normalize average, but keep the sum to avoid the loss of precision due to division.  This also must be accounted
 				//    for in final SNR calculation
 				// ********************************	
-		tmpI_last = (int)(shift_reg[SNR_SYMBOL_LENGTH].x)<<8;
-		tmpQ_last = (int)(shift_reg[SNR_SYMBOL_LENGTH].y)<<8;
-		cordic_abs = mag_cordic(tmpI_last, tmpQ_last);
-		abs_energy_sum -= cordic_abs;
-		
-		#pragma unroll
-		for(uint j=SNR_SYMBOL_LENGTH; j>0; j--){
-			shift_reg[j].x = shift_reg[j-1].x;
-			shift_reg[j].y = shift_reg[j-1].y;
-			/* if it's more efficient, you can add newest data point and subtract oldest one
-			   instead of doing the sum each loop iteration  */
-		}
-		shift_reg[0].x = freqDetIn.data.x;
-		shift_reg[0].y = freqDetIn.data.y;
 		tmpI_first = (int)(freqDetIn.data.x)<<8;
 		tmpQ_first = (int)(freqDetIn.data.y)<<8;
+#ifdef SNR_POLAR_LUT
+		cordic_abs = mag_lut_int8(freqDetIn.data.x, freqDetIn.data.y);
+#else
 		cordic_abs = mag_cordic(tmpI_first, tmpQ_first);
+#endif
 //		printf("In SNR kernel, cordic_abs first= %d \n", cordic_abs);
+
+		// Until the delay line has been refilled since sof its oldest entry is a zero
+		// sample, whose magnitude is zero, so there is nothing to remove.  This is what
+		// lets sof skip clearing the delay line.
+		if (while_loop_cntr > SNR_SYMBOL_LENGTH+1) {
+			abs_energy_sum -= delay_line[head];
+		}
 		abs_energy_sum += cordic_abs;
+		
+		delay_line[head] = cordic_abs;
+		head = (head == SNR_SYMBOL_LENGTH) ? 0 : head+1;
 
 		if(while_loop_cntr > num_samp_to_average)
 		{
+#ifdef SNR_HOP_LENGTH
+			noise_term = ((cordic_abs<<bits_to_shift) - abs_energy_sum)*((cordic_abs<<bits_to_shift) - abs_energy_sum);
+			if (while_loop_cntr > 2*num_samp_to_average) {
+				noiseVarSum -= noise_line[noise_head];
+			}
+			noiseVarSum += noise_term;
+			noise_line[noise_head] = noise_term;
+			noise_head = (noise_head == num_samp_to_average-1) ? 0 : noise_head+1;
+#elif defined(SNR_SEQ_PRECISION)
+			noise_term = ((cordic_abs<<bits_to_shift) - abs_energy_sum)*((cordic_abs<<bits_to_shift) - abs_energy_sum);
+			noiseVarSum += noise_term;
+			noise_shifted_sum += noise_term>>SNR_SEQ_TERM_SHIFT;
+			noise_shifted_sq_sum += (noise_term>>SNR_SEQ_TERM_SHIFT)*(noise_term>>SNR_SEQ_TERM_SHIFT);
+#else
 			noiseVarSum += ((cordic_abs<<bits_to_shift) - abs_energy_sum)*((cordic_abs<<bits_to_shift) - abs_energy_sum); //at this point we are 8 + bits_to_shift bits total shifted
+#endif
 		}
 		
 
@@ -116,12 +176,40 @@ void snr_est_LUT_correction(	unsigned int slotLen  // do I need SOF indicator he
 		printf(" dout_estimate =  %f \n", dout_estimate);
 */
 
+#ifdef SNR_HOP_LENGTH
+		bool estimate_ready = (while_loop_cntr==(2*num_samp_to_average));
+		if (while_loop_cntr > (2*num_samp_to_average)) {
+			hop_cntr += 1;
+			estimate_ready = (hop_cntr == SNR_HOP_LENGTH);
+		}
+		if (estimate_ready) {
+			hop_cntr = 0;
+#elif defined(SNR_SEQ_PRECISION)
+		// Before the end of the dwell, test every SNR_SEQ_CHECK noise terms with
+		// noiseVarSum_final scaled up to num_samp_to_average terms
+		seq_terms = while_loop_cntr - num_samp_to_average;
+		bool estimate_ready = !seq_done && (seq_terms == num_samp_to_average);
+		if (!seq_done && seq_terms >= SNR_SEQ_MIN_TERMS && seq_terms < num_samp_to_average &&
+			(seq_terms & (SNR_SEQ_CHECK-1)) == 0) {
+			noiseVarSum_final = snr_seq_scale_noise(noiseVarSum_final, seq_terms);
+			estimate_ready = snr_seq_converged(noise_shifted_sum, noise_shifted_sq_sum, seq_terms,
+				snr_lut_index(numerator, noiseVarSum_final), SNR_estimator_LUT_coefficients, SNR_SEQ_PRECISION);
+		}
+		if (estimate_ready) {
+			seq_done = 1;
+#else
 		if (while_loop_cntr==(2*num_samp_to_average)) { // return SNR estimate after num_samp_to_average samples
+#endif
 	        printf("In SNR kernel SOF_detect==True, numerator= %lu \n", numerator);
 	        printf("In SNR kernel SOF_detect==True, denominator=%lu \n", noiseVarSum_final);
+#ifdef SNR_FLOAT_INDEX
 			temp_snr_est = (10*log10((float)(numerator)/((float)(noiseVarSum_final))));
 			printf("In SNR kernel SOF_detect==True, temp_snr_est before LUT=%f \n", temp_snr_est);
 			int lookup_index = max(min((int)(round((float)temp_snr_est*100) + 1388), 4095), 0); // remember zero array indexing in C compared to 1 in Matlab
+#else
+			int lookup_index = snr_lut_index(numerator, noiseVarSum_final);  // same index, no divide or log10
+			printf("In SNR kernel SOF_detect==True, lookup_index=%d \n", lookup_index);
+#endif
 			snr_est = SNR_estimator_LUT_coefficients[lookup_index];
 			printf("In SNR kernel SOF_detect==True, snr_est after LUT=%d \n", snr_est);
 			write_channel_intel(SNR_DOUT, snr_est);
@@ -28,6 +28,23 @@
 
 #define SNR_DWELL_LENGTH  1024
 
+// Build with -DSNR_MULTI_WINDOW to estimate several dwell lengths in one pass:
+// snr_est_multi_window replaces snr_est_LUT_correction, data_in only raises
+// sof on the first sample and each window restarts its own dwells.  The
+// windows are given by num_samp_to_average, half the dwell, and each has its
+// own LUT.  Every estimate carries its window to data_out_multi.  No host
+// path launches this build yet: OpenClSession sizes data_out for one window
+// and relaunches data_in (raising sof) every transfer chunk, which would
+// break the 90 sample window's phase.  It is exercised through
+// SnrWindowEngine, its native model.
+#ifdef SNR_MULTI_WINDOW
+#define SNR_NUM_WINDOWS   4
+#define SNR_WINDOW_0_AVG  45    // 90 symbol PLHEADER
+#define SNR_WINDOW_1_AVG  256   // 512 sample dwell
+#define SNR_WINDOW_2_AVG  512   // 1024, same as snr_est_LUT_correction
+#define SNR_WINDOW_3_AVG  2048  // 4096
+#endif
+
 #pragma OPENCL EXTENSION cl_intel_channels : enable
 
 
@@ -63,7 +80,11 @@ void data_in(     __global char* dataIn_I,
 		// for testing...
 		//  <maybe_a_counter_for_this?>
 		// set SOF on last of 90 SOF/PLS header symbols
+#if defined(SNR_HOP_LENGTH) || defined(SNR_MULTI_WINDOW)
+		if (i == 0){  // the estimator slides over the whole input, or keeps its own dwells
+#else
 		if ((i%SNR_DWELL_LENGTH) == 0){
+#endif
 			printf("In read kernel, sof==True, input ind= %d \n", i);
 			din.sof = 1;
 		}else{
@@ -91,7 +112,85 @@ void data_out(	__global short* snr_est_out,
 		}
 }
 
+// Batched versions of data_in and data_out, so one launch of each processes
+// many short captures packed back to back.  Capture c is samples
+// capture_offsets[c] .. capture_offsets[c+1]-1 and its estimates go to
+// snr_est_out[est_offsets[c]] .. snr_est_out[est_offsets[c+1]-1], where the
+// host sets est_offsets[c+1]-est_offsets[c] to the capture length / SNR_DWELL_LENGTH
+// (with SNR_HOP_LENGTH, (length - SNR_DWELL_LENGTH) / SNR_HOP_LENGTH + 1).
+__kernel 
+void data_in_batch(	__global char* dataIn_I, 
+					__global char* dataIn_Q,
+					__global const uint* capture_offsets,
+					unsigned int num_captures) 
+{
+	for(uint c=0; c< num_captures; c++){
+		uint capture_start = capture_offsets[c];
+		uint capture_end = capture_offsets[c+1];
+		for(uint i=capture_start; i< capture_end; i++){ 
+			__freqDetIn din;
+			din.data.x = dataIn_I[i];
+			din.data.y = dataIn_Q[i];
+
+			// sof at the start of each capture, then every dwell within it,
+			// so a capture's estimates never mix in samples of the previous one
+#if defined(SNR_HOP_LENGTH) || defined(SNR_MULTI_WINDOW)
+			if (i == capture_start){
+#else
+			if (((i-capture_start)%SNR_DWELL_LENGTH) == 0){
+#endif
+				din.sof = 1;
+			}else{
+				din.sof = 0;
+			}
+
+			write_channel_intel(SNR_DET_DIN_LUT, din);
+		}
+	}
+}
+
+
+__kernel 
+void data_out_batch(__global short* snr_est_out,
+					__global const uint* est_offsets,
+					unsigned int num_captures) 
+{
+	for(uint c=0; c< num_captures; c++){
+		for(uint i=est_offsets[c]; i< est_offsets[c+1]; i++){ 
+			snr_est_out[i] = read_channel_intel(SNR_DOUT);
+		}
+	}
+}
+
+#ifdef SNR_MULTI_WINDOW
+// data_out for the multi window build.  Window k's estimates go to
+// snr_est_out[window_offsets[k]] onwards, where the host leaves room for the
+// input length / (2*SNR_WINDOW_k_AVG) of them; num_output_frames is the total.
+// SNR_DOUT carries the window in its upper 16 bits.  (Plain data_out also
+// works, and writes the estimates of all windows in the order they end.)
+__kernel 
+void data_out_multi(	__global short* snr_est_out,
+					__global const uint* window_offsets,
+					int num_output_frames) 
+{
+	uint window_cnt[SNR_NUM_WINDOWS];
+	for(uint k=0; k< SNR_NUM_WINDOWS; k++){ 
+		window_cnt[k] = 0;
+	}
+	for(uint i=0; i< num_output_frames; i++){ 
+		int dout = read_channel_intel(SNR_DOUT);
+		uint k = dout>>16;
+		snr_est_out[window_offsets[k] + window_cnt[k]] = (short)(dout & 0xffff);
+		window_cnt[k] += 1;
+	}
+}
+#endif
+
 // Include the datapath kernels
+#ifdef SNR_MULTI_WINDOW
+#include "SNR_estimator_multi_window.cl"
+#else
 #include "SNR_estimator_LUT_correction.cl"
+#endif
 
 //void data_out(	__global int* restrict snr_est_out,
@@ -0,0 +1,130 @@
+
+#include "cordic.h"
+#include "snr_index.h"
+#include "SNR_estimator_LUT_coefficients_90_AGC_at_21.h"
+#include "SNR_estimator_LUT_coefficients_512_AGC_at_21.h"
+#include "SNR_estimator_LUT_coefficients_AGC_at_21.h"
+#include "SNR_estimator_LUT_coefficients_4096_AGC_at_21.h"
+// Build with -DSNR_POLAR_LUT to replace the magnitude CORDIC with a table lookup
+#ifdef SNR_POLAR_LUT
+#include "polar_lut.h"
+#endif
+
+// Fused version of snr_est_LUT_correction for the -DSNR_MULTI_WINDOW build.
+// Each sample's magnitude is computed once and feeds one accumulator set per
+// window of SNR_estimator_LUT_correction_top.cl, so the CORDIC is paid once
+// however many dwell lengths are estimated.  Each window runs the same
+// update as snr_est_LUT_correction with its own num_samp_to_average w, delay
+// line of w+1 magnitudes and LUT, and restarts itself every 2*w samples
+// instead of waiting for sof.  The <<bits_to_shift scalings are multiplies
+// by w, which is the same thing for the powers of two and also covers the
+// 90 symbol PLHEADER.  The 1024 sample window gives exactly the estimates of
+// snr_est_LUT_correction.
+
+typedef struct {
+	uint head;
+	int while_loop_cntr;
+	unsigned long abs_energy_sum;
+	unsigned long noiseVarSum;
+}__snrWindow;
+
+
+void snr_window_reset(__snrWindow *win)
+{
+	win->while_loop_cntr = 0;
+	win->noiseVarSum = 0;
+	win->abs_energy_sum = 0;
+}
+
+// One sample of one window.  Returns the LUT index when the sample ends one of
+// the window's dwells, otherwise -1.
+int snr_window_step(__snrWindow *win, ushort *delay_line, int num_samp_to_average, int cordic_abs)
+{
+	if (win->while_loop_cntr == 2*num_samp_to_average) {
+		snr_window_reset(win);
+	}
+	win->while_loop_cntr += 1;
+
+	if (win->while_loop_cntr > num_samp_to_average+1) {
+		win->abs_energy_sum -= delay_line[win->head];
+	}
+	win->abs_energy_sum += cordic_abs;
+
+	delay_line[win->head] = cordic_abs;
+	win->head = (win->head == num_samp_to_average) ? 0 : win->head+1;
+
+	if (win->while_loop_cntr > num_samp_to_average) {
+		win->noiseVarSum += ((cordic_abs*num_samp_to_average) - win->abs_energy_sum)*((cordic_abs*num_samp_to_average) - win->abs_energy_sum);
+	}
+
+	if (win->while_loop_cntr != 2*num_samp_to_average) {
+		return -1;
+	}
+	int carry = (1&(win->noiseVarSum>>(15-1)));
+	unsigned long noiseVarSum_final = (win->noiseVarSum>>15) + carry;
+	unsigned long numerator = (win->abs_energy_sum*num_samp_to_average*num_samp_to_average)>>(8);
+	return snr_lut_index(numerator, noiseVarSum_final);
+}
+
+
+__kernel
+void snr_est_multi_window(	unsigned int slotLen
+			)
+{
+	// One delay line per window, so each is its own memory
+	ushort delay_line_0[SNR_WINDOW_0_AVG+1];
+	ushort delay_line_1[SNR_WINDOW_1_AVG+1];
+	ushort delay_line_2[SNR_WINDOW_2_AVG+1];
+	ushort delay_line_3[SNR_WINDOW_3_AVG+1];
+	__snrWindow win[SNR_NUM_WINDOWS];
+	int tmpI_first = 0;
+	int tmpQ_first = 0;
+	int cordic_abs = 0;
+	int lookup_index = 0;
+
+	for (int k = 0; k < SNR_NUM_WINDOWS; k++) {
+		win[k].head = 0;
+		snr_window_reset(&win[k]);
+	}
+
+	while(1){
+		__freqDetIn freqDetIn;
+
+		freqDetIn=read_channel_intel(SNR_DET_DIN_LUT);
+
+		if (freqDetIn.sof==1) {
+			// every window starts a dwell on this sample
+			for (int k = 0; k < SNR_NUM_WINDOWS; k++) {
+				snr_window_reset(&win[k]);
+			}
+		}
+
+		// The one magnitude of this sample, shared by all the windows
+		tmpI_first = (int)(freqDetIn.data.x)<<8;
+		tmpQ_first = (int)(freqDetIn.data.y)<<8;
+#ifdef SNR_POLAR_LUT
+		cordic_abs = mag_lut_int8(freqDetIn.data.x, freqDetIn.data.y);
+#else
+		cordic_abs = mag_cordic(tmpI_first, tmpQ_first);
+#endif
+
+		// Estimates that end on the same sample go out in window order,
+		// tagged with the window in the upper 16 bits (see data_out_multi)
+		lookup_index = snr_window_step(&win[0], delay_line_0, SNR_WINDOW_0_AVG, cordic_abs);
+		if (lookup_index >= 0) {
+			write_channel_intel(SNR_DOUT, (0<<16) | (ushort)SNR_estimator_LUT_coefficients_90[lookup_index]);
+		}
+		lookup_index = snr_window_step(&win[1], delay_line_1, SNR_WINDOW_1_AVG, cordic_abs);
+		if (lookup_index >= 0) {
+			write_channel_intel(SNR_DOUT, (1<<16) | (ushort)SNR_estimator_LUT_coefficients_512[lookup_index]);
+		}
+		lookup_index = snr_window_step(&win[2], delay_line_2, SNR_WINDOW_2_AVG, cordic_abs);
+		if (lookup_index >= 0) {
+			write_channel_intel(SNR_DOUT, (2<<16) | (ushort)SNR_estimator_LUT_coefficients[lookup_index]);
+		}
+		lookup_index = snr_window_step(&win[3], delay_line_3, SNR_WINDOW_3_AVG, cordic_abs);
+		if (lookup_index >= 0) {
+			write_channel_intel(SNR_DOUT, (3<<16) | (ushort)SNR_estimator_LUT_coefficients_4096[lookup_index]);
+		}
+	}  // end main while loop
+}
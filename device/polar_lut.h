@@ -0,0 +1,75 @@
+/******************************************************************************
+*  @file    polar_lut.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Table lookup replacements for the CORDIC on char I/Q inputs.
+*
+*  @section DESCRIPTION
+*
+*  A char I/Q sample can only take 65536 values, so the CORDIC results are
+*  precomputed for the first quadrant in polar_tables_int8.h (generated by
+*  tools/gen_polar_tables.cpp) and the other quadrants are folded onto it.
+*  The lookups return exactly what the 24 iteration CORDIC returns:
+*
+*         unsigned int mag_lut_int8(char x, char y)
+*               == mag_cordic((int)x<<8, (int)y<<8)
+*         unsigned short arctan_lut_int8(char x, char y)
+*               == arctan_cordic(x, y)
+*
+*  Each table is 129*129 ushorts, which fits in a handful of M20K blocks.
+*
+*******************************************************************************/
+
+#ifndef POLAR_LUT_H_
+#define POLAR_LUT_H_
+
+#define POLAR_LUT_DIM  129  // |x| and |y| of a char run from 0 to 128
+
+#include "polar_tables_int8.h"
+
+
+// the magnitude only depends on |x| and |y|
+unsigned int mag_lut_int8(char x, char y){
+	
+	int xa = x;
+	int ya = y;
+	if (xa<0) xa=-xa;
+	if (ya<0) ya=-ya;
+	
+	return mag_table_int8[xa*POLAR_LUT_DIM + ya];
+}
+
+
+// uses the same axis special cases and quadrant rotation as
+// arctan_cordic and checkQuadrant
+unsigned short arctan_lut_int8(char x, char y){
+	
+	unsigned short atan;
+	int quadrant;
+	int xf;
+	int yf;
+	
+	if (x==0){
+		if (y>=0) atan=16384;
+		else      atan=49152;
+	}else if (y==0){
+		if (x>=0) atan=0;
+		else      atan=32768;
+	}else{
+		if (x>0 & y>0){
+			quadrant=0; xf=x; yf=y;
+		}else if (x<0 & y>0){
+			quadrant=1; xf=y; yf=-x;
+		}else if (x<0 & y<0){
+			quadrant=2; xf=-x; yf=-y;
+		}else {
+			quadrant=3; xf=-y; yf=x;
+		}
+		atan = (quadrant<<14) | arctan_table_int8[xf*POLAR_LUT_DIM + yf];
+	}
+	
+	return atan;
+}
+
+#endif
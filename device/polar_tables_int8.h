@@ -0,0 +1,2092 @@
+// Generated by tools/gen_polar_tables.cpp from device/cordic.h.  Do not edit.
+// Indexed [x*129 + y] for 0 <= x,y <= 128, see device/polar_lut.h
+#ifndef POLAR_TABLES_INT8_H_
+#define POLAR_TABLES_INT8_H_
+
+__constant unsigned short mag_table_int8[16641]={
+0,257,513,769,1024,1288,1537,1793,2048,2305,2568,2818,3073,3330,3591,3848,
+4097,4360,4615,4865,5127,5378,5634,5889,6145,6402,6663,6920,7175,7426,7687,7943,
+8199,8455,8705,8967,9217,9474,9735,9991,10241,10503,10759,11015,11271,11521,11783,12034,
+12290,12546,12802,13063,13313,13570,13825,14081,14343,14600,14855,15105,15367,15617,15874,16135,
+16385,16647,16897,17154,17415,17671,17921,18177,18439,18695,18945,19201,19457,19719,19974,20225,
+20486,20737,20993,21254,21505,21767,22017,22278,22530,22791,23047,23303,23553,23815,24066,24322,
+24577,24839,25090,25346,25601,25857,26119,26370,26626,26882,27138,27398,27655,27906,28161,28417,
+28678,28930,29186,29441,29697,29953,30210,30465,30726,30978,31238,31495,31750,32002,32257,32513,
+32769,266,363,574,820,1057,1314,1566,1811,2071,2326,2575,2836,3090,3348,3603,
+3851,4113,4369,4624,4879,5136,5390,5641,5902,6158,6414,6662,6919,7181,7430,7693,
+7942,8203,8461,8717,8965,9228,9483,9740,9989,10246,10501,10761,11012,11268,11531,11781,
+12041,12297,12554,12809,13065,13322,13571,13828,14090,14340,14596,14852,15107,15364,15619,15875,
+16137,16387,16648,16904,17153,17420,17675,17925,18181,18436,18694,18954,19204,19460,19715,19979,
+20229,20490,20746,21001,21252,21508,21769,22025,22275,22538,22793,23043,23303,23563,23813,24069,
+24329,24586,24842,25092,25353,25609,25866,26121,26371,26629,26888,27145,27396,27651,27913,28167,
+28418,28682,28937,29188,29449,29700,29960,30217,30468,30724,30979,31235,31495,31751,32010,32265,
+32520,32772,522,574,725,931,1154,1378,1621,1873,2113,2368,2619,2871,3123,3368,
+3621,3883,4135,4390,4644,4892,5154,5408,5657,5911,6172,6427,6686,6940,7195,7451,
+7699,7962,8216,8473,8721,8978,9233,9487,9749,10000,10262,10516,10765,11027,11280,11540,
+11790,12051,12301,12562,12813,13075,13329,13580,13842,14091,14353,14603,14857,15121,15377,15626,
+15888,16138,16393,16654,16907,17163,17425,17673,17929,18186,18441,18697,18958,19207,19466,19727,
+19976,20238,20489,20748,21005,21258,21511,21772,22023,22280,22539,22798,23048,23305,23560,23817,
+24071,24331,24583,24846,25096,25356,25607,25862,26123,26375,26636,26885,27141,27405,27660,27911,
+28167,28427,28677,28940,29195,29449,29708,29963,30213,30476,30731,30987,31241,31499,31750,32004,
+32267,32523,32773,769,820,932,1087,1289,1501,1726,1958,2195,2431,2675,2926,3176,
+3416,3666,3917,4177,4421,4673,4925,5184,5437,5692,5940,6199,6447,6708,6955,7217,
+7472,7727,7974,8234,8490,8746,8993,9255,9504,9759,10017,10278,10528,10790,11037,11298,
+11548,11809,12058,12320,12570,12826,13081,13338,13598,13848,14108,14360,14620,14877,15125,15388,
+15637,15897,16154,16409,16658,16923,17178,17434,17684,17944,18193,18451,18713,18968,19218,19473,
+19735,19985,20243,20497,20752,21009,21270,21525,21782,22031,22291,22544,22799,23060,23309,23566,
+23827,24084,24338,24594,24850,25101,25360,25614,25875,26128,26387,26643,26892,27150,27410,27660,
+27916,28178,28433,28689,28947,29197,29452,29712,29963,30225,30481,30732,30986,31250,31504,31760,
+32016,32266,32528,32783,1034,1056,1154,1288,1449,1649,1854,2073,2291,2523,2757,3005,
+3248,3491,3730,3976,4231,4480,4728,4972,5229,5480,5726,5977,6230,6488,6742,6988,
+7248,7497,7749,8010,8263,8517,8766,9026,9273,9527,9783,10037,10300,10547,10801,11062,
+11312,11571,11827,12076,12332,12587,12846,13102,13360,13610,13870,14120,14382,14631,14893,15147,
+15396,15659,15913,16163,16423,16676,16931,17192,17440,17701,17952,18213,18468,18725,18972,19237,
+19486,19747,20001,20252,20515,20764,21024,21274,21529,21792,22041,22306,22560,22816,23066,23327,
+23581,23833,24089,24351,24605,24856,25112,25372,25624,25884,26140,26394,26645,26909,27164,27414,
+27675,27931,28181,28443,28697,28947,29210,29460,29714,29972,30227,30488,30740,30996,31255,31510,
+31768,32023,32274,32529,32785,1289,1312,1389,1501,1639,1811,2007,2212,2425,2637,2871,
+3104,3330,3574,3814,4058,4292,4539,4791,5038,5279,5533,5784,6032,6281,6529,6779,
+7033,7290,7540,7787,8041,8292,8553,8805,9052,9313,9561,9821,10073,10326,10575,10835,
+11089,11344,11591,11851,12108,12355,12610,12872,13126,13374,13633,13884,14140,14393,14649,14911,
+15164,15414,15674,15923,16185,16434,16693,16947,17202,17457,17720,17975,18229,18487,18741,18997,
+19245,19500,19761,20011,20266,20522,20786,21040,21295,21545,21800,22055,22312,22573,22827,23083,
+23333,23589,23851,24106,24361,24616,24872,25122,25383,25641,25896,26151,26406,26663,26912,27167,
+27428,27679,27938,28193,28454,28704,28964,29216,29475,29732,29981,30241,30499,30750,31005,31261,
+31521,31772,32028,32289,32544,32800,1545,1566,1621,1726,1855,2009,2173,2368,2569,2770,
+2993,3216,3443,3674,3907,4135,4375,4616,4867,5110,5354,5595,5838,6094,6335,6589,
+6832,7088,7331,7583,7834,8092,8344,8588,8841,9100,9345,9597,9856,10109,10356,10609,
+10862,11124,11376,11630,11878,12138,12390,12639,12893,13154,13402,13655,13911,14163,14425,14679,
+14935,15184,15446,15692,15947,16202,16456,16710,16967,17222,17483,17737,17993,18246,18503,18753,
+19013,19261,19523,19777,20035,20285,20541,20801,21052,21307,21568,21816,22077,22329,22583,22844,
+23093,23350,23605,23865,24118,24372,24627,24882,25144,25395,25654,25904,26159,26420,26672,26926,
+27187,27438,27698,27953,28208,28458,28717,28971,29227,29487,29738,29993,30249,30505,30767,31016,
+31277,31533,31787,32045,32294,32555,32805,1801,1813,1864,1951,2071,2203,2362,2542,2729,
+2926,3133,3348,3558,3788,4016,4239,4478,4715,4953,5190,5432,5676,5920,6156,6402,
+6654,6897,7149,7398,7638,7888,8138,8387,8636,8893,9139,9391,9648,9900,10147,10397,
+10651,10907,11155,11413,11668,11918,12166,12424,12673,12925,13187,13440,13688,13949,14195,14448,
+14703,14963,15217,15465,15726,15974,16234,16488,16740,16997,17246,17508,17762,18018,18265,18525,
+18775,19035,19289,19546,19795,20054,20304,20565,20819,21074,21323,21579,21834,22094,22343,22599,
+22859,23110,23369,23629,23884,24140,24389,24645,24905,25157,25415,25670,25922,26177,26437,26692,
+26941,27198,27459,27714,27968,28221,28480,28730,28990,29243,29498,29752,30012,30264,30525,30780,
+31029,31286,31541,31802,32057,32308,32568,32825,2050,2073,2111,2196,2291,2414,2568,2729,
+2903,3084,3288,3492,3693,3909,4137,4360,4588,4819,5044,5279,5514,5762,6002,6235,
+6480,6723,6973,7211,7463,7704,7957,8204,8452,8695,8950,9191,9448,9691,9949,10192,
+10450,10697,10953,11200,11455,11702,11959,12208,12459,12713,12964,13222,13470,13723,13981,14230,
+14488,14734,14991,15251,15498,15758,16005,16264,16513,16769,17027,17281,17531,17782,18044,18292,
+18552,18805,19053,19316,19566,19826,20078,20334,20591,20839,21098,21352,21607,21863,22117,22374,
+22627,22878,23136,23393,23642,23897,24152,24413,24662,24917,25172,25427,25687,25937,26191,26447,
+26706,26961,27216,27472,27726,27985,28238,28492,28753,29004,29264,29520,29775,30026,30285,30541,
+30796,31046,31303,31563,31818,32067,32324,32584,32839,2313,2328,2362,2431,2523,2637,2772,
+2928,3092,3259,3452,3641,3841,4047,4267,4479,4708,4933,5154,5393,5624,5850,6091,
+6331,6569,6810,7051,7296,7537,7781,8021,8266,8518,8764,9013,9260,9508,9756,9997,
+10253,10497,10749,10997,11248,11503,11750,12009,12254,12505,12763,13012,13259,13511,13769,14016,
+14268,14526,14774,15033,15286,15534,15793,16039,16293,16551,16806,17060,17314,17567,17816,18070,
+18322,18577,18832,19091,19339,19599,19846,20107,20361,20615,20865,21123,21374,21635,21890,22142,
+22399,22646,22901,23163,23418,23667,23925,24180,24435,24689,24944,25202,25451,25710,25965,26213,
+26470,26723,26985,27234,27495,27745,28000,28260,28515,28764,29019,29275,29537,29790,30050,30300,
+30555,30810,31065,31319,31580,31830,32092,32347,32596,32857,2569,2574,2617,2673,2768,2871,
+2994,3133,3285,3452,3620,3816,4006,4208,4413,4616,4840,5058,5278,5504,5733,5962,
+6196,6430,6664,6893,7133,7379,7612,7861,8105,8347,8584,8831,9075,9327,9568,9817,
+10062,10314,10564,10811,11054,11303,11560,11809,12052,12303,12557,12807,13056,13312,13563,13814,
+14068,14312,14571,14818,15073,15322,15574,15826,16080,16336,16588,16843,17097,17349,17602,17849,
+18108,18362,18612,18865,19119,19378,19632,19879,20138,20392,20640,20897,21149,21408,21663,21912,
+22171,22420,22674,22934,23188,23444,23691,23953,24207,24457,24710,24970,25224,25480,25736,25983,
+26245,26493,26747,27007,27262,27517,27767,28024,28278,28539,28791,29041,29298,29557,29813,30062,
+30321,30573,30827,31082,31338,31598,31847,32107,32358,32618,32873,2818,2836,2871,2928,3007,
+3102,3215,3348,3492,3639,3815,3990,4169,4367,4559,4761,4971,5184,5409,5622,5846,
+6070,6305,6528,6761,7000,7235,7464,7702,7942,8181,8429,8670,8914,9151,9401,9639,
+9883,10130,10377,10623,10870,11122,11364,11613,11867,12109,12365,12614,12862,13109,13363,13614,
+13863,14118,14361,14612,14868,15115,15367,15619,15875,16123,16379,16629,16885,17131,17383,17641,
+17890,18140,18401,18652,18900,19153,19407,19659,19919,20166,20423,20676,20933,21182,21436,21690,
+21944,22197,22456,22703,22962,23219,23472,23727,23981,24229,24491,24738,24993,25246,25506,25754,
+26011,26273,26521,26779,27034,27285,27538,27798,28048,28308,28557,28816,29066,29326,29576,29835,
+30091,30340,30594,30850,31105,31359,31620,31875,32131,32384,32634,32894,3082,3092,3123,3175,
+3248,3330,3436,3565,3701,3848,4007,4176,4345,4539,4728,4921,5128,5334,5545,5756,
+5972,6201,6424,6644,6871,7105,7339,7571,7800,8036,8271,8511,8750,8998,9231,9473,
+9725,9966,10205,10450,10693,10938,11190,11431,11676,11924,12180,12419,12675,12915,13165,13415,
+13668,13913,14168,14413,14668,14912,15170,15416,15667,15923,16169,16425,16673,16930,17174,17433,
+17684,17936,18191,18442,18688,18941,19198,19451,19698,19950,20209,20457,20711,20968,21218,21476,
+21724,21975,22239,22485,22744,22993,23251,23504,23759,24007,24268,24518,24774,25031,25283,25536,
+25790,26039,26295,26548,26807,27062,27311,27564,27825,28078,28328,28581,28838,29093,29347,29601,
+29862,30111,30366,30625,30882,31134,31384,31639,31899,32150,32402,32658,32917,3330,3348,3369,
+3418,3490,3574,3666,3788,3916,4057,4199,4368,4529,4714,4900,5084,5280,5479,5692,
+5899,6107,6326,6551,6771,6991,7222,7450,7678,7904,8144,8373,8613,8850,9088,9325,
+9559,9800,10040,10282,10528,10777,11013,11258,11509,11753,11992,12239,12492,12737,12981,13234,
+13475,13730,13977,14219,14471,14720,14975,15224,15466,15717,15967,16225,16473,16722,16971,17227,
+17480,17731,17975,18228,18487,18738,18990,19234,19493,19741,19993,20245,20499,20752,21009,21256,
+21508,21768,22020,22268,22522,22777,23033,23285,23538,23787,24039,24300,24554,24809,25061,25315,
+25570,25822,26070,26331,26584,26838,27085,27343,27601,27854,28103,28362,28616,28870,29126,29374,
+29633,29888,30142,30391,30652,30900,31161,31411,31666,31925,32173,32429,32684,32942,3593,3600,
+3622,3674,3727,3815,3907,4008,4135,4264,4411,4566,4729,4898,5069,5255,5444,5647,
+5845,6042,6252,6468,6686,6895,7122,7344,7562,7793,8016,8252,8477,8715,8942,9185,
+9421,9656,9896,10129,10374,10611,10856,11098,11337,11579,11824,12067,12316,12562,12808,13054,
+13295,13546,13789,14041,14290,14531,14785,15033,15280,15523,15780,16023,16279,16522,16779,17023,
+17272,17529,17780,18026,18282,18529,18780,19029,19288,19540,19791,20037,20296,20541,20798,21049,
+21304,21554,21807,22059,22308,22566,22813,23065,23326,23571,23829,24084,24331,24585,24842,25095,
+25344,25597,25854,26110,26365,26617,26872,27125,27374,27633,27888,28140,28393,28648,28902,29149,
+29405,29666,29918,30173,30422,30682,30934,31186,31445,31699,31946,32205,32461,32715,32970,3841,
+3850,3875,3917,3981,4058,4146,4239,4354,4480,4624,4772,4918,5083,5253,5432,5624,
+5811,6000,6198,6402,6615,6816,7037,7255,7465,7693,7913,8140,8360,8595,8823,9057,
+9290,9521,9750,9991,10227,10468,10705,10937,11178,11418,11665,11902,12147,12395,12633,12876,
+13120,13372,13617,13862,14102,14355,14596,14844,15090,15345,15585,15835,16089,16331,16580,16831,
+17079,17335,17584,17832,18077,18334,18579,18835,19078,19332,19587,19840,20085,20342,20591,20841,
+21091,21349,21593,21847,22099,22355,22602,22856,23113,23360,23611,23872,24124,24377,24627,24880,
+25129,25387,25641,25888,26142,26400,26647,26905,27159,27408,27659,27921,28176,28428,28676,28930,
+29183,29444,29691,29950,30204,30453,30711,30965,31219,31475,31724,31983,32235,32485,32744,32993,
+4098,4112,4137,4167,4231,4299,4384,4480,4581,4700,4836,4973,5127,5279,5444,5620,
+5800,5984,6172,6366,6560,6760,6963,7180,7391,7605,7817,8038,8264,8482,8705,8939,
+9161,9389,9623,9860,10088,10327,10563,10793,11029,11276,11509,11753,11985,12233,12469,12710,
+12956,13205,13443,13692,13936,14181,14420,14665,14912,15158,15405,15651,15905,16146,16394,16647,
+16896,17138,17388,17635,17885,18141,18388,18634,18889,19133,19382,19633,19883,20135,20389,20637,
+20888,21140,21395,21647,21893,22145,22397,22652,22904,23155,23402,23659,23912,24164,24418,24669,
+24917,25175,25429,25673,25932,26180,26437,26688,26944,27192,27450,27704,27951,28206,28458,28710,
+28969,29224,29471,29726,29985,30238,30493,30745,30998,31247,31507,31755,32015,32262,32516,32770,
+33029,4354,4367,4384,4421,4478,4544,4624,4708,4809,4925,5055,5194,5335,5480,5638,
+5814,5985,6156,6340,6535,6722,6925,7119,7330,7531,7749,7953,8171,8395,8608,8829,
+9054,9279,9504,9740,9961,10195,10433,10665,10901,11129,11365,11600,11844,12083,12316,12560,
+12797,13044,13278,13521,13772,14014,14259,14501,14739,14992,15236,15475,15720,15972,16212,16464,
+16704,16961,17200,17449,17702,17952,18200,18442,18691,18946,19190,19439,19688,19943,20192,20440,
+20688,20939,21190,21445,21689,21943,22193,22445,22702,22948,23198,23449,23706,23952,24209,24461,
+24713,24961,25217,25464,25715,25975,26222,26474,26733,26982,27237,27484,27742,27991,28243,28503,
+28754,29006,29255,29508,29760,30021,30268,30525,30780,31027,31281,31537,31795,32050,32301,32550,
+32804,33057,4616,4616,4645,4679,4729,4783,4867,4945,5044,5153,5280,5408,5547,5691,
+5847,6000,6173,6346,6524,6708,6891,7088,7279,7483,7688,7889,8101,8314,8522,8740,
+8964,9186,9402,9632,9857,10082,10311,10535,10775,10999,11238,11469,11705,11935,12177,12407,
+12653,12891,13125,13365,13607,13847,14086,14329,14581,14818,15065,15306,15548,15798,16039,16291,
+16529,16781,17028,17273,17519,17769,18011,18264,18512,18757,19008,19255,19504,19747,19994,20251,
+20499,20749,20994,21250,21499,21748,21998,22246,22495,22750,22995,23253,23503,23756,24003,24257,
+24510,24760,25007,25264,25517,25766,26012,26270,26518,26774,27026,27277,27532,27784,28031,28283,
+28535,28794,29041,29300,29552,29805,30059,30306,30565,30813,31065,31317,31579,31830,32082,32336,
+32590,32842,33097,4866,4871,4893,4933,4973,5037,5108,5193,5279,5393,5504,5628,5760,
+5902,6043,6199,6368,6527,6708,6886,7069,7252,7450,7647,7845,8041,8244,8452,8665,
+8877,9100,9316,9538,9756,9973,10197,10423,10649,10884,11113,11343,11577,11803,12042,12271,
+12505,12749,12978,13224,13461,13695,13932,14173,14421,14655,14904,15146,15385,15627,15870,16119,
+16359,16607,16847,17100,17338,17589,17830,18082,18323,18575,18825,19071,19319,19566,19807,20056,
+20306,20554,20803,21050,21300,21550,21799,22051,22303,22549,22803,23055,23304,23549,23800,24055,
+24305,24559,24808,25054,25305,25562,25813,26059,26316,26564,26815,27066,27319,27571,27824,28074,
+28327,28577,28837,29083,29336,29593,29841,30097,30348,30600,30855,31105,31357,31614,31869,32121,
+32374,32628,32874,33133,5128,5135,5147,5185,5228,5279,5352,5433,5519,5623,5726,5845,
+5972,6110,6252,6402,6557,6721,6889,7070,7248,7433,7622,7804,7999,8199,8400,8608,
+8817,9026,9231,9451,9663,9880,10102,10328,10549,10775,10996,11226,11456,11685,11908,12148,
+12383,12614,12849,13079,13315,13557,13791,14031,14270,14503,14742,14982,15224,15470,15713,15948,
+16195,16443,16686,16930,17172,17418,17658,17909,18147,18392,18645,18891,19133,19384,19629,19880,
+20126,20369,20616,20863,21113,21367,21614,21862,22106,22362,22605,22861,23106,23359,23609,23855,
+24103,24353,24610,24859,25109,25359,25605,25863,26114,26360,26612,26869,27113,27370,27622,27874,
+28120,28373,28628,28874,29134,29380,29637,29888,30135,30389,30642,30893,31146,31399,31655,31903,
+32163,32413,32661,32914,33166,5379,5390,5409,5439,5480,5535,5592,5676,5754,5850,5964,
+6071,6199,6323,6470,6613,6766,6924,7082,7251,7424,7604,7787,7974,8172,8361,8565,
+8757,8967,9167,9377,9594,9807,10017,10233,10457,10674,10894,11115,11347,11566,11803,12030,
+12251,12489,12720,12953,13181,13414,13649,13883,14127,14365,14597,14840,15078,15312,15551,15798,
+16039,16280,16522,16764,17009,17247,17488,17739,17977,18222,18465,18711,18962,19207,19453,19694,
+19945,20192,20438,20689,20928,21182,21429,21672,21927,22174,22420,22666,22913,23168,23414,23661,
+23915,24166,24409,24658,24913,25164,25409,25664,25908,26159,26416,26667,26921,27164,27414,27665,
+27922,28169,28419,28675,28928,29180,29431,29683,29930,30186,30434,30688,30941,31193,31447,31693,
+31946,32199,32455,32703,32956,33213,5634,5638,5657,5691,5733,5783,5840,5916,6003,6094,
+6186,6304,6422,6548,6686,6820,6974,7126,7277,7443,7621,7787,7966,8157,8336,8528,
+8726,8924,9117,9326,9524,9731,9949,10155,10368,10592,10804,11027,11242,11471,11689,11919,
+12144,12374,12601,12825,13055,13288,13519,13751,13992,14228,14462,14698,14929,15170,15410,15641,
+15887,16126,16361,16607,16842,17089,17332,17567,17814,18055,18298,18548,18793,19032,19275,19528,
+19764,20011,20257,20508,20750,20999,21243,21493,21742,21991,22236,22481,22731,22982,23229,23477,
+23721,23968,24218,24475,24721,24971,25214,25465,25718,25962,26216,26470,26714,26969,27220,27470,
+27720,27967,28220,28476,28725,28971,29227,29479,29725,29976,30228,30482,30732,30988,31235,31486,
+31742,31995,32247,32493,32752,33002,33253,5890,5899,5913,5939,5980,6028,6091,6158,6237,
+6324,6428,6529,6643,6765,6900,7031,7181,7331,7485,7637,7811,7976,8149,8334,8518,
+8698,8894,9088,9285,9484,9686,9889,10091,10299,10515,10723,10942,11155,11374,11593,11820,
+12041,12260,12492,12712,12946,13173,13397,13626,13865,14092,14330,14563,14798,15034,15268,15506,
+15742,15975,16213,16451,16690,16935,17170,17410,17653,17899,18135,18377,18623,18866,19115,19353,
+19602,19841,20086,20330,20580,20822,21071,21312,21559,21803,22057,22303,22548,22798,23040,23294,
+23534,23786,24032,24285,24527,24782,25029,25278,25527,25776,26027,26271,26521,26770,27018,27275,
+27520,27775,28019,28276,28519,28769,29020,29277,29530,29777,30030,30281,30533,30779,31036,31282,
+31537,31789,32036,32289,32544,32792,33048,33293,6147,6155,6174,6201,6236,6284,6342,6401,
+6480,6570,6663,6767,6870,6988,7113,7252,7387,7531,7687,7845,8001,8172,8343,8511,
+8696,8875,9068,9255,9448,9635,9844,10040,10243,10445,10655,10870,11078,11296,11508,11724,
+11943,12165,12392,12608,12839,13063,13285,13512,13746,13975,14199,14438,14671,14902,15135,15362,
+15604,15841,16075,16313,16549,16784,17027,17267,17500,17738,17977,18220,18462,18708,18944,19186,
+19438,19681,19919,20168,20406,20655,20900,21138,21389,21629,21881,22125,22366,22615,22859,23106,
+23352,23608,23847,24096,24348,24595,24837,25087,25340,25588,25830,26085,26328,26583,26827,27082,
+27329,27575,27824,28073,28322,28572,28823,29074,29330,29579,29830,30075,30331,30576,30836,31082,
+31336,31588,31833,32085,32336,32586,32844,33094,33343,6402,6411,6429,6448,6490,6528,6590,
+6654,6719,6804,6897,7000,7107,7222,7336,7472,7608,7740,7888,8040,8197,8359,8525,
+8704,8873,9052,9235,9422,9612,9810,10005,10198,10397,10604,10805,11014,11227,11438,11644,
+11866,12079,12303,12515,12742,12961,13185,13406,13637,13862,14089,14320,14543,14778,15009,15242,
+15471,15702,15934,16171,16406,16648,16883,17115,17353,17596,17830,18075,18307,18549,18796,19029,
+19272,19511,19759,19996,20247,20491,20728,20979,21214,21459,21708,21947,22199,22439,22689,22931,
+23175,23421,23667,23920,24160,24412,24656,24907,25151,25398,25646,25894,26148,26396,26643,26892,
+27142,27389,27634,27889,28137,28380,28637,28886,29135,29385,29628,29880,30134,30385,30630,30886,
+31135,31380,31632,31880,32141,32392,32636,32886,33144,33390,6664,6663,6686,6708,6742,6779,
+6832,6893,6965,7053,7133,7235,7331,7443,7561,7685,7824,7962,8104,8247,8398,8565,
+8721,8896,9058,9241,9414,9604,9791,9978,10165,10366,10558,10759,10965,11169,11376,11585,
+11787,12005,12219,12439,12653,12865,13087,13307,13530,13756,13984,14204,14428,14663,14886,15113,
+15350,15577,15807,16039,16280,16514,16747,16978,17219,17449,17685,17927,18168,18407,18638,18884,
+19118,19357,19599,19844,20086,20327,20569,20806,21052,21300,21544,21785,22024,22274,22513,22756,
+23008,23248,23492,23739,23987,24236,24481,24729,24970,25221,25463,25717,25964,26211,26459,26700,
+26949,27203,27445,27699,27942,28191,28446,28690,28944,29188,29443,29692,29941,30185,30436,30683,
+30938,31184,31435,31690,31938,32186,32441,32689,32941,33192,33446,6914,6917,6937,6958,6991,
+7031,7082,7148,7211,7296,7380,7472,7571,7680,7787,7915,8041,8175,8316,8461,8604,
+8765,8918,9081,9250,9422,9597,9782,9960,10145,10340,10526,10726,10924,11117,11318,11522,
+11732,11935,12144,12355,12573,12787,13007,13224,13442,13662,13884,14107,14331,14549,14776,15007,
+15234,15463,15687,15922,16156,16379,16613,16853,17080,17315,17548,17790,18020,18261,18498,18739,
+18975,19209,19447,19692,19927,20166,20409,20653,20894,21130,21377,21619,21867,22111,22346,22590,
+22833,23083,23326,23572,23813,24057,24302,24553,24793,25038,25286,25532,25781,26030,26276,26522,
+26767,27019,27261,27515,27757,28004,28253,28508,28749,29002,29247,29495,29749,29992,30249,30491,
+30741,30990,31240,31495,31745,31988,32240,32490,32746,32995,33239,33497,7177,7180,7193,7216,
+7249,7283,7339,7397,7462,7537,7614,7704,7806,7911,8015,8139,8263,8386,8531,8664,
+8809,8967,9119,9284,9443,9611,9782,9960,10143,10328,10509,10701,10892,11081,11284,11483,
+11676,11880,12085,12298,12502,12711,12930,13142,13360,13576,13788,14007,14235,14450,14673,14897,
+15121,15347,15574,15802,16036,16265,16490,16725,16953,17185,17417,17657,17890,18127,18356,18590,
+18834,19070,19300,19540,19779,20023,20256,20495,20740,20975,21219,21464,21700,21948,22185,22423,
+22675,22912,23161,23405,23644,23887,24132,24377,24625,24871,25112,25359,25607,25853,26096,26345,
+26586,26838,27080,27332,27581,27821,28073,28321,28570,28812,29060,29309,29562,29805,30058,30303,
+30555,30800,31052,31298,31552,31803,32050,32296,32545,32795,33043,33293,33545,7427,7437,7447,
+7465,7495,7542,7584,7640,7702,7780,7862,7942,8043,8138,8251,8359,8485,8614,8746,
+8884,9021,9167,9326,9476,9646,9804,9978,10145,10326,10501,10690,10870,11063,11255,11447,
+11636,11837,12042,12246,12449,12655,12863,13074,13286,13496,13711,13929,14140,14360,14580,14804,
+15020,15243,15475,15694,15926,16151,16373,16604,16837,17060,17292,17531,17763,17991,18227,18462,
+18698,18933,19161,19398,19642,19878,20115,20353,20588,20825,21071,21306,21550,21793,22028,22273,
+22508,22756,22997,23237,23486,23722,23966,24209,24452,24698,24947,25190,25435,25680,25925,26165,
+26417,26661,26907,27150,27400,27640,27888,28140,28385,28631,28882,29129,29378,29625,29873,30120,
+30369,30618,30861,31109,31363,31606,31861,32107,32354,32603,32857,33107,33357,33605,7688,7685,
+7705,7719,7749,7793,7834,7887,7956,8019,8105,8183,8275,8370,8483,8588,8706,8835,
+8965,9090,9233,9377,9533,9686,9842,10005,10164,10338,10505,10688,10868,11053,11238,11427,
+11614,11809,11998,12203,12396,12599,12802,13006,13222,13431,13639,13847,14067,14280,14495,14712,
+14935,15150,15377,15593,15820,16041,16271,16492,16719,16946,17176,17409,17639,17863,18099,18329,
+18569,18794,19033,19269,19498,19739,19975,20206,20443,20685,20921,21162,21397,21639,21879,22117,
+22360,22599,22835,23081,23317,23568,23807,24045,24294,24537,24781,25024,25262,25507,25750,26000,
+26238,26491,26735,26976,27225,27471,27717,27963,28203,28449,28698,28948,29195,29436,29690,29939,
+30185,30434,30680,30923,31170,31419,31674,31922,32170,32413,32666,32915,33160,33415,33659,7944,
+7942,7953,7976,8004,8040,8084,8144,8203,8271,8345,8430,8518,8614,8715,8819,8932,
+9052,9177,9315,9453,9586,9740,9883,10037,10196,10366,10527,10701,10867,11044,11231,11412,
+11597,11786,11970,12163,12358,12556,12763,12958,13165,13365,13579,13780,13997,14209,14414,14635,
+14852,15069,15286,15500,15719,15947,16164,16387,16612,16843,17070,17296,17518,17748,17977,18212,
+18442,18669,18907,19139,19368,19602,19834,20075,20305,20540,20776,21018,21251,21494,21733,21971,
+22208,22450,22689,22923,23164,23404,23650,23887,24126,24369,24616,24860,25104,25341,25585,25827,
+26079,26317,26560,26811,27048,27293,27538,27789,28033,28274,28526,28766,29015,29260,29511,29757,
+29997,30252,30495,30742,30989,31235,31484,31736,31980,32231,32477,32730,32971,33224,33474,33722,
+8200,8204,8216,8237,8264,8301,8335,8387,8446,8511,8585,8664,8752,8851,8950,9047,
+9160,9282,9399,9527,9661,9800,9944,10090,10241,10397,10557,10727,10892,11062,11234,11413,
+11591,11769,11959,12143,12332,12525,12719,12919,13123,13321,13526,13723,13927,14142,14346,14561,
+14775,14982,15197,15417,15631,15852,16078,16298,16520,16742,16962,17192,17415,17636,17869,18091,
+18320,18549,18778,19009,19249,19480,19711,19943,20178,20407,20647,20879,21111,21353,21585,21827,
+22059,22302,22542,22775,23015,23253,23493,23737,23971,24218,24459,24695,24941,25184,25426,25669,
+25913,26157,26400,26637,26887,27130,27375,27614,27859,28101,28350,28594,28842,29088,29328,29575,
+29822,30073,30319,30559,30807,31053,31300,31549,31795,32044,32291,32539,32786,33034,33282,33536,
+33785,8456,8452,8470,8490,8517,8546,8595,8646,8695,8764,8827,8914,9000,9088,9178,
+9279,9391,9512,9624,9757,9886,10017,10156,10299,10456,10607,10757,10923,11082,11253,11426,
+11600,11770,11948,12132,12322,12504,12693,12891,13086,13278,13475,13676,13884,14082,14285,14501,
+14703,14914,15125,15343,15557,15775,15987,16205,16421,16647,16868,17091,17307,17532,17764,17990,
+18208,18435,18662,18898,19122,19356,19587,19813,20052,20282,20517,20749,20984,21218,21452,21683,
+21918,22156,22397,22629,22869,23106,23343,23581,23827,24066,24307,24542,24783,25027,25262,25505,
+25747,25990,26232,26479,26719,26960,27204,27451,27697,27934,28186,28429,28673,28913,29163,29403,
+29646,29898,30143,30390,30629,30883,31123,31374,31615,31867,32109,32356,32608,32857,33100,33351,
+33599,33847,8706,8708,8726,8740,8766,8799,8840,8888,8942,9011,9080,9149,9233,9327,
+9414,9516,9626,9732,9856,9972,10099,10232,10371,10516,10657,10806,10965,11116,11280,11446,
+11617,11786,11961,12131,12316,12500,12684,12871,13057,13247,13442,13635,13841,14035,14244,14440,
+14652,14852,15060,15275,15483,15692,15911,16125,16338,16560,16775,16998,17213,17440,17657,17880,
+18110,18336,18561,18781,19007,19242,19471,19701,19926,20158,20392,20623,20857,21088,21321,21550,
+21792,22020,22260,22495,22732,22969,23200,23442,23682,23919,24158,24390,24630,24876,25111,25350,
+25592,25837,26080,26317,26556,26798,27040,27283,27534,27770,28020,28262,28508,28750,28994,29239,
+29476,29721,29974,30213,30463,30707,30952,31199,31439,31686,31932,32178,32424,32675,32916,33163,
+33409,33659,33913,8967,8966,8975,8996,9021,9054,9091,9139,9200,9252,9325,9400,9481,
+9566,9654,9756,9860,9964,10083,10198,10326,10458,10588,10724,10872,11012,11164,11317,11481,
+11640,11803,11971,12141,12324,12499,12672,12860,13044,13234,13417,13615,13809,14003,14203,14400,
+14595,14804,15003,15208,15419,15626,15835,16049,16260,16480,16693,16909,17126,17350,17571,17792,
+18010,18228,18451,18677,18901,19132,19360,19580,19815,20038,20265,20497,20726,20961,21190,21423,
+21657,21894,22128,22360,22591,22825,23062,23303,23535,23776,24012,24246,24485,24729,24966,25201,
+25446,25682,25922,26159,26400,26641,26884,27129,27371,27612,27854,28092,28338,28585,28829,29070,
+29309,29554,29804,30046,30287,30530,30779,31027,31271,31512,31756,32002,32248,32493,32739,32992,
+33233,33485,33732,33978,9219,9227,9231,9250,9275,9311,9351,9389,9443,9508,9572,9638,
+9725,9799,9895,9991,10086,10192,10310,10424,10551,10669,10801,10946,11079,11228,11375,11521,
+11679,11836,11999,12165,12334,12505,12678,12861,13034,13217,13408,13592,13783,13970,14168,14357,
+14562,14755,14960,15158,15362,15566,15775,15982,16192,16410,16616,16829,17049,17268,17485,17701,
+17920,18134,18362,18584,18801,19028,19254,19479,19705,19926,20157,20387,20610,20837,21074,21304,
+21539,21763,22000,22227,22467,22699,22926,23162,23402,23633,23869,24105,24346,24583,24820,25060,
+25293,25531,25775,26010,26248,26489,26729,26967,27216,27457,27696,27933,28178,28421,28659,28907,
+29152,29390,29632,29881,30119,30370,30607,30851,31094,31341,31589,31837,32080,32320,32573,32817,
+33063,33302,33550,33802,34042,9474,9477,9494,9507,9538,9559,9603,9647,9700,9750,9821,
+9890,9963,10042,10130,10229,10326,10433,10541,10651,10774,10892,11028,11154,11298,11439,11584,
+11734,11880,12043,12194,12359,12531,12694,12864,13047,13218,13401,13579,13769,13957,14139,14338,
+14530,14723,14916,15115,15321,15523,15725,15924,16132,16345,16554,16759,16971,17190,17398,17612,
+17836,18054,18272,18484,18713,18932,19155,19372,19602,19821,20045,20277,20497,20729,20960,21188,
+21410,21647,21876,22102,22335,22571,22804,23037,23270,23506,23736,23976,24206,24445,24676,24911,
+25151,25387,25626,25864,26102,26345,26577,26818,27063,27302,27542,27784,28018,28261,28508,28742,
+28991,29227,29475,29711,29956,30199,30442,30691,30929,31178,31422,31660,31911,32153,32393,32646,
+32885,33134,33375,33625,33865,34111,9736,9731,9748,9762,9783,9811,9857,9900,9950,10000,
+10061,10129,10202,10285,10376,10459,10564,10664,10775,10882,10995,11124,11243,11373,11513,11654,
+11790,11936,12086,12243,12397,12562,12727,12892,13054,13233,13402,13585,13763,13947,14127,14319,
+14501,14697,14886,15085,15283,15480,15681,15878,16080,16290,16494,16701,16904,17115,17327,17539,
+17751,17971,18190,18402,18624,18844,19059,19278,19496,19727,19943,20169,20396,20617,20848,21075,
+21301,21527,21760,21984,22213,22443,22677,22912,23141,23375,23611,23842,24078,24309,24545,24779,
+25010,25255,25482,25723,25962,26199,26439,26677,26915,27152,27388,27632,27865,28106,28347,28588,
+28829,29069,29315,29552,29795,30041,30283,30525,30767,31009,31257,31501,31738,31988,32225,32476,
+32720,32965,33208,33452,33693,33945,34185,9991,9990,9999,10017,10039,10074,10110,10145,10195,
+10254,10314,10375,10447,10528,10610,10705,10795,10891,10997,11113,11229,11340,11471,11591,11732,
+11866,12007,12147,12297,12449,12597,12762,12914,13086,13253,13418,13587,13769,13946,14120,14304,
+14488,14680,14869,15059,15247,15446,15640,15842,16039,16234,16443,16648,16853,17060,17268,17477,
+17681,17899,18106,18326,18541,18753,18971,19189,19413,19629,19855,20069,20293,20515,20746,20972,
+21189,21421,21643,21874,22098,22328,22555,22786,23015,23251,23484,23710,23949,24183,24415,24642,
+24883,25114,25347,25588,25818,26055,26292,26527,26765,27004,27242,27481,27724,27962,28196,28441,
+28676,28921,29155,29398,29638,29880,30125,30368,30609,30845,31093,31336,31580,31817,32062,32311,
+32548,32792,33035,33284,33525,33768,34018,34262,10243,10245,10261,10274,10292,10328,10357,10397,
+10450,10498,10563,10622,10692,10775,10857,10938,11033,11128,11237,11346,11455,11568,11688,11820,
+11943,12076,12221,12363,12502,12654,12802,12962,13120,13275,13441,13609,13783,13956,14126,14303,
+14487,14665,14856,15044,15232,15421,15613,15807,15997,16195,16400,16595,16803,17004,17204,17409,
+17626,17834,18044,18249,18462,18675,18890,19113,19329,19539,19758,19984,20204,20424,20642,20868,
+21091,21317,21542,21767,21988,22216,22441,22671,22904,23133,23359,23589,23821,24057,24283,24520,
+24755,24988,25220,25448,25690,25924,26160,26395,26627,26867,27099,27334,27572,27812,28056,28293,
+28532,28767,29005,29250,29489,29724,29964,30205,30447,30688,30929,31171,31415,31659,31901,32141,
+32385,32627,32876,33118,33362,33601,33851,34094,34332,10498,10501,10515,10524,10548,10581,10610,
+10649,10695,10747,10811,10867,10937,11013,11098,11178,11268,11364,11470,11574,11684,11793,11918,
+12042,12163,12293,12435,12570,12718,12864,13015,13166,13321,13476,13638,13801,13969,14141,14317,
+14489,14672,14844,15027,15217,15399,15585,15778,15975,16166,16358,16562,16759,16961,17156,17364,
+17562,17773,17977,18184,18394,18610,18821,19035,19251,19458,19683,19894,20112,20336,20549,20771,
+20996,21213,21436,21663,21890,22110,22333,22566,22787,23012,23244,23472,23705,23929,24161,24395,
+24631,24860,25087,25324,25553,25791,26024,26253,26495,26730,26965,27201,27439,27670,27907,28149,
+28389,28627,28857,29097,29336,29576,29814,30053,30298,30534,30780,31015,31257,31503,31738,31979,
+32223,32463,32712,32954,33195,33437,33681,33923,34168,34417,10760,10762,10767,10780,10804,10836,
+10863,10907,10952,10999,11055,11122,11189,11257,11337,11421,11507,11602,11705,11809,11918,12022,
+12146,12260,12390,12514,12652,12791,12931,13075,13214,13366,13519,13677,13840,14003,14170,14329,
+14507,14678,14854,15028,15206,15389,15579,15767,15947,16144,16336,16522,16724,16922,17120,17314,
+17519,17716,17927,18133,18334,18543,18756,18966,19180,19384,19605,19814,20035,20246,20464,20686,
+20905,21125,21343,21563,21791,22008,22229,22457,22681,22914,23132,23360,23589,23816,24050,24279,
+24508,24738,24963,25202,25432,25660,25898,26125,26360,26597,26831,27062,27297,27533,27772,28010,
+28246,28479,28721,28950,29196,29435,29672,29905,30149,30389,30623,30864,31108,31348,31584,31830,
+32065,32307,32549,32795,33033,33280,33520,33764,34004,34252,34495,11016,11014,11028,11037,11065,
+11091,11115,11155,11199,11250,11305,11365,11432,11500,11578,11662,11753,11844,11937,12043,12148,
+12254,12372,12492,12608,12735,12872,13005,13139,13284,13431,13571,13724,13883,14036,14193,14365,
+14532,14699,14867,15040,15219,15390,15569,15758,15941,16128,16314,16499,16697,16890,17084,17284,
+17480,17679,17880,18077,18279,18490,18689,18905,19113,19322,19532,19739,19957,20168,20381,20600,
+20822,21040,21251,21476,21691,21912,22133,22361,22579,22804,23028,23257,23480,23710,23931,24166,
+24393,24617,24845,25081,25307,25537,25769,26005,26238,26464,26703,26934,27166,27398,27634,27868,
+28109,28345,28582,28811,29054,29285,29527,29768,30000,30242,30476,30719,30954,31197,31436,31672,
+31916,32157,32400,32639,32875,33117,33357,33599,33842,34084,34325,34574,11271,11276,11275,11296,
+11312,11344,11375,11413,11456,11507,11559,11619,11677,11753,11821,11903,11996,12078,12180,12271,
+12372,12484,12600,12713,12832,12962,13084,13221,13360,13499,13641,13782,13938,14081,14243,14400,
+14554,14727,14884,15053,15223,15404,15579,15750,15936,16115,16305,16491,16675,16862,17059,17245,
+17445,17635,17834,18034,18239,18442,18639,18843,19047,19255,19464,19679,19889,20100,20312,20522,
+20735,20955,21174,21391,21609,21827,22041,22268,22489,22711,22934,23152,23375,23605,23831,24056,
+24277,24503,24733,24960,25194,25418,25649,25882,26113,26341,26572,26805,27036,27270,27502,27738,
+27971,28207,28446,28675,28911,29151,29389,29624,29856,30093,30328,30575,30812,31046,31283,31526,
+31767,32007,32245,32481,32721,32959,33208,33443,33683,33932,34173,34408,34658,11522,11530,11537,
+11548,11574,11593,11629,11659,11704,11750,11803,11866,11923,11999,12072,12147,12236,12316,12411,
+12513,12614,12720,12826,12945,13063,13187,13307,13436,13569,13713,13848,13991,14143,14295,14441,
+14603,14753,14921,15081,15246,15416,15587,15758,15942,16114,16298,16477,16660,16853,17033,17223,
+17418,17608,17800,18001,18201,18399,18592,18802,19005,19207,19407,19619,19828,20036,20239,20455,
+20669,20880,21097,21304,21522,21739,21960,22179,22392,22618,22839,23060,23282,23506,23727,23947,
+24178,24402,24628,24855,25082,25305,25538,25767,25994,26225,26449,26685,26921,27151,27383,27614,
+27844,28081,28307,28547,28777,29016,29246,29481,29722,29955,30196,30425,30665,30901,31139,31383,
+31616,31855,32099,32339,32576,32810,33050,33295,33529,33772,34012,34258,34500,34734,11783,11781,
+11787,11807,11829,11854,11877,11919,11961,11999,12053,12110,12177,12240,12318,12386,12471,12562,
+12652,12750,12841,12953,13056,13172,13290,13404,13528,13655,13793,13927,14060,14202,14353,14501,
+14652,14805,14962,15113,15279,15441,15608,15781,15950,16126,16297,16475,16660,16845,17028,17211,
+17394,17591,17780,17966,18162,18362,18561,18753,18960,19159,19356,19560,19771,19970,20179,20392,
+20597,20811,21024,21231,21446,21663,21872,22098,22308,22526,22745,22963,23189,23410,23626,23855,
+24071,24299,24519,24745,24975,25200,25421,25649,25878,26105,26334,26563,26796,27022,27252,27489,
+27722,27953,28181,28412,28652,28879,29118,29348,29584,29823,30054,30295,30524,30767,31004,31234,
+31472,31714,31948,32191,32425,32662,32902,33142,33384,33624,33859,34105,34340,34581,34821,12035,
+12042,12050,12064,12079,12107,12131,12168,12211,12251,12305,12364,12426,12486,12560,12631,12712,
+12797,12892,12981,13077,13181,13286,13404,13511,13634,13752,13884,14008,14140,14282,14417,14566,
+14709,14852,15003,15164,15314,15480,15642,15801,15968,16138,16314,16481,16660,16843,17022,17207,
+17384,17574,17764,17952,18136,18329,18522,18723,18922,19119,19312,19518,19722,19923,20123,20333,
+20542,20750,20958,21169,21374,21587,21805,22012,22229,22450,22666,22878,23101,23320,23534,23755,
+23982,24196,24421,24644,24869,25092,25316,25543,25773,26001,26227,26456,26682,26906,27141,27364,
+27594,27826,28061,28290,28522,28757,28990,29223,29454,29686,29925,30160,30391,30624,30859,31096,
+31337,31574,31809,32047,32279,32523,32755,32993,33233,33477,33709,33950,34189,34434,34669,34913,
+12291,12298,12299,12319,12334,12363,12392,12426,12459,12502,12560,12614,12675,12738,12807,12877,
+12956,13044,13126,13222,13313,13415,13525,13635,13746,13861,13981,14105,14226,14357,14492,14631,
+14771,14914,15066,15217,15367,15522,15674,15840,16004,16169,16336,16500,16677,16849,17027,17198,
+17378,17567,17746,17930,18125,18307,18498,18695,18889,19077,19277,19480,19679,19879,20076,20279,
+20488,20687,20891,21101,21315,21524,21735,21943,22159,22374,22581,22796,23022,23237,23447,23672,
+23891,24113,24328,24554,24775,24998,25219,25446,25664,25889,26119,26340,26572,26800,27027,27250,
+27484,27708,27943,28168,28397,28633,28866,29098,29327,29564,29796,30029,30264,30492,30725,30966,
+31201,31437,31673,31909,32144,32381,32612,32849,33086,33327,33564,33809,34041,34280,34520,34765,
+34998,12546,12554,12560,12573,12590,12618,12639,12675,12712,12762,12812,12865,12924,12978,13052,
+13121,13196,13281,13372,13460,13556,13650,13757,13863,13975,14089,14202,14328,14448,14582,14709,
+14849,14985,15125,15276,15416,15569,15727,15880,16039,16194,16358,16530,16696,16861,17040,17214,
+17383,17567,17742,17925,18112,18298,18485,18675,18864,19056,19250,19439,19633,19840,20037,20237,
+20432,20642,20845,21044,21251,21459,21671,21876,22091,22295,22513,22726,22940,23149,23369,23585,
+23806,24025,24241,24457,24678,24904,25123,25346,25567,25791,26018,26241,26460,26685,26913,27139,
+27371,27595,27821,28053,28285,28515,28744,28970,29202,29441,29664,29902,30136,30363,30596,30828,
+31063,31297,31540,31773,32004,32237,32473,32716,32948,33191,33421,33664,33902,34134,34378,34616,
+34856,35088,12802,12810,12811,12824,12849,12865,12894,12929,12965,13014,13055,13106,13166,13233,
+13295,13365,13439,13522,13612,13695,13789,13892,13991,14091,14206,14312,14436,14555,14671,14803,
+14935,15061,15201,15345,15480,15626,15779,15933,16084,16242,16393,16554,16724,16890,17050,17222,
+17401,17569,17744,17923,18108,18286,18468,18654,18847,19038,19221,19419,19611,19799,19996,20195,
+20398,20597,20798,20998,21199,21403,21609,21816,22025,22238,22448,22657,22869,23081,23289,23506,
+23725,23937,24155,24372,24591,24808,25032,25248,25469,25695,25916,26141,26362,26584,26808,27033,
+27265,27490,27712,27939,28167,28401,28630,28852,29083,29313,29549,29772,30011,30243,30476,30707,
+30942,31172,31402,31635,31869,32110,32339,32580,32815,33046,33283,33517,33755,33991,34228,34464,
+34705,34949,35186,13063,13066,13074,13086,13106,13127,13154,13185,13224,13259,13313,13358,13414,
+13475,13541,13616,13685,13772,13848,13942,14031,14120,14219,14329,14430,14541,14655,14774,14901,
+15022,15148,15285,15414,15555,15699,15844,15984,16137,16282,16443,16601,16758,16918,17080,17245,
+17420,17582,17756,17932,18113,18291,18465,18649,18837,19022,19203,19397,19583,19773,19966,20166,
+20356,20555,20758,20951,21158,21361,21564,21768,21974,22173,22385,22589,22799,23008,23226,23433,
+23645,23863,24073,24288,24506,24729,24947,25165,25383,25599,25818,26046,26269,26483,26707,26935,
+27161,27379,27605,27832,28062,28285,28515,28740,28968,29197,29431,29661,29888,30114,30351,30584,
+30815,31047,31280,31507,31745,31979,32212,32446,32678,32916,33145,33386,33617,33857,34094,34331,
+34569,34804,35042,35281,13315,13323,13330,13333,13360,13383,13403,13440,13470,13512,13563,13614,
+13669,13729,13791,13862,13935,14011,14097,14181,14264,14359,14462,14563,14668,14771,14884,15007,
+15120,15251,15370,15500,15639,15772,15913,16049,16200,16345,16497,16647,16801,16952,17120,17273,
+17439,17606,17782,17944,18122,18294,18469,18652,18827,19017,19198,19384,19566,19759,19944,20134,
+20333,20522,20716,20916,21113,21313,21513,21712,21921,22124,22331,22536,22744,22945,23162,23371,
+23580,23788,24000,24217,24427,24641,24862,25081,25298,25512,25737,25955,26170,26394,26617,26839,
+27062,27278,27507,27735,27959,28183,28404,28634,28860,29089,29318,29545,29769,30003,30227,30457,
+30686,30923,31151,31387,31613,31850,32078,32318,32551,32784,33019,33251,33488,33721,33953,34193,
+34423,34666,34902,35138,35374,13570,13579,13579,13596,13613,13637,13662,13694,13724,13769,13808,
+13865,13915,13978,14040,14108,14173,14257,14338,14420,14505,14596,14697,14797,14901,15007,15115,
+15234,15346,15472,15599,15726,15849,15984,16130,16262,16409,16556,16703,16853,17001,17161,17313,
+17479,17637,17801,17968,18142,18313,18485,18660,18837,19008,19189,19372,19555,19740,19933,20120,
+20306,20495,20694,20887,21076,21273,21479,21670,21877,22071,22282,22485,22683,22894,23098,23303,
+23516,23727,23931,24149,24360,24573,24781,25002,25215,25429,25646,25868,26083,26306,26519,26745,
+26966,27181,27410,27632,27854,28081,28304,28525,28754,28975,29203,29434,29661,29890,30117,30347,
+30575,30804,31035,31265,31490,31729,31953,32185,32419,32656,32883,33122,33349,33590,33819,34060,
+34293,34523,34760,34995,35232,35473,13826,13828,13841,13847,13868,13887,13912,13941,13984,14022,
+14066,14107,14170,14228,14282,14349,14420,14499,14581,14662,14751,14839,14930,15033,15129,15240,
+15351,15462,15574,15698,15822,15942,16075,16202,16342,16483,16623,16766,16907,17059,17212,17360,
+17521,17672,17833,18002,18161,18329,18498,18667,18847,19016,19197,19371,19556,19735,19922,20108,
+20294,20482,20672,20857,21050,21250,21437,21634,21839,22037,22236,22432,22640,22841,23047,23251,
+23458,23662,23869,24078,24287,24502,24710,24928,25141,25355,25570,25789,25999,26223,26434,26652,
+26876,27097,27317,27539,27759,27976,28205,28427,28648,28873,29097,29327,29553,29774,30006,30229,
+30457,30689,30919,31145,31377,31602,31832,32063,32302,32532,32758,32996,33224,33462,33696,33922,
+34157,34390,34626,34859,35095,35336,35572,14082,14085,14097,14108,14117,14140,14167,14195,14230,
+14276,14320,14362,14420,14468,14530,14597,14672,14745,14822,14904,14992,15079,15167,15270,15365,
+15466,15574,15687,15801,15917,16039,16171,16296,16428,16560,16693,16830,16972,17116,17261,17420,
+17564,17725,17879,18037,18193,18363,18524,18695,18864,19028,19209,19377,19560,19733,19918,20098,
+20279,20470,20657,20843,21034,21224,21417,21609,21805,22000,22193,22392,22592,22796,22994,23201,
+23400,23610,23809,24019,24228,24438,24643,24856,25066,25282,25497,25710,25924,26134,26353,26570,
+26793,27009,27224,27447,27662,27883,28109,28333,28548,28776,28998,29219,29449,29674,29894,30125,
+30345,30578,30799,31035,31262,31487,31719,31951,32180,32410,32641,32865,33101,33332,33562,33795,
+34035,34266,34494,34733,34968,35201,35438,35672,14343,14347,14346,14357,14372,14396,14425,14450,
+14490,14527,14564,14612,14671,14718,14778,14843,14911,14982,15065,15147,15225,15319,15405,15500,
+15604,15702,15814,15923,16035,16152,16265,16394,16513,16646,16772,16906,17052,17192,17332,17478,
+17618,17775,17921,18077,18233,18393,18553,18723,18890,19056,19221,19397,19571,19741,19922,20094,
+20280,20464,20642,20832,21018,21202,21389,21585,21777,21970,22160,22360,22554,22757,22952,23155,
+23352,23556,23759,23969,24168,24373,24584,24793,25006,25216,25426,25632,25851,26063,26278,26493,
+26706,26922,27143,27354,27574,27798,28017,28233,28460,28681,28898,29120,29348,29565,29796,30015,
+30245,30465,30692,30918,31145,31371,31602,31829,32064,32286,32517,32752,32982,33206,33438,33676,
+33902,34140,34372,34600,34839,35072,35306,35538,35773,14600,14597,14603,14619,14635,14656,14679,
+14709,14739,14776,14816,14867,14920,14974,15034,15090,15158,15234,15303,15385,15472,15554,15650,
+15742,15835,15942,16040,16156,16259,16379,16491,16612,16741,16868,16997,17130,17265,17405,17541,
+17684,17833,17982,18128,18287,18435,18600,18758,18913,19085,19250,19416,19581,19753,19930,20109,
+20279,20461,20637,20822,21003,21188,21375,21563,21751,21948,22139,22328,22526,22717,22920,23110,
+23316,23517,23711,23915,24124,24322,24532,24738,24940,25152,25356,25571,25777,25995,26201,26419,
+26627,26841,27057,27275,27490,27714,27927,28145,28369,28586,28805,29025,29245,29474,29691,29915,
+30142,30368,30592,30812,31042,31269,31491,31717,31949,32174,32407,32637,32859,33089,33319,33551,
+33784,34010,34249,34474,34714,34938,35171,35411,35644,35879,14856,14852,14866,14874,14889,14906,
+14935,14957,14990,15032,15074,15113,15165,15223,15282,15344,15410,15475,15554,15630,15707,15798,
+15888,15974,16076,16169,16279,16386,16489,16602,16718,16843,16958,17090,17219,17349,17483,17616,
+17754,17900,18039,18186,18339,18491,18645,18793,18952,19118,19282,19439,19606,19778,19944,20120,
+20294,20470,20640,20818,21004,21185,21366,21551,21742,21930,22117,22308,22500,22688,22887,23076,
+23273,23473,23676,23872,24078,24278,24478,24680,24891,25095,25304,25505,25719,25924,26133,26348,
+26563,26768,26987,27196,27411,27631,27849,28067,28279,28501,28717,28941,29161,29377,29601,29823,
+30039,30267,30485,30718,30936,31161,31391,31617,31843,32067,32290,32517,32752,32979,33204,33436,
+33662,33897,34120,34357,34588,34816,35053,35281,35517,35748,35983,15112,15109,15119,15125,15146,
+15161,15184,15217,15243,15280,15319,15371,15419,15471,15532,15587,15658,15720,15798,15869,15951,
+16034,16129,16212,16314,16412,16506,16612,16722,16837,16945,17064,17191,17314,17434,17561,17701,
+17830,17975,18114,18255,18402,18547,18694,18844,19003,19160,19318,19472,19643,19801,19967,20137,
+20305,20481,20655,20825,21002,21180,21362,21544,21734,21913,22100,22290,22476,22666,22864,23048,
+23248,23438,23639,23838,24036,24230,24437,24636,24836,25044,25242,25455,25655,25864,26070,26281,
+26490,26706,26913,27130,27338,27556,27770,27979,28197,28414,28631,28856,29072,29285,29511,29732,
+29952,30167,30396,30612,30841,31057,31288,31512,31737,31957,32184,32414,32637,32861,33094,33319,
+33547,33781,34009,34241,34463,34692,34923,35156,35393,35621,35850,36084,15362,15364,15370,15379,
+15401,15417,15446,15472,15497,15535,15574,15617,15666,15719,15779,15841,15904,15971,16038,16113,
+16195,16282,16368,16452,16553,16647,16740,16844,16958,17069,17174,17290,17416,17537,17663,17782,
+17921,18053,18187,18328,18468,18612,18756,18899,19051,19201,19363,19514,19676,19838,19997,20165,
+20333,20497,20671,20845,21016,21188,21364,21546,21728,21911,22097,22275,22462,22655,22844,23031,
+23217,23410,23609,23799,23999,24192,24397,24596,24790,24995,25195,25398,25608,25805,26017,26225,
+26434,26641,26845,27062,27273,27486,27696,27904,28126,28339,28550,28775,28989,29206,29426,29637,
+29862,30075,30298,30518,30740,30967,31188,31407,31629,31855,32084,32309,32534,32762,32986,33208,
+33436,33661,33896,34119,34353,34583,34811,35036,35265,35501,35731,35962,36198,15618,15626,15626,
+15637,15649,15677,15699,15719,15757,15786,15827,15875,15922,15976,16025,16083,16151,16213,16282,
+16357,16435,16523,16607,16698,16783,16885,16977,17079,17183,17294,17409,17525,17641,17756,17885,
+18006,18134,18265,18399,18543,18682,18818,18968,19108,19257,19414,19560,19721,19872,20038,20192,
+20358,20522,20694,20858,21033,21200,21380,21550,21731,21912,22086,22268,22450,22640,22825,23009,
+23197,23393,23583,23776,23964,24163,24359,24559,24752,24950,25154,25356,25554,25757,25960,26165,
+26375,26580,26787,27000,27204,27413,27629,27840,28048,28265,28479,28689,28907,29122,29344,29559,
+29770,29989,30215,30426,30649,30872,31088,31317,31533,31760,31983,32201,32427,32652,32883,33106,
+33333,33554,33782,34008,34233,34463,34696,34926,35148,35379,35614,35844,36073,36305,15880,15877,
+15887,15897,15911,15928,15948,15982,16011,16041,16084,16122,16168,16225,16280,16332,16399,16466,
+16535,16607,16684,16761,16851,16936,17028,17115,17219,17312,17417,17529,17636,17747,17862,17980,
+18108,18229,18360,18491,18617,18753,18891,19037,19171,19324,19466,19618,19764,19924,20073,20238,
+20396,20554,20719,20889,21051,21224,21389,21562,21740,21913,22087,22269,22448,22636,22818,22998,
+23187,23377,23564,23748,23940,24139,24326,24525,24721,24919,25117,25310,25517,25711,25915,26121,
+26324,26528,26729,26934,27145,27356,27564,27769,27981,28189,28409,28619,28833,29041,29263,29471,
+29690,29907,30129,30343,30564,30785,30998,31220,31438,31660,31887,32104,32331,32555,32773,33005,
+33222,33453,33674,33904,34131,34354,34584,34814,35035,35264,35499,35722,35952,36185,36417,16135,
+16132,16144,16154,16167,16188,16205,16230,16265,16294,16338,16373,16419,16476,16530,16581,16648,
+16715,16774,16846,16922,17009,17091,17178,17265,17351,17449,17554,17650,17756,17873,17975,18091,
+18209,18328,18453,18577,18705,18835,18974,19110,19245,19391,19529,19674,19820,19979,20124,20277,
+20435,20597,20757,20912,21080,21250,21416,21585,21752,21929,22097,22273,22453,22630,22815,22997,
+23175,23360,23545,23733,23920,24112,24306,24499,24692,24882,25077,25271,25477,25676,25870,26071,
+26270,26474,26682,26883,27092,27297,27499,27713,27923,28130,28334,28545,28766,28970,29188,29403,
+29610,29831,30050,30261,30476,30694,30918,31135,31354,31573,31789,32017,32236,32460,32682,32905,
+33128,33343,33570,33794,34020,34250,34473,34698,34925,35157,35382,35609,35841,36071,36299,36531,
+16392,16394,16394,16410,16418,16437,16459,16485,16520,16548,16591,16633,16669,16725,16773,16828,
+16896,16959,17027,17098,17168,17243,17326,17418,17507,17592,17694,17789,17885,17989,18100,18207,
+18319,18442,18553,18680,18805,18930,19053,19187,19327,19461,19599,19747,19884,20035,20179,20335,
+20486,20642,20798,20951,21112,21276,21445,21609,21777,21948,22117,22289,22459,22638,22814,22992,
+23176,23355,23537,23727,23911,24096,24288,24478,24667,24856,25049,25244,25436,25638,25838,26030,
+26236,26435,26631,26834,27043,27244,27450,27651,27860,28070,28274,28485,28696,28907,29112,29326,
+29543,29751,29970,30187,30394,30613,30831,31046,31262,31487,31707,31925,32146,32361,32583,32803,
+33030,33253,33472,33694,33924,34148,34374,34592,34817,35044,35271,35498,35725,35959,36180,36409,
+36643,16648,16651,16656,16667,16670,16693,16721,16737,16767,16805,16843,16877,16922,16972,17029,
+17080,17145,17208,17272,17338,17410,17488,17577,17653,17747,17830,17925,18021,18119,18229,18334,
+18444,18549,18664,18788,18900,19030,19155,19282,19407,19546,19673,19815,19959,20101,20243,20392,
+20540,20687,20846,20995,21157,21310,21478,21636,21806,21972,22138,22307,22474,22652,22829,22998,
+23176,23354,23534,23717,23898,24088,24268,24457,24645,24839,25029,25217,25415,25603,25803,25998,
+26193,26397,26595,26790,26989,27197,27395,27605,27808,28010,28219,28428,28636,28838,29049,29259,
+29473,29687,29893,30107,30320,30534,30748,30963,31188,31399,31622,31835,32057,32277,32491,32712,
+32932,33153,33380,33598,33819,34046,34266,34497,34714,34946,35165,35394,35617,35848,36069,36297,
+36525,36757,16904,16901,16904,16913,16927,16949,16973,16998,17027,17059,17089,17132,17176,17227,
+17282,17334,17387,17449,17520,17590,17660,17737,17814,17902,17988,18069,18161,18264,18355,18462,
+18559,18668,18780,18897,19009,19125,19247,19378,19504,19626,19764,19893,20035,20168,20314,20457,
+20597,20748,20897,21047,21200,21353,21512,21673,21837,22001,22160,22326,22499,22665,22835,23014,
+23190,23360,23538,23716,23901,24085,24266,24447,24630,24820,25006,25200,25386,25579,25774,25962,
+26164,26353,26554,26755,26949,27149,27354,27550,27753,27962,28163,28372,28571,28781,28993,29196,
+29405,29621,29831,30045,30249,30466,30674,30889,31102,31323,31541,31752,31969,32190,32410,32628,
+32847,33061,33283,33503,33729,33950,34169,34390,34613,34837,35062,35288,35513,35738,35969,36189,
+36415,36648,36874,17160,17163,17160,17170,17190,17200,17224,17253,17275,17307,17344,17384,17426,
+17479,17531,17584,17638,17704,17759,17830,17901,17977,18059,18142,18222,18315,18400,18500,18593,
+18691,18801,18905,19016,19126,19234,19360,19479,19598,19720,19846,19984,20109,20246,20384,20522,
+20668,20814,20958,21103,21252,21404,21564,21721,21876,22035,22193,22362,22527,22689,22861,23033,
+23199,23370,23547,23728,23900,24084,24263,24440,24627,24812,24994,25186,25368,25558,25747,25938,
+26132,26325,26524,26715,26921,27116,27315,27515,27711,27916,28112,28317,28526,28724,28934,29142,
+29346,29553,29762,29975,30182,30391,30610,30816,31036,31244,31457,31676,31887,32109,32329,32545,
+32757,32975,33200,33413,33633,33859,34075,34301,34524,34741,34962,35186,35408,35640,35865,36089,
+36310,36540,36760,36993,17416,17409,17416,17432,17445,17462,17485,17502,17530,17567,17602,17636,
+17684,17724,17783,17834,17890,17944,18009,18083,18153,18220,18303,18385,18468,18549,18645,18737,
+18827,18931,19034,19133,19240,19351,19464,19580,19698,19819,19943,20070,20202,20334,20463,20597,
+20738,20877,21024,21165,21315,21458,21610,21767,21921,22074,22236,22391,22551,22718,22887,23051,
+23220,23394,23564,23732,23913,24089,24266,24441,24625,24803,24990,25174,25356,25547,25735,25919,
+26115,26304,26493,26689,26885,27076,27272,27476,27669,27874,28074,28274,28479,28675,28883,29083,
+29287,29499,29703,29910,30123,30327,30538,30753,30961,31177,31384,31598,31817,32024,32245,32466,
+32674,32896,33113,33333,33546,33770,33989,34211,34423,34646,34868,35095,35311,35535,35762,35985,
+36212,36431,36662,36888,37107,17672,17666,17678,17681,17701,17710,17739,17757,17792,17821,17851,
+17887,17938,17977,18025,18084,18134,18194,18261,18329,18393,18472,18547,18623,18710,18788,18877,
+18975,19071,19163,19268,19367,19472,19587,19692,19812,19926,20045,20166,20293,20424,20551,20686,
+20819,20958,21098,21233,21376,21525,21673,21815,21975,22126,22281,22433,22590,22755,22917,23079,
+23244,23415,23580,23755,23922,24095,24271,24444,24628,24803,24982,25169,25345,25532,25721,25910,
+26091,26282,26474,26668,26854,27052,27247,27436,27631,27837,28029,28228,28429,28628,28837,29033,
+29237,29443,29648,29852,30060,30267,30476,30689,30898,31105,31320,31527,31744,31950,32172,32384,
+32595,32814,33029,33245,33466,33677,33902,34121,34339,34558,34781,35001,35216,35443,35666,35883,
+36111,36328,36560,36783,37008,37233,17927,17927,17930,17937,17951,17971,17989,18019,18039,18069,
+18110,18148,18181,18234,18281,18329,18390,18449,18504,18577,18638,18709,18785,18869,18947,19032,
+19124,19207,19309,19405,19504,19600,19711,19818,19930,20037,20157,20277,20398,20515,20640,20769,
+20905,21032,21171,21307,21445,21587,21731,21876,22023,22174,22326,22484,22639,22796,22951,23113,
+23276,23445,23611,23776,23942,24110,24287,24456,24638,24813,24989,25168,25349,25533,25714,25899,
+26077,26267,26459,26649,26832,27023,27216,27408,27609,27803,27998,28193,28396,28586,28788,28995,
+29189,29399,29596,29805,30006,30216,30422,30629,30834,31046,31255,31464,31670,31889,32095,32307,
+32526,32736,32947,33168,33388,33598,33815,34032,34249,34467,34692,34911,35131,35351,35574,35792,
+36014,36238,36455,36679,36905,37132,37350,18183,18178,18184,18199,18205,18227,18250,18272,18294,
+18329,18359,18394,18435,18479,18528,18585,18641,18698,18758,18815,18890,18962,19029,19106,19190,
+19278,19360,19453,19540,19634,19735,19835,19943,20051,20160,20270,20386,20499,20618,20744,20869,
+20995,21123,21251,21389,21520,21665,21800,21941,22091,22234,22386,22538,22683,22843,22993,23158,
+23315,23470,23641,23799,23965,24132,24307,24477,24645,24817,24993,25174,25353,25531,25711,25889,
+26075,26262,26440,26628,26820,27003,27192,27389,27581,27770,27968,28163,28359,28552,28755,28954,
+29154,29352,29554,29757,29961,30159,30365,30568,30780,30982,31194,31399,31609,31817,32027,32243,
+32450,32661,32879,33090,33308,33517,33733,33953,34171,34384,34607,34821,35043,35257,35482,35703,
+35922,36140,36359,36588,36802,37025,37254,37478,18434,18434,18446,18454,18462,18476,18505,18527,
+18553,18584,18609,18648,18694,18732,18778,18831,18890,18944,19000,19070,19132,19202,19280,19350,
+19438,19521,19604,19694,19784,19880,19974,20075,20177,20282,20389,20498,20610,20731,20848,20968,
+21093,21213,21340,21476,21607,21737,21877,22014,22160,22306,22448,22594,22743,22895,23047,23203,
+23353,23509,23675,23837,24000,24166,24327,24493,24668,24839,25007,25183,25360,25531,25714,25894,
+26073,26252,26433,26623,26808,26995,27178,27370,27555,27752,27938,28133,28322,28518,28714,28915,
+29116,29308,29514,29714,29914,30112,30314,30517,30728,30926,31136,31342,31547,31755,31969,32174,
+32382,32595,32812,33023,33231,33449,33657,33876,34091,34301,34527,34744,34960,35170,35394,35608,
+35833,36051,36267,36489,36715,36931,37159,37381,37598,18690,18689,18696,18705,18717,18731,18753,
+18781,18808,18831,18863,18901,18941,18984,19036,19087,19139,19189,19255,19311,19377,19447,19518,
+19601,19677,19761,19841,19928,20022,20115,20208,20306,20406,20515,20622,20733,20841,20959,21075,
+21191,21316,21436,21562,21692,21827,21960,22094,22228,22372,22515,22659,22799,22952,23095,23254,
+23401,23561,23717,23871,24036,24191,24362,24525,24693,24860,25030,25200,25369,25546,25721,25893,
+26075,26250,26436,26614,26800,26978,27165,27353,27543,27728,27917,28112,28299,28497,28691,28883,
+29075,29277,29471,29668,29871,30072,30274,30469,30678,30883,31080,31291,31496,31697,31910,32112,
+32326,32531,32744,32950,33161,33378,33590,33797,34019,34226,34445,34656,34878,35090,35307,35525,
+35742,35966,36186,36398,36620,36845,37059,37281,37501,37731,18952,18951,18958,18966,18974,18987,
+19009,19037,19059,19084,19118,19161,19198,19242,19287,19329,19385,19440,19498,19559,19631,19694,
+19771,19844,19916,19999,20087,20169,20257,20353,20444,20542,20645,20749,20856,20956,21074,21186,
+21304,21420,21541,21666,21789,21912,22048,22178,22307,22442,22583,22729,22869,23011,23161,23305,
+23459,23611,23759,23915,24071,24235,24389,24557,24716,24882,25049,25215,25386,25556,25728,25907,
+26080,26261,26433,26612,26792,26976,27156,27345,27532,27720,27901,28089,28277,28468,28668,28854,
+29052,29245,29440,29631,29837,30029,30228,30433,30629,30830,31032,31240,31438,31643,31852,32054,
+32269,32470,32684,32891,33100,33312,33522,33735,33941,34153,34365,34581,34794,35015,35224,35444,
+35664,35877,36099,36318,36531,36755,36968,37196,37410,37632,37853,19207,19208,19209,19221,19228,
+19251,19265,19287,19316,19340,19372,19414,19446,19487,19539,19587,19640,19690,19752,19815,19878,
+19945,20010,20084,20164,20247,20330,20414,20497,20587,20689,20778,20876,20983,21086,21190,21301,
+21414,21525,21644,21768,21888,22007,22135,22267,22399,22530,22665,22799,22941,23083,23224,23366,
+23518,23660,23813,23963,24123,24277,24435,24594,24750,24915,25077,25242,25414,25576,25753,25918,
+26097,26264,26442,26621,26799,26974,27155,27339,27520,27708,27888,28081,28266,28450,28645,28830,
+29021,29214,29408,29607,29797,29993,30191,30394,30593,30788,30986,31193,31391,31598,31801,32008,
+32206,32418,32618,32826,33036,33249,33452,33667,33878,34089,34296,34513,34725,34932,35155,35365,
+35580,35797,36019,36231,36447,36665,36888,37105,37319,37539,37766,37982,19464,19464,19464,19473,
+19484,19501,19526,19539,19565,19600,19623,19668,19705,19745,19791,19838,19891,19943,19997,20058,
+20125,20192,20256,20328,20404,20486,20571,20655,20743,20829,20917,21019,21113,21216,21321,21421,
+21539,21647,21759,21877,21989,22108,22239,22362,22490,22616,22744,22878,23011,23153,23299,23433,
+23581,23727,23869,24018,24175,24322,24476,24639,24792,24950,25109,25275,25440,25604,25776,25941,
+26113,26281,26458,26624,26802,26986,27162,27335,27521,27706,27887,28071,28256,28434,28624,28812,
+29001,29198,29388,29581,29769,29966,30158,30353,30552,30750,30952,31147,31354,31547,31757,31953,
+32163,32360,32571,32770,32982,33190,33392,33605,33813,34024,34230,34446,34652,34869,35076,35294,
+35507,35716,35937,36147,36366,36583,36799,37017,37234,37452,37673,37897,38117,19720,19715,19720,
+19729,19739,19759,19781,19800,19819,19855,19880,19920,19954,19993,20038,20084,20135,20194,20251,
+20305,20372,20439,20506,20578,20653,20726,20810,20897,20985,21071,21162,21252,21354,21453,21550,
+21653,21761,21877,21985,22099,22219,22341,22454,22581,22703,22838,22969,23101,23235,23369,23506,
+23646,23788,23939,24084,24226,24384,24534,24687,24835,24998,25155,25309,25469,25639,25805,25970,
+26133,26306,26476,26640,26819,26993,27165,27346,27519,27705,27883,28060,28243,28432,28618,28802,
+28985,29178,29367,29552,29749,29942,30130,30322,30524,30720,30910,31110,31309,31507,31707,31908,
+32113,32311,32515,32719,32929,33133,33338,33548,33755,33963,34171,34381,34590,34796,35011,35219,
+35436,35643,35861,36076,36285,36501,36726,36941,37154,37367,37591,37806,38028,38247,19975,19970,
+19978,19985,20001,20010,20035,20056,20080,20107,20139,20169,20209,20245,20293,20342,20392,20438,
+20500,20554,20616,20685,20749,20818,20898,20974,21052,21141,21217,21306,21396,21493,21586,21684,
+21787,21893,21998,22105,22215,22326,22445,22566,22680,22803,22934,23053,23188,23318,23455,23588,
+23725,23865,24001,24147,24290,24441,24583,24735,24891,25044,25193,25355,25516,25667,25834,25999,
+26159,26326,26493,26668,26833,27005,27176,27350,27526,27708,27885,28061,28245,28423,28611,28794,
+28974,29160,29347,29540,29724,29915,30104,30299,30496,30683,30884,31079,31270,31470,31674,31867,
+32067,32273,32468,32676,32879,33084,33283,33492,33698,33904,34112,34319,34524,34738,34941,35153,
+35363,35574,35787,36003,36212,36426,36640,36855,37076,37290,37505,37723,37944,38162,38375,20226,
+20227,20237,20239,20252,20266,20283,20306,20336,20363,20392,20420,20458,20497,20541,20593,20634,
+20690,20749,20803,20871,20928,21001,21071,21142,21220,21296,21381,21459,21551,21639,21732,21829,
+21927,22020,22128,22227,22334,22445,22558,22672,22789,22910,23033,23151,23281,23410,23535,23667,
+23804,23940,24075,24221,24361,24506,24650,24792,24945,25092,25244,25398,25552,25711,25873,26035,
+26191,26357,26525,26692,26853,27023,27195,27371,27544,27717,27890,28070,28248,28423,28607,28790,
+28968,29157,29337,29521,29715,29897,30092,30276,30467,30660,30852,31046,31246,31434,31632,31831,
+32033,32226,32433,32627,32834,33030,33237,33442,33639,33848,34050,34258,34471,34678,34885,35088,
+35305,35513,35719,35929,36147,36358,36571,36784,37001,37208,37424,37638,37857,38075,38298,38509,
+20488,20487,20489,20495,20507,20522,20539,20566,20592,20617,20642,20673,20712,20749,20798,20837,
+20888,20940,20994,21052,21111,21182,21242,21312,21388,21464,21534,21624,21700,21792,21881,21971,
+22061,22156,22260,22362,22458,22570,22682,22786,22904,23022,23133,23258,23380,23504,23625,23755,
+23891,24021,24152,24292,24429,24574,24712,24856,25006,25153,25302,25448,25601,25756,25911,26069,
+26229,26388,26550,26717,26885,27053,27215,27388,27555,27727,27906,28077,28256,28432,28610,28784,
+28964,29152,29328,29519,29704,29884,30077,30265,30455,30637,30833,31021,31212,31412,31606,31799,
+31991,32196,32393,32586,32792,32991,33188,33393,33593,33800,34003,34204,34407,34612,34818,35036,
+35238,35450,35660,35869,36081,36285,36497,36709,36922,37135,37349,37569,37780,37998,38213,38434,
+38649,20738,20744,20750,20752,20763,20775,20798,20822,20839,20867,20896,20934,20972,21008,21050,
+21091,21138,21190,21250,21302,21367,21426,21494,21557,21629,21708,21785,21867,21947,22026,22120,
+22210,22303,22398,22495,22590,22699,22803,22912,23023,23135,23243,23360,23478,23605,23724,23847,
+23981,24103,24243,24369,24511,24645,24788,24930,25067,25215,25360,25507,25657,25809,25961,26116,
+26272,26429,26595,26755,26921,27077,27246,27408,27580,27747,27922,28088,28266,28444,28617,28793,
+28965,29151,29327,29514,29695,29880,30068,30252,30437,30621,30814,30999,31189,31383,31579,31773,
+31963,32156,32358,32557,32755,32952,33150,33346,33547,33754,33951,34153,34358,34562,34771,34977,
+35184,35387,35599,35807,36010,36226,36430,36641,36851,37069,37282,37490,37708,37923,38138,38352,
+38566,38782,20994,20999,21005,21009,21024,21032,21048,21077,21100,21125,21154,21183,21218,21255,
+21301,21348,21394,21446,21498,21550,21614,21671,21740,21805,21879,21949,22023,22100,22185,22274,
+22362,22450,22539,22631,22731,22833,22934,23030,23138,23253,23358,23476,23586,23710,23829,23952,
+24072,24205,24325,24457,24588,24726,24856,25003,25144,25279,25428,25568,25720,25862,26020,26166,
+26320,26474,26631,26790,26948,27114,27280,27439,27602,27770,27943,28107,28279,28456,28623,28798,
+28976,29151,29335,29513,29693,29877,30058,30237,30426,30607,30794,30988,31170,31366,31557,31747,
+31937,32133,32326,32517,32714,32914,33114,33312,33511,33706,33913,34108,34317,34518,34721,34924,
+35130,35331,35542,35744,35952,36159,36372,36578,36787,36996,37206,37425,37633,37851,38063,38278,
+38493,38702,38921,21254,21251,21256,21268,21275,21293,21304,21329,21355,21376,21409,21436,21471,
+21511,21555,21595,21647,21697,21748,21802,21864,21918,21988,22049,22120,22196,22273,22346,22434,
+22515,22601,22689,22775,22871,22971,23062,23168,23271,23376,23478,23588,23706,23816,23938,24056,
+24175,24300,24420,24554,24676,24807,24944,25081,25219,25352,25492,25641,25779,25929,26077,26225,
+26371,26523,26683,26833,26991,27150,27313,27475,27640,27803,27963,28137,28304,28475,28644,28811,
+28986,29161,29336,29516,29697,29870,30051,30238,30420,30600,30783,30975,31162,31350,31532,31721,
+31912,32107,32302,32489,32682,32885,33074,33275,33469,33674,33867,34072,34266,34471,34671,34877,
+35080,35278,35490,35688,35895,36099,36314,36521,36724,36940,37149,37360,37565,37783,37991,38205,
+38418,38630,38847,39055,21507,21513,21513,21524,21531,21543,21564,21587,21609,21634,21664,21694,
+21725,21767,21808,21845,21892,21939,22000,22048,22107,22167,22236,22302,22366,22437,22518,22590,
+22675,22757,22838,22924,23013,23106,23201,23303,23402,23504,23609,23712,23826,23937,24048,24164,
+24279,24401,24519,24643,24774,24900,25032,25163,25292,25427,25568,25710,25853,25989,26140,26286,
+26432,26576,26729,26882,27042,27195,27355,27507,27668,27829,27999,28157,28331,28498,28658,28835,
+29006,29179,29346,29522,29703,29881,30053,30238,30417,30596,30782,30967,31150,31330,31525,31707,
+31898,32089,32275,32465,32663,32851,33043,33240,33441,33631,33830,34027,34233,34426,34631,34827,
+35028,35231,35432,35643,35848,36047,36252,36464,36666,36879,37088,37295,37506,37715,37921,38131,
+38351,38559,38774,38986,39196,21768,21766,21772,21775,21793,21805,21821,21843,21858,21882,21912,
+21943,21979,22015,22060,22098,22145,22193,22244,22304,22360,22422,22478,22550,22611,22689,22757,
+22833,22918,22999,23083,23165,23253,23345,23439,23534,23634,23733,23841,23942,24055,24161,24281,
+24393,24506,24627,24745,24873,24998,25123,25246,25384,25510,25646,25785,25922,26066,26204,26351,
+26496,26643,26785,26943,27093,27247,27401,27554,27708,27873,28034,28195,28355,28526,28685,28852,
+29022,29197,29368,29534,29709,29890,30068,30237,30415,30600,30779,30963,31139,31325,31512,31693,
+31886,32067,32257,32451,32637,32832,33025,33210,33406,33605,33800,33992,34196,34389,34591,34785,
+34986,35185,35393,35597,35793,36001,36199,36404,36609,36816,37025,37237,37440,37652,37862,38072,
+38284,38487,38700,38917,39123,39341,22018,22023,22025,22032,22048,22055,22077,22098,22119,22143,
+22172,22199,22229,22268,22308,22355,22396,22443,22497,22550,22606,22665,22732,22795,22861,22928,
+23005,23081,23154,23236,23325,23405,23492,23589,23675,23777,23871,23968,24071,24175,24283,24398,
+24510,24616,24731,24855,24976,25095,25220,25344,25469,25602,25736,25868,26003,26137,26275,26420,
+26561,26700,26853,26993,27141,27298,27450,27599,27759,27910,28074,28234,28392,28556,28716,28885,
+29046,29213,29389,29554,29729,29902,30074,30253,30428,30604,30782,30961,31136,31320,31502,31686,
+31870,32055,32242,32429,32617,32808,32998,33188,33387,33573,33768,33966,34161,34357,34556,34747,
+34952,35144,35351,35544,35753,35949,36151,36354,36557,36764,36974,37178,37380,37588,37802,38010,
+38219,38422,38632,38844,39060,39267,39477,22278,22275,22287,22293,22295,22314,22326,22349,22372,
+22392,22422,22456,22484,22521,22566,22604,22653,22699,22752,22804,22855,22915,22978,23039,23106,
+23176,23247,23322,23405,23486,23561,23650,23738,23827,23920,24015,24106,24204,24312,24409,24520,
+24621,24738,24848,24961,25081,25200,25321,25442,25570,25696,25824,25954,26080,26213,26349,26490,
+26629,26771,26912,27062,27203,27357,27501,27651,27808,27962,28118,28275,28427,28594,28754,28913,
+29082,29247,29407,29579,29746,29915,30090,30263,30433,30609,30785,30965,31139,31324,31499,31687,
+31863,32053,32232,32415,32608,32791,32980,33169,33357,33556,33748,33934,34132,34327,34517,34718,
+34909,35107,35312,35506,35704,35910,36112,36313,36515,36714,36923,37128,37333,37532,37743,37947,
+38154,38361,38575,38785,38990,39199,39416,39622,22532,22536,22542,22547,22557,22565,22581,22603,
+22627,22649,22675,22711,22743,22782,22819,22853,22904,22946,22999,23054,23104,23162,23229,23285,
+23354,23420,23493,23572,23642,23722,23809,23887,23981,24068,24158,24245,24348,24440,24545,24645,
+24750,24859,24972,25076,25194,25304,25429,25542,25664,25792,25917,26039,26168,26300,26437,26567,
+26706,26850,26989,27132,27269,27414,27561,27708,27865,28008,28161,28317,28470,28630,28788,28947,
+29108,29279,29443,29607,29768,29942,30111,30282,30446,30626,30799,30970,31151,31322,31501,31680,
+31861,32045,32226,32410,32594,32783,32972,33152,33344,33536,33720,33915,34103,34300,34494,34686,
+34882,35079,35275,35468,35671,35865,36070,36269,36470,36667,36876,37072,37281,37483,37685,37894,
+38095,38305,38510,38723,38932,39139,39345,39556,39771,22792,22792,22790,22799,22812,22826,22841,
+22858,22878,22903,22930,22958,22992,23028,23067,23105,23158,23198,23251,23300,23359,23410,23478,
+23535,23597,23673,23739,23809,23887,23964,24045,24130,24220,24302,24394,24484,24586,24676,24782,
+24877,24981,25093,25194,25305,25419,25537,25650,25774,25888,26009,26140,26260,26394,26521,26652,
+26785,26920,27060,27198,27337,27486,27630,27770,27916,28070,28223,28373,28527,28676,28835,28988,
+29151,29308,29474,29633,29797,29964,30134,30298,30472,30643,30809,30986,31155,31332,31509,31690,
+31869,32042,32223,32412,32592,32778,32955,33145,33329,33522,33703,33898,34086,34272,34462,34661,
+34854,35049,35243,35439,35635,35829,36028,36231,36423,36630,36825,37026,37235,37431,37639,37845,
+38045,38254,38454,38665,38869,39082,39290,39498,39707,39912,23047,23043,23048,23053,23064,23081,
+23099,23113,23138,23156,23189,23213,23250,23286,23317,23360,23404,23450,23503,23551,23611,23660,
+23721,23787,23852,23919,23990,24056,24137,24208,24294,24372,24461,24542,24631,24729,24818,24914,
+25013,25111,25214,25326,25432,25537,25648,25766,25875,25993,26120,26239,26365,26489,26616,26740,
+26871,27007,27142,27278,27413,27557,27698,27841,27979,28130,28274,28427,28575,28730,28884,29040,
+29191,29354,29512,29669,29828,29999,30158,30326,30495,30660,30833,30999,31173,31348,31523,31698,
+31875,32046,32226,32403,32585,32767,32955,33135,33318,33508,33690,33882,34069,34261,34448,34634,
+34829,35019,35212,35410,35605,35800,35991,36189,36393,36591,36784,36991,37189,37389,37595,37792,
+38000,38202,38408,38611,38813,39018,39226,39439,39643,39854,40064,23303,23305,23303,23316,23323,
+23335,23348,23369,23393,23417,23439,23473,23506,23540,23572,23612,23660,23705,23748,23801,23854,
+23916,23976,24030,24095,24162,24234,24307,24375,24452,24536,24614,24698,24782,24878,24966,25059,
+25151,25247,25353,25455,25553,25664,25768,25885,25997,26105,26222,26341,26460,26586,26708,26838,
+26965,27094,27221,27362,27495,27629,27767,27909,28047,28193,28342,28481,28634,28784,28937,29083,
+29239,29392,29555,29713,29873,30027,30195,30359,30524,30691,30852,31023,31191,31365,31532,31705,
+31883,32055,32237,32413,32592,32772,32952,33134,33312,33494,33680,33864,34058,34239,34427,34615,
+34805,35001,35192,35385,35573,35767,35960,36161,36356,36551,36753,36952,37151,37344,37550,37746,
+37947,38156,38352,38556,38759,38971,39175,39375,39586,39796,39999,40207,23555,23561,23560,23567,
+23580,23589,23604,23625,23644,23672,23695,23727,23758,23790,23831,23871,23914,23953,23999,24057,
+24105,24158,24218,24284,24346,24413,24482,24546,24627,24695,24773,24861,24942,25023,25112,25201,
+25293,25388,25491,25588,25686,25793,25898,26003,26114,26225,26333,26454,26572,26688,26807,26935,
+27060,27187,27311,27446,27579,27713,27847,27985,28127,28260,28403,28549,28697,28846,28987,29145,
+29296,29441,29602,29756,29910,30068,30227,30394,30549,30714,30879,31046,31214,31385,31551,31728,
+31895,32068,32241,32423,32594,32769,32953,33134,33308,33492,33674,33856,34042,34227,34411,34600,
+34787,34981,35168,35363,35546,35741,35937,36132,36327,36521,36712,36906,37109,37312,37505,37710,
+37905,38105,38311,38513,38710,38920,39124,39325,39534,39740,39940,40149,40361,23816,23809,23815,
+23827,23830,23847,23863,23880,23899,23927,23951,23982,24007,24044,24078,24123,24166,24209,24256,
+24308,24360,24415,24465,24528,24594,24655,24729,24798,24868,24944,25022,25104,25186,25272,25352,
+25446,25532,25624,25728,25820,25923,26027,26125,26235,26344,26457,26564,26678,26793,26912,27033,
+27159,27280,27409,27537,27662,27798,27925,28061,28201,28340,28480,28621,28758,28907,29049,29197,
+29345,29496,29647,29806,29958,30109,30268,30433,30586,30752,30913,31080,31240,31406,31575,31744,
+31914,32084,32257,32434,32608,32780,32961,33131,33312,33491,33671,33859,34041,34224,34408,34589,
+34778,34963,35150,35343,35533,35723,35914,36107,36298,36487,36688,36876,37078,37275,37469,37672,
+37864,38068,38270,38465,38666,38869,39070,39274,39477,39682,39892,40093,40300,40507,24067,24066,
+24072,24078,24087,24099,24120,24137,24155,24177,24206,24232,24260,24299,24332,24370,24412,24462,
+24508,24557,24611,24659,24721,24779,24839,24907,24970,25040,25111,25190,25267,25345,25428,25507,
+25593,25680,25776,25862,25964,26054,26158,26263,26359,26470,26576,26682,26798,26905,27026,27139,
+27257,27380,27503,27633,27761,27882,28017,28149,28278,28413,28551,28691,28835,28971,29121,29264,
+29406,29554,29708,29859,30009,30165,30314,30471,30627,30790,30946,31114,31278,31439,31605,31767,
+31935,32110,32274,32445,32617,32791,32968,33145,33323,33502,33673,33857,34037,34216,34399,34584,
+34771,34955,35141,35326,35513,35701,35896,36079,36276,36463,36656,36854,37042,37244,37435,37635,
+37829,38032,38224,38428,38623,38824,39025,39225,39430,39637,39836,40044,40249,40450,40656,24322,
+24327,24327,24340,24341,24360,24369,24387,24407,24437,24457,24483,24520,24554,24584,24628,24668,
+24712,24760,24808,24860,24915,24966,25030,25091,25151,25215,25284,25355,25435,25505,25588,25670,
+25749,25838,25925,26009,26106,26203,26292,26396,26496,26598,26697,26804,26921,27024,27136,27251,
+27367,27484,27605,27725,27857,27976,28103,28238,28364,28495,28630,28764,28910,29045,29188,29327,
+29475,29615,29763,29916,30063,30217,30363,30518,30677,30830,30989,31146,31312,31469,31634,31803,
+31966,32134,32300,32471,32635,32806,32979,33157,33326,33502,33680,33857,34040,34219,34395,34583,
+34759,34948,35127,35313,35502,35685,35878,36067,36257,36441,36633,36829,37022,37211,37408,37604,
+37798,37990,38190,38392,38590,38788,38983,39189,39390,39591,39795,39996,40195,40398,40610,40812,
+24579,24583,24584,24595,24604,24617,24627,24641,24665,24692,24712,24740,24775,24806,24844,24877,
+24917,24960,25005,25055,25112,25163,25220,25278,25333,25403,25464,25531,25602,25678,25756,25833,
+25913,25989,26074,26161,26255,26345,26438,26536,26626,26726,26827,26935,27042,27147,27255,27370,
+27484,27594,27712,27835,27951,28077,28203,28328,28457,28581,28715,28846,28987,29117,29264,29397,
+29544,29681,29826,29972,30123,30272,30419,30570,30726,30875,31031,31193,31346,31507,31666,31833,
+31993,32159,32329,32489,32658,32834,32998,33168,33346,33513,33687,33870,34041,34224,34395,34576,
+34761,34945,35121,35305,35489,35679,35860,36053,36242,36430,36612,36808,36994,37192,37378,37576,
+37763,37960,38154,38351,38551,38748,38946,39144,39345,39542,39750,39946,40149,40355,40559,40761,
+40967,24840,24839,24839,24851,24856,24871,24888,24903,24921,24947,24967,24995,25023,25061,25092,
+25129,25175,25217,25261,25307,25362,25415,25471,25530,25588,25646,25715,25785,25847,25922,25999,
+26069,26156,26233,26317,26406,26490,26587,26672,26767,26867,26966,27060,27165,27275,27380,27486,
+27597,27708,27824,27939,28062,28183,28302,28428,28548,28680,28804,28933,29066,29205,29334,29480,
+29619,29752,29895,30046,30182,30327,30481,30624,30776,30928,31081,31234,31396,31549,31706,31867,
+32033,32187,32354,32525,32690,32856,33024,33189,33360,33533,33707,33881,34058,34227,34409,34586,
+34765,34943,35124,35303,35489,35666,35858,36037,36223,36409,36600,36785,36974,37165,37354,37545,
+37744,37938,38131,38320,38516,38711,38912,39108,39309,39508,39707,39908,40107,40303,40505,40714,
+40917,41115,25091,25095,25095,25103,25111,25128,25141,25153,25176,25196,25226,25248,25277,25315,
+25351,25381,25421,25465,25516,25562,25609,25660,25715,25776,25839,25893,25962,26029,26093,26165,
+26244,26317,26397,26474,26558,26643,26735,26820,26909,27003,27104,27203,27298,27399,27503,27607,
+27720,27826,27937,28051,28167,28283,28402,28524,28645,28775,28902,29025,29154,29291,29417,29557,
+29693,29828,29972,30112,30249,30400,30544,30691,30832,30987,31135,31285,31441,31594,31754,31908,
+32071,32232,32387,32548,32715,32877,33052,33219,33379,33550,33725,33895,34070,34242,34414,34593,
+34770,34949,35127,35300,35485,35671,35846,36034,36217,36404,36589,36772,36963,37147,37342,37525,
+37721,37913,38106,38300,38487,38681,38881,39072,39266,39468,39665,39864,40063,40263,40467,40668,
+40865,41069,41271,25347,25352,25357,25356,25371,25384,25391,25414,25429,25451,25482,25508,25530,
+25567,25599,25634,25681,25720,25767,25810,25862,25912,25970,26024,26085,26145,26211,26277,26345,
+26409,26488,26559,26642,26719,26799,26884,26978,27065,27150,27241,27344,27433,27534,27634,27736,
+27840,27954,28062,28169,28286,28401,28517,28635,28754,28870,29000,29120,29253,29374,29510,29643,
+29772,29907,30050,30186,30326,30462,30610,30750,30898,31046,31195,31348,31495,31644,31799,31953,
+32115,32272,32424,32586,32747,32917,33074,33240,33411,33574,33746,33910,34082,34251,34426,34599,
+34781,34956,35127,35305,35483,35668,35843,36031,36208,36391,36580,36761,36945,37134,37326,37507,
+37704,37893,38077,38269,38467,38655,38848,39043,39237,39439,39635,39833,40031,40224,40423,40623,
+40823,41028,41228,41432,25608,25608,25608,25617,25623,25632,25647,25669,25689,25710,25737,25759,
+25786,25819,25859,25889,25933,25973,26020,26059,26113,26168,26213,26276,26335,26395,26458,26526,
+26587,26661,26729,26803,26884,26960,27042,27130,27210,27303,27393,27479,27581,27671,27775,27873,
+27970,28073,28180,28287,28400,28515,28628,28745,28862,28975,29097,29224,29347,29473,29600,29724,
+29862,29995,30126,30258,30397,30541,30677,30818,30960,31105,31255,31399,31552,31698,31850,32002,
+32161,32317,32470,32627,32784,32950,33106,33277,33435,33605,33766,33935,34102,34273,34448,34621,
+34794,34961,35143,35312,35493,35668,35845,36029,36204,36394,36569,36757,36942,37128,37308,37494,
+37681,37870,38066,38254,38439,38630,38824,39020,39209,39402,39603,39791,39994,40189,40386,40585,
+40788,40984,41187,41387,41590,25864,25857,25864,25874,25883,25895,25902,25924,25945,25965,25990,
+26011,26046,26077,26109,26142,26180,26227,26270,26317,26360,26410,26464,26520,26578,26643,26706,
+26765,26838,26904,26974,27050,27129,27207,27284,27368,27458,27538,27631,27725,27813,27913,28004,
+28109,28203,28310,28419,28519,28636,28746,28859,28967,29083,29201,29326,29448,29573,29691,29819,
+29952,30083,30206,30340,30475,30611,30756,30895,31029,31178,31321,31466,31611,31760,31905,32061,
+32213,32361,32515,32675,32826,32986,33151,33311,33472,33633,33802,33966,34134,34300,34471,34639,
+34810,34981,35148,35321,35504,35679,35857,36029,36206,36387,36567,36750,36932,37115,37299,37490,
+37674,37862,38049,38238,38425,38612,38802,38992,39190,39383,39575,39763,39959,40159,40350,40546,
+40752,40943,41146,41345,41546,41746,26120,26119,26124,26124,26133,26150,26164,26181,26202,26223,
+26246,26264,26295,26331,26362,26394,26439,26474,26518,26563,26612,26662,26715,26770,26831,26888,
+26949,27017,27080,27152,27225,27294,27368,27450,27534,27613,27698,27784,27874,27963,28055,28151,
+28245,28339,28446,28548,28651,28758,28864,28971,29083,29196,29315,29433,29552,29667,29789,29915,
+30041,30173,30300,30428,30564,30692,30827,30968,31106,31244,31385,31533,31673,31817,31970,32114,
+32267,32413,32564,32720,32879,33029,33188,33350,33510,33666,33833,33992,34162,34327,34489,34661,
+34826,35001,35164,35342,35516,35685,35866,36035,36218,36396,36570,36748,36929,37118,37295,37482,
+37667,37850,38033,38225,38405,38599,38787,38972,39168,39354,39552,39743,39931,40129,40325,40520,
+40716,40911,41107,41308,41503,41704,41902,26376,26375,26375,26385,26394,26400,26419,26430,26457,
+26471,26501,26519,26549,26584,26618,26655,26685,26726,26776,26815,26867,26921,26971,27020,27082,
+27135,27201,27261,27331,27400,27471,27542,27618,27693,27769,27857,27934,28026,28113,28197,28288,
+28385,28478,28574,28676,28777,28886,28990,29097,29203,29313,29431,29544,29657,29775,29895,30021,
+30145,30269,30393,30522,30652,30776,30911,31045,31185,31319,31459,31599,31745,31882,32028,32173,
+32320,32475,32622,32772,32923,33076,33233,33395,33547,33706,33866,34027,34187,34359,34518,34684,
+34851,35022,35188,35356,35527,35705,35877,36051,36222,36398,36580,36758,36931,37110,37296,37480,
+37662,37845,38028,38207,38394,38581,38768,38956,39148,39334,39527,39721,39911,40099,40294,40487,
+40680,40880,41073,41267,41466,41664,41863,42066,26627,26626,26631,26641,26647,26663,26668,26689,
+26706,26727,26751,26778,26807,26839,26872,26907,26944,26978,27027,27072,27119,27169,27220,27270,
+27331,27388,27451,27514,27572,27643,27711,27787,27857,27933,28017,28095,28183,28266,28350,28443,
+28531,28619,28715,28812,28911,29016,29118,29222,29330,29437,29542,29654,29768,29888,30000,30125,
+30244,30367,30493,30612,30739,30872,30998,31134,31270,31402,31533,31679,31818,31960,32100,32240,
+32385,32529,32684,32833,32978,33129,33282,33436,33590,33748,33904,34071,34232,34385,34547,34719,
+34883,35045,35216,35379,35555,35722,35889,36062,36239,36414,36585,36758,36937,37114,37298,37472,
+37653,37837,38024,38205,38390,38574,38761,38948,39130,39322,39511,39696,39889,40077,40271,40462,
+40658,40848,41046,41237,41431,41635,41828,42026,42230,26883,26887,26892,26895,26905,26913,26925,
+26947,26963,26982,27009,27034,27062,27094,27119,27161,27193,27237,27272,27324,27364,27414,27472,
+27518,27576,27634,27698,27755,27826,27890,27962,28034,28104,28177,28260,28338,28424,28508,28594,
+28682,28766,28865,28959,29049,29148,29247,29354,29451,29564,29670,29777,29891,30002,30111,30229,
+30348,30471,30587,30712,30835,30965,31094,31218,31355,31484,31620,31750,31890,32028,32167,32308,
+32452,32595,32741,32887,33039,33183,33342,33488,33646,33793,33951,34109,34265,34424,34586,34752,
+34916,35079,35240,35411,35577,35740,35915,36081,36257,36424,36602,36775,36948,37121,37299,37476,
+37655,37838,38015,38204,38380,38569,38747,38937,39116,39306,39491,39684,39871,40063,40251,40436,
+40628,40823,41015,41212,41405,41604,41794,41990,42189,42391,27144,27138,27145,27152,27155,27170,
+27186,27196,27220,27237,27259,27283,27317,27340,27373,27409,27450,27490,27531,27570,27621,27670,
+27722,27774,27826,27886,27943,28010,28073,28141,28209,28279,28347,28422,28506,28578,28662,28750,
+28829,28916,29007,29097,29195,29292,29387,29488,29582,29692,29795,29896,30004,30122,30228,30341,
+30456,30578,30692,30813,30933,31058,31189,31311,31445,31575,31704,31833,31973,32107,32243,32386,
+32521,32670,32805,32956,33101,33250,33392,33540,33698,33851,34005,34159,34315,34467,34625,34786,
+34951,35108,35271,35434,35600,35767,35939,36100,36277,36442,36618,36790,36964,37137,37308,37482,
+37660,37838,38021,38195,38381,38566,38747,38925,39114,39292,39484,39673,39854,40048,40234,40423,
+40614,40800,40994,41188,41380,41569,41767,41963,42153,42350,42546,27399,27395,27398,27409,27413,
+27430,27437,27451,27469,27490,27520,27538,27568,27600,27632,27669,27698,27742,27784,27821,27873,
+27921,27968,28019,28081,28137,28191,28257,28322,28389,28457,28525,28592,28667,28742,28825,28903,
+28990,29072,29163,29246,29336,29428,29531,29625,29723,29817,29925,30029,30134,30237,30354,30459,
+30577,30688,30807,30919,31039,31163,31281,31407,31532,31664,31795,31925,32053,32191,32327,32461,
+32596,32736,32877,33018,33169,33306,33458,33606,33748,33907,34056,34204,34357,34517,34671,34832,
+34983,35150,35305,35468,35632,35796,35962,36132,36300,36468,36631,36803,36979,37151,37324,37494,
+37676,37852,38023,38207,38385,38562,38739,38928,39105,39293,39473,39655,39846,40030,40216,40408,
+40596,40780,40970,41165,41352,41550,41740,41931,42128,42320,42519,42711,27656,27651,27660,27665,
+27674,27680,27696,27713,27725,27753,27770,27798,27826,27855,27881,27919,27959,27991,28036,28081,
+28124,28168,28215,28271,28331,28381,28446,28500,28568,28633,28701,28767,28843,28913,28987,29070,
+29152,29233,29312,29403,29491,29575,29666,29759,29857,29953,30058,30158,30257,30367,30467,30576,
+30689,30799,30918,31033,31146,31264,31389,31506,31631,31755,31888,32013,32143,32274,32402,32537,
+32678,32818,32951,33095,33231,33378,33518,33668,33816,33957,34106,34258,34410,34562,34722,34876,
+35034,35191,35349,35506,35670,35829,35992,36157,36325,36489,36661,36828,36995,37169,37334,37508,
+37687,37859,38037,38213,38389,38569,38741,38918,39101,39291,39467,39649,39832,40024,40204,40388,
+40577,40770,40953,41141,41336,41526,41718,41910,42098,42292,42484,42684,42878,27912,27907,27911,
+27923,27929,27933,27953,27968,27979,28008,28024,28047,28081,28109,28140,28174,28206,28245,28285,
+28326,28371,28418,28466,28522,28582,28631,28690,28749,28811,28880,28949,29012,29087,29155,29236,
+29311,29387,29470,29554,29644,29732,29814,29911,29997,30099,30194,30293,30388,30491,30595,30706,
+30808,30924,31036,31148,31258,31379,31496,31614,31731,31858,31983,32104,32235,32360,32491,32624,
+32760,32894,33032,33171,33308,33444,33587,33727,33874,34024,34173,34315,34463,34616,34772,34926,
+35079,35231,35388,35552,35705,35869,36025,36188,36353,36517,36687,36850,37016,37184,37356,37531,
+37696,37871,38048,38222,38394,38575,38752,38925,39103,39281,39468,39652,39833,40016,40195,40380,
+40565,40754,40940,41129,41319,41505,41693,41884,42080,42273,42460,42653,42851,43042,28163,28168,
+28166,28178,28187,28189,28209,28217,28234,28262,28279,28310,28330,28363,28393,28427,28458,28495,
+28543,28581,28630,28675,28724,28772,28826,28879,28941,29004,29060,29129,29196,29257,29335,29401,
+29477,29552,29637,29714,29796,29880,29974,30055,30151,30244,30338,30434,30532,30626,30728,30836,
+30938,31045,31148,31265,31377,31486,31607,31724,31835,31956,32082,32203,32333,32452,32580,32715,
+32848,32973,33114,33242,33388,33519,33658,33801,33946,34085,34230,34381,34522,34671,34829,34978,
+35125,35280,35436,35588,35746,35910,36068,36229,36385,36557,36718,36879,37044,37214,37378,37553,
+37717,37892,38057,38238,38411,38584,38754,38937,39108,39293,39465,39650,39826,40013,40192,40378,
+40557,40743,40933,41111,41305,41492,41680,41868,42055,42247,42437,42633,42825,43014,43212,28419,
+28425,28428,28427,28441,28445,28461,28479,28495,28512,28532,28558,28586,28617,28648,28681,28718,
+28754,28794,28835,28882,28921,28970,29022,29076,29129,29192,29246,29308,29375,29438,29505,29576,
+29653,29727,29796,29879,29956,30043,30126,30207,30300,30390,30481,30574,30665,30768,30861,30965,
+31064,31173,31272,31380,31492,31602,31716,31830,31946,32065,32186,32308,32426,32550,32675,32803,
+32931,33062,33193,33324,33465,33595,33735,33878,34011,34154,34296,34441,34592,34737,34885,35028,
+35186,35331,35484,35638,35792,35952,36112,36269,36425,36583,36751,36916,37080,37237,37410,37576,
+37738,37908,38078,38248,38422,38597,38766,38944,39118,39295,39469,39654,39832,40013,40191,40370,
+40557,40739,40919,41103,41290,41474,41667,41854,42041,42227,42417,42609,42804,42997,43189,43377,
+28679,28673,28679,28684,28696,28707,28715,28735,28750,28775,28794,28818,28843,28874,28898,28936,
+28970,29008,29042,29089,29126,29177,29227,29279,29327,29379,29435,29496,29556,29624,29689,29756,
+29821,29896,29964,30046,30119,30202,30285,30370,30448,30536,30630,30716,30807,30904,30998,31097,
+31201,31298,31407,31507,31620,31726,31833,31951,32063,32179,32291,32413,32534,32651,32780,32897,
+33029,33152,33286,33418,33549,33684,33817,33948,34094,34226,34369,34514,34652,34796,34943,35095,
+35241,35386,35543,35690,35841,36002,36151,36315,36465,36627,36784,36944,37106,37270,37440,37605,
+37772,37937,38100,38275,38445,38610,38782,38954,39134,39301,39479,39661,39833,40016,40192,40370,
+40549,40733,40919,41097,41282,41469,41653,41840,42029,42211,42405,42588,42778,42967,43159,43354,
+43544,28931,28934,28934,28947,28953,28963,28970,28991,29002,29023,29045,29072,29099,29127,29158,
+29190,29219,29255,29300,29341,29380,29431,29476,29525,29581,29636,29686,29746,29804,29867,29935,
+30000,30067,30138,30210,30285,30368,30440,30528,30604,30689,30779,30864,30958,31046,31144,31235,
+31337,31432,31531,31641,31745,31851,31959,32069,32180,32289,32401,32525,32635,32753,32874,32997,
+33126,33252,33375,33508,33632,33768,33895,34037,34170,34306,34447,34580,34728,34870,35008,35158,
+35305,35447,35595,35743,35894,36047,36206,36354,36515,36673,36824,36984,37150,37311,37466,37636,
+37796,37966,38132,38291,38467,38632,38807,38973,39149,39322,39490,39662,39847,40024,40194,40377,
+40555,40733,40916,41095,41282,41460,41648,41833,42013,42199,42387,42575,42760,42949,43144,43335,
+43522,43717,29192,29186,29196,29196,29209,29218,29225,29239,29263,29284,29304,29327,29347,29377,
+29406,29435,29474,29515,29553,29594,29636,29683,29723,29772,29831,29880,29935,29994,30054,30121,
+30179,30253,30319,30389,30455,30530,30610,30689,30767,30853,30931,31016,31105,31199,31285,31380,
+31472,31569,31674,31773,31875,31973,32084,32186,32302,32406,32522,32635,32752,32863,32985,33106,
+33228,33353,33469,33601,33729,33857,33988,34120,34253,34388,34516,34657,34796,34938,35077,35226,
+35365,35515,35659,35808,35956,36103,36259,36411,36560,36718,36874,37033,37190,37344,37505,37671,
+37826,37992,38157,38321,38493,38656,38827,38993,39162,39334,39505,39678,39852,40032,40203,40379,
+40557,40740,40917,41094,41277,41461,41640,41822,42004,42190,42375,42563,42754,42936,43124,43311,
+43501,43693,43883,29443,29448,29451,29457,29459,29473,29486,29496,29518,29538,29559,29577,29602,
+29635,29666,29691,29724,29763,29806,29841,29890,29932,29976,30030,30083,30136,30185,30248,30303,
+30363,30425,30496,30568,30637,30707,30780,30851,30933,31006,31094,31178,31258,31350,31438,31529,
+31615,31711,31812,31907,32002,32107,32212,32311,32418,32531,32636,32748,32862,32978,33096,33213,
+33327,33451,33570,33695,33819,33952,34073,34201,34334,34472,34606,34733,34876,35011,35156,35292,
+35433,35580,35721,35866,36018,36165,36313,36461,36618,36769,36917,37073,37227,37386,37543,37703,
+37864,38023,38187,38358,38516,38682,38849,39020,39184,39359,39525,39700,39873,40046,40213,40389,
+40565,40741,40918,41098,41279,41460,41641,41823,42002,42188,42368,42552,42737,42927,43114,43297,
+43484,43679,43869,44053,29699,29699,29703,29712,29717,29724,29737,29751,29771,29795,29808,29831,
+29862,29885,29918,29946,29978,30015,30058,30099,30142,30186,30227,30280,30334,30379,30439,30492,
+30556,30610,30680,30739,30812,30874,30947,31020,31095,31171,31255,31338,31413,31504,31589,31673,
+31768,31859,31948,32044,32144,32240,32338,32447,32545,32655,32758,32874,32983,33094,33208,33318,
+33435,33553,33673,33796,33921,34048,34168,34294,34431,34559,34686,34818,34956,35088,35228,35364,
+35509,35651,35793,35932,36075,36226,36374,36523,36667,36823,36975,37121,37281,37431,37585,37744,
+37908,38064,38228,38384,38550,38719,38876,39046,39209,39376,39550,39714,39890,40061,40234,40405,
+40577,40756,40933,41104,41279,41460,41637,41823,41998,42180,42364,42550,42733,42917,43103,43288,
+43471,43663,43852,44039,44228,29955,29959,29964,29964,29975,29980,29994,30012,30028,30050,30065,
+30091,30113,30139,30167,30205,30238,30268,30307,30345,30392,30437,30484,30532,30584,30636,30691,
+30742,30801,30859,30923,30992,31054,31127,31197,31269,31339,31419,31498,31580,31662,31747,31824,
+31917,32002,32098,32191,32288,32382,32477,32575,32679,32783,32888,32995,33097,33214,33320,33438,
+33547,33664,33780,33904,34020,34145,34267,34397,34521,34644,34779,34905,35042,35177,35305,35446,
+35580,35720,35860,36005,36147,36288,36438,36578,36732,36878,37027,37180,37326,37486,37639,37789,
+37949,38105,38269,38428,38588,38744,38915,39078,39244,39405,39570,39743,39909,40076,40251,40422,
+40594,40767,40938,41114,41288,41470,41645,41825,42000,42180,42364,42547,42723,42913,43097,43275,
+43464,43647,43839,44025,44209,44397,30211,30216,30221,30224,30227,30241,30249,30263,30283,30295,
+30319,30343,30366,30400,30426,30453,30485,30527,30558,30599,30640,30689,30735,30783,30832,30884,
+30942,30991,31054,31109,31173,31234,31308,31369,31444,31510,31584,31660,31738,31823,31905,31988,
+32073,32160,32248,32330,32424,32523,32619,32709,32810,32915,33012,33116,33223,33330,33446,33550,
+33661,33780,33895,34008,34125,34251,34373,34488,34615,34737,34867,34999,35128,35261,35394,35523,
+35663,35792,35940,36073,36215,36361,36498,36644,36789,36932,37082,37236,37387,37533,37686,37839,
+37998,38148,38307,38468,38624,38783,38948,39106,39277,39434,39605,39770,39932,40099,40275,40439,
+40613,40780,40952,41131,41304,41475,41650,41833,42005,42188,42360,42545,42722,42910,43090,43276,
+43459,43638,43823,44008,44195,44383,44574,30471,30467,30470,30476,30488,30491,30505,30523,30534,
+30553,30579,30599,30621,30649,30677,30713,30744,30776,30812,30858,30892,30941,30988,31035,31078,
+31138,31189,31240,31297,31362,31424,31482,31547,31616,31690,31756,31827,31909,31979,32059,32141,
+32224,32308,32393,32488,32572,32663,32756,32857,32948,33047,33151,33253,33357,33460,33562,33674,
+33781,33891,34010,34125,34237,34351,34471,34592,34719,34843,34963,35088,35217,35349,35475,35614,
+35741,35875,36016,36157,36294,36427,36574,36716,36855,37005,37148,37296,37443,37594,37745,37892,
+38043,38203,38358,38513,38671,38828,38983,39148,39309,39465,39630,39801,39962,40132,40291,40460,
+40630,40800,40970,41141,41318,41492,41666,41841,42014,42189,42366,42548,42731,42909,43088,43266,
+43448,43634,43816,44000,44190,44375,44563,44744,30728,30723,30731,30737,30739,30753,30759,30779,
+30795,30813,30831,30852,30883,30909,30930,30967,30997,31037,31071,31111,31145,31193,31234,31280,
+31335,31387,31436,31490,31552,31606,31673,31736,31801,31866,31935,32007,32075,32149,32225,32302,
+32385,32473,32555,32640,32723,32817,32902,32995,33095,33189,33282,33386,33485,33585,33687,33801,
+33903,34014,34129,34240,34352,34463,34584,34699,34824,34943,35062,35193,35317,35442,35570,35696,
+35827,35964,36092,36233,36369,36504,36642,36788,36923,37070,37216,37359,37505,37653,37796,37945,
+38099,38249,38402,38561,38717,38866,39025,39182,39342,39503,39669,39831,39996,40156,40320,40490,
+40657,40821,40996,41166,41336,41503,41681,41854,42027,42199,42375,42551,42731,42907,43092,43266,
+43451,43629,43810,43993,44179,44363,44548,44732,44920,30984,30984,30982,30988,30996,31009,31015,
+31036,31045,31067,31085,31111,31135,31161,31184,31216,31249,31288,31325,31358,31397,31441,31487,
+31537,31581,31634,31685,31745,31795,31855,31915,31978,32047,32115,32183,32248,32325,32400,32474,
+32546,32626,32713,32792,32883,32970,33056,33140,33233,33330,33422,33519,33621,33722,33820,33928,
+34031,34133,34246,34359,34464,34577,34697,34805,34930,35049,35168,35285,35415,35538,35664,35793,
+35915,36047,36177,36316,36445,36580,36726,36863,37002,37142,37279,37421,37569,37712,37861,38005,
+38154,38310,38460,38613,38767,38913,39070,39233,39388,39548,39708,39863,40028,40186,40352,40521,
+40681,40848,41015,41188,41353,41526,41693,41862,42043,42211,42384,42565,42738,42918,43089,43274,
+43449,43628,43808,43991,44175,44356,44537,44730,44909,45095,31239,31234,31244,31250,31255,31260,
+31277,31285,31299,31323,31340,31368,31385,31416,31438,31469,31500,31535,31571,31617,31657,31699,
+31742,31789,31832,31885,31942,31991,32047,32110,32171,32231,32291,32363,32425,32494,32563,32642,
+32713,32795,32874,32956,33038,33117,33208,33291,33381,33477,33569,33659,33755,33854,33958,34054,
+34161,34266,34366,34479,34585,34701,34811,34920,35037,35152,35271,35396,35516,35637,35762,35884,
+36010,36137,36267,36404,36530,36662,36802,36937,37073,37212,37356,37492,37633,37774,37922,38072,
+38213,38363,38511,38663,38813,38972,39124,39273,39435,39592,39742,39909,40062,40223,40384,40549,
+40717,40882,41042,41214,41381,41548,41719,41884,42055,42228,42403,42572,42745,42927,43102,43275,
+43457,43631,43815,43988,44170,44358,44538,44718,44899,45085,45269,31495,31496,31499,31504,31507,
+31520,31527,31541,31560,31577,31595,31622,31646,31665,31693,31728,31760,31789,31831,31867,31909,
+31949,31989,32036,32082,32132,32185,32239,32295,32353,32413,32473,32538,32608,32676,32746,32810,
+32888,32957,33035,33113,33195,33275,33360,33445,33538,33625,33717,33801,33896,33998,34094,34194,
+34292,34397,34500,34601,34706,34820,34927,35036,35156,35264,35379,35498,35617,35741,35858,35988,
+36107,36236,36360,36488,36622,36753,36880,37019,37149,37285,37427,37565,37711,37847,37994,38138,
+38277,38429,38576,38725,38872,39022,39172,39328,39478,39632,39793,39945,40109,40263,40428,40587,
+40750,40914,41073,41237,41401,41571,41741,41910,42080,42245,42417,42587,42760,42934,43113,43289,
+43465,43637,43818,44000,44177,44357,44537,44715,44897,45084,45261,45446,31751,31752,31751,31755,
+31767,31772,31788,31796,31817,31829,31852,31871,31895,31925,31950,31978,32010,32042,32084,32121,
+32161,32198,32246,32286,32339,32384,32442,32495,32551,32607,32667,32722,32786,32849,32923,32990,
+33056,33134,33208,33284,33361,33440,33523,33601,33692,33776,33865,33949,34042,34140,34230,34326,
+34430,34530,34624,34733,34838,34940,35045,35157,35274,35383,35498,35608,35725,35842,35960,36083,
+36211,36336,36455,36585,36713,36835,36975,37101,37234,37372,37503,37644,37779,37919,38066,38202,
+38342,38490,38640,38785,38927,39076,39230,39383,39533,39681,39836,39996,40147,40312,40469,40622,
+40787,40944,41106,41271,41435,41602,41769,41930,42099,42270,42436,42613,42778,42950,43122,43296,
+43470,43646,43822,43998,44175,44356,44538,44715,44894,45077,45259,45446,45628,32008,32002,32011,
+32017,32024,32027,32038,32053,32072,32089,32109,32126,32149,32181,32203,32236,32269,32297,32333,
+32374,32414,32455,32499,32544,32586,32641,32693,32739,32800,32856,32916,32973,33039,33097,33171,
+33233,33303,33373,33454,33522,33599,33678,33760,33843,33927,34018,34099,34190,34281,34372,34474,
+34563,34661,34760,34865,34968,35067,35173,35277,35391,35502,35607,35729,35843,35956,36070,36190,
+36308,36436,36551,36678,36810,36931,37059,37187,37326,37457,37585,37725,37862,38001,38134,38273,
+38419,38557,38703,38851,38994,39142,39284,39433,39590,39734,39892,40045,40194,40354,40515,40670,
+40823,40981,41147,41308,41467,41630,41794,41964,42129,42293,42459,42630,42797,42971,43144,43312,
+43490,43661,43835,44009,44189,44365,44545,44718,44897,45076,45260,45443,45624,45803,32259,32263,
+32269,32268,32275,32287,32296,32307,32327,32344,32367,32386,32410,32429,32462,32486,32517,32555,
+32591,32623,32662,32703,32752,32795,32838,32886,32944,32996,33052,33106,33160,33225,33283,33350,
+33419,33479,33553,33624,33692,33772,33843,33923,34004,34085,34174,34260,34341,34430,34524,34615,
+34703,34801,34896,35001,35101,35198,35300,35410,35510,35618,35730,35846,35951,36070,36180,36303,
+36416,36538,36659,36783,36908,37032,37152,37285,37414,37545,37670,37804,37938,38074,38208,38355,
+38494,38633,38770,38910,39062,39206,39352,39492,39641,39796,39948,40093,40250,40400,40557,40715,
+40868,41029,41186,41347,41502,41670,41825,41990,42156,42320,42492,42652,42825,42992,43159,43335,
+43506,43676,43850,44023,44194,44370,44545,44721,44903,45084,45257,45442,45622,45806,45982,32514,
+32520,32523,32522,32531,32545,32556,32568,32583,32595,32617,32637,32660,32689,32712,32741,32772,
+32804,32841,32883,32919,32961,32999,33042,33089,33143,33189,33243,33297,33349,33407,33473,33533,
+33593,33664,33726,33802,33865,33941,34012,34088,34165,34244,34329,34417,34499,34586,34669,34759,
+34848,34941,35043,35135,35230,35336,35431,35540,35642,35744,35857,35957,36075,36187,36296,36416,
+36529,36647,36761,36882,37002,37122,37256,37375,37503,37635,37764,37896,38028,38160,38289,38431,
+38570,38708,38842,38989,39131,39272,39412,39557,39708,39855,40000,40149,40299,40452,40608,40763,
+40919,41067,41231,41387,41546,41706,41863,42023,42185,42353,42521,42686,42852,43014,43185,43356,
+43520,43691,43866,44039,44207,44382,44559,44732,44908,45087,45269,45446,45625,45805,45980,46168,
+32770,32770,32780,32784,32787,32794,32812,32824,32834,32850,32871,32896,32914,32944,32973,32995,
+33030,33063,33093,33129,33168,33208,33256,33301,33339,33394,33438,33497,33550,33606,33661,33721,
+33779,33847,33911,33972,34041,34112,34184,34263,34339,34408,34491,34576,34651,34738,34828,34910,
+35005,35095,35187,35274,35377,35473,35566,35672,35775,35870,35977,36083,36189,36307,36412,36523,
+36637,36752,36876,36993,37112,37231,37354,37479,37602,37729,37855,37984,38113,38245,38374,38508,
+38643,38779,38924,39063,39195,39337,39485,39622,39766,39914,40062,40208,40360,40504,40657,40815,
+40965,41121,41271,41431,41589,41748,41902,42067,42221,42388,42549,42711,42882,43040,43212,43373,
+43543,43712,43881,44051,44228,44396,44573,44742,44916,45093,45272,45453,45630,45805,45986,46162,
+46342};
+
+__constant unsigned short arctan_table_int8[16641]={
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,7873,1799,12983,1799,15589,15577,15577,15577,15577,497,15577,497,15577,497,
+15577,15577,15577,497,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,
+16229,16229,16229,497,16229,16229,16229,16229,16229,16229,16229,171,16229,171,16229,16229,
+16229,16229,16229,171,16229,171,16229,171,16229,16229,16229,171,16229,16229,16229,16229,
+16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,8,
+8,8,8,8,8,8,16229,8,8,8,8,8,8,8,8,8,
+8,8,8,8,16229,8,16229,8,8,16229,16229,8,16229,8,16229,8,
+8,8,8,8,16229,8,16229,8,8,8,8,8,16229,8,16229,8,
+8,8,0,3311,7873,13073,10467,12983,12983,15589,12983,15589,14285,15589,15589,15589,
+15589,15577,15589,15577,15589,15577,15577,15577,15577,16229,15577,15577,15577,15577,15577,15577,
+15577,16229,15577,16229,15577,15577,15577,15577,15903,16229,15903,16229,15903,16229,16229,15903,
+15903,16229,15903,16229,15903,16229,16229,16229,15903,16229,15903,16229,15903,16229,16229,16229,
+16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,
+16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,
+16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,
+16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,
+16229,16229,16229,0,3311,8511,7873,10479,10467,13073,13073,12983,12983,14287,14287,14285,
+14287,14285,14285,15589,15589,15589,14937,15589,14937,15589,14937,15589,15589,15589,15589,15577,
+15589,15577,15589,15577,15577,15577,15577,15577,15577,15577,15577,15903,15903,15903,15903,15903,
+15577,15903,15577,15903,15903,15903,15903,15903,15903,15903,15577,15903,15903,15903,15903,16229,
+15903,16229,15903,15903,15903,15903,15903,16229,15903,16229,15903,16229,16229,15903,15903,16229,
+15903,16066,16066,16066,16066,16066,16066,16066,16066,16066,16066,16066,16066,16066,16066,16229,
+16066,16066,16066,16066,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,
+16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,16229,
+16229,16229,16229,16229,0,795,8511,5905,7873,10479,10479,13073,13073,11769,13073,12983,
+12983,12983,12983,14287,14287,14285,14287,14285,14285,14937,14937,14937,14937,15589,14937,15589,
+14937,14937,15589,15589,15589,15589,15589,15589,15589,15589,15589,15263,15589,15577,15589,15577,
+15589,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15903,
+15577,15903,15903,15903,15577,15903,15577,15903,15577,15903,15903,15903,15903,15903,15577,15903,
+15577,15740,15903,15903,15903,16066,15903,16066,15903,15903,15903,15903,15903,16066,15903,16066,
+15903,16066,15903,15903,15903,16066,16066,16066,16066,16066,16066,16066,16066,16066,16066,16066,
+16066,16066,16066,16066,16066,16229,16066,16066,15903,16066,16066,16066,16066,16229,16066,16066,
+16066,16066,16066,16066,16066,0,3401,3311,5905,8511,7873,7873,10479,10467,11771,11769,
+11769,13073,13073,12983,12983,12983,12983,12983,13635,14287,14287,14285,14287,14285,14285,14937,
+14937,14937,14285,14937,14937,14937,14937,14937,15589,15589,15589,15589,15263,15263,15263,15263,
+15263,15263,15589,15589,15589,15589,15589,15589,15589,15589,15589,15577,15589,15577,15589,15577,
+15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,
+15577,15577,15577,15903,15740,15903,15740,15903,15903,15740,15740,15903,15740,15903,15740,15903,
+15903,15903,15903,15903,15740,15903,15740,15903,15903,15903,15903,16066,15903,15903,15903,15903,
+15903,15903,15903,16066,15903,16066,15903,15903,15903,15903,15903,16066,15903,16066,15903,16066,
+15903,15903,15903,16066,16066,16066,0,795,3311,5917,8511,8511,7873,9176,9175,10467,
+10467,11771,11769,13073,13073,13073,13073,12983,12983,13635,13635,13635,13635,13635,13635,14287,
+14287,14285,14287,14285,14285,14285,14285,14285,14937,14937,14937,14937,14611,14937,14937,14937,
+14937,15263,15263,15263,15263,15263,15263,15263,15263,15589,15263,15589,15589,15589,15589,15589,
+15263,15589,15589,15589,15589,15589,15589,15589,15589,15577,15589,15577,15589,15577,15577,15577,
+15577,15577,15577,15577,15577,15740,15740,15740,15740,15740,15577,15740,15577,15740,15740,15740,
+15740,15740,15740,15740,15577,15740,15740,15740,15740,15903,15740,15903,15740,15903,15740,15740,
+15740,15903,15740,15903,15740,15903,15903,15740,15740,15903,15903,15903,15903,15903,15903,15903,
+15903,15903,15903,15903,15903,15903,15903,0,795,3401,3311,5917,8511,8511,7873,9176,
+9175,10479,10467,11771,10467,11769,11769,13073,13073,13073,13073,12983,12983,12983,12983,13635,
+13635,13635,13635,13635,14287,14287,14287,14285,14287,14285,14285,14285,14285,14611,14611,14937,
+14611,14937,14611,14937,14937,14937,14937,15263,14937,15263,14937,15263,15263,15263,15263,15589,
+15263,15589,15263,15263,15263,15263,15263,15589,15589,15589,15589,15589,15589,15589,15589,15589,
+15589,15589,15589,15589,15589,15426,15589,15577,15589,15577,15589,15577,15577,15577,15577,15577,
+15577,15577,15577,15577,15577,15577,15577,15577,15577,15740,15577,15740,15740,15740,15577,15740,
+15577,15740,15577,15740,15740,15740,15740,15740,15577,15740,15577,15740,15903,15903,15903,15903,
+15903,15903,15740,15903,15903,15903,15903,15903,0,795,3401,3311,5917,5905,7208,7208,
+7873,9176,9176,10479,10479,10467,10467,11771,11769,13073,11769,12421,12421,13073,13073,12983,
+12983,12983,12983,12983,13635,13635,13635,14287,13635,14287,14287,14287,14287,14285,13961,14611,
+14285,14611,14611,14611,14611,14937,14611,14937,14611,14937,14937,14937,14937,14937,14937,15263,
+14937,15263,14937,14937,14937,15263,14937,15263,15263,15263,15263,15263,15263,15589,15263,15589,
+15263,15589,15589,15589,15589,15589,15263,15426,15426,15426,15426,15426,15589,15589,15589,15589,
+15589,15589,15589,15589,15589,15577,15589,15577,15589,15577,15577,15577,15577,15577,15577,15577,
+15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15577,15740,15740,15740,
+15740,15740,15740,15740,15740,15740,15740,15740,15740,0,795,2099,3311,4615,5917,5905,
+7208,8511,7873,7873,9176,10479,10479,10467,10467,11771,11119,11771,11769,12421,12421,13073,
+12421,13073,13073,12983,12983,12983,12983,13635,13635,13635,13635,14287,13635,14287,13635,13961,
+14287,14287,14287,14285,14287,14611,14285,14611,14611,14611,14611,14611,14611,14611,14611,14937,
+14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,15263,14937,14937,14937,15263,
+15263,15263,15263,15589,15263,15589,15263,15263,15263,15263,15263,15426,15426,15426,15426,15426,
+15426,15426,15426,15589,15426,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,
+15589,15589,15589,15577,15589,15577,15589,15577,15577,15577,15577,15577,15577,15577,15577,15577,
+15577,15577,15577,15740,15577,15577,15577,15577,15577,15577,0,795,2097,3401,4615,4613,
+5905,7209,8511,8511,7873,9176,9176,10479,10479,10479,10467,11119,11119,11771,11771,12421,
+12421,12421,12421,13073,13073,13073,13073,12983,12983,12983,12983,12983,12983,13635,13635,13635,
+13635,13961,13961,13961,13961,13961,14287,14287,14287,14285,14287,14285,14285,14285,14285,14285,
+14611,14611,14611,14611,14611,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,
+14937,14937,14937,14937,14937,15263,15263,15100,15100,15263,15100,15263,15100,15263,15263,15263,
+15263,15426,15263,15426,15263,15426,15426,15426,15426,15589,15426,15426,15426,15426,15426,15426,
+15426,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,15589,
+15589,15577,15589,15577,15589,15577,15577,15577,15577,15577,15577,0,795,2099,3401,3311,
+4613,4613,5905,7209,8511,8511,7873,7873,9176,9175,9827,9827,10479,11119,11119,11119,
+11771,11771,11769,12421,12421,13073,12421,12421,13073,13073,13073,12983,12983,12983,12983,12983,
+13309,13635,13635,13635,13635,13635,13635,13961,13961,13961,13961,14287,14287,14287,14287,14285,
+14287,14285,14285,14285,14285,14285,14611,14611,14611,14611,14611,14937,14937,14937,14611,14937,
+14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,15100,15100,15100,15100,15263,
+15100,15263,15100,15263,15263,15263,15263,15263,15263,15426,15263,15426,15263,15263,15263,15426,
+15263,15426,15426,15426,15426,15426,15426,15589,15426,15589,15426,15589,15589,15589,15589,15589,
+15426,15589,15426,15589,15589,15589,15589,15589,15589,15589,15589,15589,0,807,2099,3401,
+3311,3311,4613,5917,7209,7209,8511,8511,7873,7873,8525,9175,9827,9827,10479,10467,
+11119,11119,11119,11771,11771,11769,12421,12421,12421,12421,12421,13073,13073,13073,13073,12983,
+12983,12983,13309,13309,13309,13635,13309,13635,13635,13635,13635,13635,13961,14287,13961,14287,
+13961,14287,14287,14287,14287,14285,14287,14285,14285,14285,14285,14285,14611,14611,14611,14611,
+14611,14611,14611,14611,14611,14937,14937,14937,14774,14774,14937,14937,14937,14937,14937,15100,
+14937,15100,15100,15100,15100,15100,15100,15100,15100,15263,15263,15263,15263,15263,15100,15263,
+15100,15263,15263,15263,15263,15426,15263,15263,15263,15426,15426,15426,15426,15589,15426,15589,
+15263,15263,15426,15426,15426,15426,15426,15589,15426,15589,15589,15426,15589,0,795,2099,
+3401,3401,3311,4615,5917,5917,5905,7209,8511,8511,7873,7873,9176,9175,9827,9827,
+9827,10467,10467,10467,11119,11119,11771,11769,11771,11769,11769,12421,12421,13073,13073,13073,
+13073,13073,13073,12983,12983,13309,12983,13309,13309,13309,13309,13635,13635,13635,13635,13961,
+13961,13961,13961,14287,13961,14287,13961,14287,14287,14287,14287,14285,14285,14285,14285,14285,
+14285,14285,14285,14611,14285,14611,14611,14611,14611,14611,14611,14774,14774,14774,14774,14774,
+14937,14937,14937,14937,14774,14937,14937,14937,14937,14937,15100,15100,15100,15100,14937,15100,
+15100,15100,15100,15100,15100,15263,15100,15263,15100,15263,15263,15263,15263,15263,15263,15426,
+15426,15426,15263,15263,15263,15263,15263,15263,15426,15426,15426,15426,15426,15426,0,807,
+2099,2099,3401,3311,4615,4613,5917,5905,7209,7208,8511,8511,8525,8525,8525,9175,
+9175,9827,10479,10479,10467,10467,10467,11119,11119,11771,11771,11769,11769,12421,11769,12421,
+12421,13073,13073,12747,12747,13073,13073,12983,12983,12983,12983,13309,12983,13309,13309,13635,
+13635,13635,13635,13635,13635,13961,13961,13961,13961,14287,13961,14287,13961,14287,14287,14287,
+14287,14285,14285,14285,14285,14285,14285,14285,14285,14611,14448,14611,14611,14611,14611,14611,
+14611,14774,14774,14774,14774,14774,14774,14774,14774,14937,14774,14937,14937,14937,14937,14937,
+14937,14937,14937,14937,14937,15100,15100,15100,14937,15100,15100,15100,15100,15100,15100,15263,
+15263,15263,15263,15263,15263,15263,15263,15263,15263,15263,15263,15263,15263,15263,15263,0,
+807,795,2097,3401,3311,3311,4613,5917,5905,5905,7209,7208,7859,7859,7873,8525,
+8525,9176,9827,9827,9827,10479,10479,10467,10467,11119,11119,11771,11771,11769,11771,11769,
+11769,12421,12421,13073,12421,12747,12747,12747,13073,13073,13073,12983,12983,12983,12983,13309,
+13309,13309,13309,13309,13635,13635,13635,13635,13635,13635,13635,13961,13961,13961,13961,14287,
+13961,14287,14287,14287,14287,14287,14287,14285,14285,14285,14285,14448,14448,14448,14448,14611,
+14448,14611,14611,14611,14611,14611,14611,14774,14611,14774,14611,14774,14774,14774,14774,14937,
+14774,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,15100,
+15100,15100,15100,15100,15100,15100,15100,15263,15100,15263,15263,15263,15263,15263,15263,15263,
+0,807,795,2099,3401,3401,3311,3311,4613,5917,5905,6557,7209,7208,7859,7859,
+7873,8525,8525,9175,9175,9827,9827,10479,10479,10467,10467,11119,11119,11119,11119,11771,
+11771,11769,11769,12095,12095,12095,12421,12421,12747,12747,12747,13073,13073,13073,13073,12983,
+12983,12983,12983,12983,12983,13309,13309,13309,13635,13635,13635,13635,13635,13635,13635,13961,
+13635,13961,13961,13961,14287,14287,14287,14287,14287,14287,14287,14287,14124,14285,14285,14448,
+14285,14448,14448,14448,14448,14611,14448,14448,14448,14611,14611,14611,14611,14774,14611,14774,
+14611,14774,14774,14774,14774,14937,14774,14937,14937,14937,14937,14937,14937,14937,14937,14937,
+14937,14937,14937,14937,14937,14937,14937,15100,14937,15100,15100,15100,15100,15263,15100,15263,
+15100,0,807,795,2099,3401,3401,3311,3311,3963,5265,5917,6557,6557,7209,7208,
+7859,8511,7873,7873,8525,9176,9175,9827,9175,10479,10479,10479,10467,10467,11119,11119,
+11119,11771,11771,11771,11769,11769,12095,12095,12095,12421,12421,12421,12747,12747,13073,13073,
+12747,13073,13073,12983,12983,12983,12983,12983,12983,13309,13309,13635,13635,13635,13635,13635,
+13635,13635,13635,13961,13635,13961,13961,13961,13961,13961,14287,14287,13961,14124,14124,14287,
+14287,14287,14287,14285,14285,14448,14285,14448,14285,14448,14448,14448,14448,14448,14448,14611,
+14611,14611,14611,14774,14611,14774,14611,14774,14774,14774,14774,14774,14774,14937,14774,14937,
+14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,14937,15100,14937,15100,14937,14937,
+15100,15100,0,807,795,1447,3401,3401,3311,3963,4615,4613,5265,5917,6557,6557,
+7208,7859,8511,7859,7873,8525,8525,9176,9176,9175,9827,9827,10479,10479,10479,10467,
+10467,10467,11119,11119,11445,11445,11445,11769,11769,12095,12095,12095,12421,12421,12421,12747,
+12747,12747,12747,13073,13073,13073,13073,12983,12983,12983,12983,13309,13309,13309,13309,13309,
+13309,13635,13635,13635,13635,13635,13635,13635,13635,13961,13635,13961,13961,13961,13961,13961,
+14124,14124,14124,14124,14124,14287,14287,14287,14287,14285,14285,14285,14285,14285,14285,14448,
+14448,14448,14448,14448,14448,14611,14611,14611,14611,14774,14611,14774,14611,14611,14774,14774,
+14774,14774,14774,14937,14774,14937,14774,14937,14937,14937,14937,14937,14937,14937,14937,14937,
+14937,14937,14937,0,155,795,1447,2099,2749,3401,3963,3963,4613,5265,5917,5905,
+6557,6557,7208,7208,7859,8511,7873,7873,8525,9176,9175,9175,9175,9827,9827,10479,
+10479,10467,10467,10467,10793,11119,11119,11445,11445,11771,11769,12095,11769,12095,12095,12421,
+12421,12421,12421,12747,12747,13073,13073,13073,13073,13073,13073,12983,12983,12983,12983,13309,
+12983,13309,13309,13309,13309,13635,13635,13635,13635,13635,13635,13635,13635,13635,13798,13961,
+13798,13961,13961,13961,13961,13961,14124,14124,14124,14287,14124,14287,14287,14287,14287,14285,
+14285,14285,14285,14285,14448,14448,14448,14448,14448,14448,14448,14611,14448,14448,14611,14611,
+14611,14611,14611,14774,14774,14774,14611,14774,14774,14774,14774,14774,14774,14937,14937,14937,
+14937,14937,14937,14937,0,155,795,1447,2097,2749,3401,3311,3963,4615,5265,5265,
+5917,5905,6557,6557,7208,7859,8511,8511,7873,8525,8525,9176,9176,9175,9175,9827,
+10479,10479,10479,10467,10467,10793,10793,11119,11119,11445,11445,11771,11445,11771,11769,12095,
+12095,12095,12095,12421,12421,12421,12747,12747,12747,13073,13073,13073,13073,13073,13073,12983,
+12983,12983,12983,12983,12983,13309,13309,13309,13309,13635,13635,13635,13635,13635,13635,13635,
+13635,13798,13798,13798,13798,13961,13798,13961,13961,13961,14124,14124,14124,14287,14124,14287,
+14287,14287,14287,14287,14287,14285,14285,14285,14285,14285,14448,14448,14448,14448,14285,14448,
+14448,14448,14448,14448,14611,14611,14611,14611,14611,14611,14611,14611,14611,14774,14774,14774,
+14774,14774,14774,14774,14774,0,807,795,1447,2099,2749,2749,3311,3311,3963,4615,
+5265,5265,5905,5905,6557,6557,7208,7859,8511,8511,7873,8525,8525,9176,9176,9175,
+9175,9827,9827,10479,10479,10479,10467,10793,10793,11119,11119,11119,11119,11445,11445,11771,
+11771,11769,11769,11769,12095,12095,12421,12421,12421,12747,12747,12747,12747,12747,12747,13073,
+13073,13073,13073,12983,12983,12983,12983,12983,12983,13309,13309,13309,13309,13309,13309,13635,
+13472,13635,13635,13798,13635,13798,13635,13798,13798,13798,13798,13961,13961,14124,13961,14124,
+14124,14124,14124,14287,14124,14287,14287,14287,14287,14287,14287,14285,14285,14285,14285,14285,
+14285,14285,14285,14448,14285,14448,14448,14448,14611,14611,14611,14611,14611,14611,14611,14611,
+14611,14611,14611,14611,14611,14774,0,155,795,1447,2099,2749,3401,3401,3311,3963,
+4615,5265,5917,5917,5905,5905,6557,7209,7859,7859,8511,7859,7873,8525,8525,9176,
+9176,9175,9175,9827,9827,10479,10153,10479,10479,10467,10793,10793,10793,11119,11119,11445,
+11445,11445,11771,11771,11769,11769,11769,12095,12095,12095,12421,12421,12421,12421,12421,12747,
+12747,12747,13073,13073,13073,13073,13073,12983,12983,12983,12983,12983,12983,12983,12983,13146,
+13309,13472,13472,13472,13472,13635,13635,13635,13635,13798,13635,13798,13798,13798,13961,13961,
+13961,13961,13961,14124,13961,13961,14124,14124,14124,14287,14124,14287,14287,14287,14287,14287,
+14287,14285,14285,14285,14285,14285,14285,14285,14448,14448,14448,14611,14448,14611,14611,14611,
+14611,14611,14611,14611,14611,14611,14611,0,155,795,1447,2099,2749,2749,3401,3311,
+3963,3963,4613,5265,5917,5917,5905,6557,7209,7209,7208,7208,7859,8511,7873,7873,
+8525,9176,9176,9175,9175,9827,9501,9827,10153,10153,10479,10467,10467,10793,10793,10793,
+11119,11119,11445,11445,11445,11771,11771,11769,11769,11769,12095,12095,12095,12421,12421,12421,
+12421,12421,12747,12747,12747,13073,13073,13073,13073,13073,13073,12983,12983,12983,12983,12983,
+12983,13146,13309,13309,13472,13472,13472,13472,13472,13472,13472,13635,13635,13635,13798,13798,
+13798,13798,13798,13961,13961,13798,13961,13961,13961,14124,13961,14124,14124,14124,14124,14287,
+14287,14287,14287,14287,14287,14287,14287,14285,14285,14285,14285,14285,14448,14448,14448,14448,
+14448,14611,14448,14611,14448,14448,14611,14611,0,807,795,795,1447,2099,2749,3401,
+3311,3311,3963,4615,5265,5265,5917,5917,5905,6557,7209,7209,7208,7859,8511,8511,
+7873,7873,8525,9176,9176,9176,9175,9501,9827,9827,9827,10153,10153,10479,10467,10467,
+10793,10793,10793,11119,11119,11445,11445,11771,11771,11771,11771,11769,11769,12095,12095,12095,
+12421,12421,12421,12421,12421,12421,12747,12747,13073,13073,12747,13073,13073,13073,13073,12983,
+12983,12983,13146,13146,13146,13309,13309,13309,13309,13309,13472,13472,13472,13635,13472,13635,
+13635,13635,13635,13635,13798,13798,13635,13798,13798,13961,13961,13961,13961,13961,13961,14124,
+14124,14124,14124,14287,14287,14287,14287,14287,14287,14287,14287,14287,14287,14285,14285,14285,
+14285,14285,14448,14448,14448,14448,14285,14448,14448,0,807,807,795,1447,2097,2749,
+3401,3401,3311,3963,4615,4615,5265,5265,5917,5905,6557,6557,7209,7209,7208,7859,
+8511,8511,7873,7873,8525,8525,8851,9176,9175,9501,9501,9827,9827,10153,10479,10479,
+10479,10467,10467,10793,10793,11119,11119,11445,11445,11445,11445,11771,11771,11769,11769,11769,
+11769,12095,12095,12421,12421,12421,12421,12421,12421,12747,12421,12747,12747,13073,13073,13073,
+13073,13073,13073,12983,12983,13146,13146,13146,13146,13146,13146,13309,13309,13309,13309,13472,
+13472,13472,13472,13635,13472,13635,13635,13635,13635,13635,13798,13798,13798,13798,13798,13961,
+13961,13961,13961,14124,14124,14124,14124,14124,14124,14287,14287,14287,14124,14287,14287,14287,
+14287,14287,14287,14285,14285,14285,14285,14285,14285,14285,0,807,795,795,1447,2099,
+2749,2749,3401,3311,3311,3963,4615,4613,5265,5917,5905,5905,6557,6557,7209,7208,
+7859,7859,8511,8511,7873,8199,8525,8851,8851,9176,9175,9501,9501,9827,9827,10153,
+10153,10479,10479,10467,10467,10793,10793,11119,11119,11119,11119,11445,11445,11771,11771,11769,
+11771,11769,11769,12095,12095,12095,12095,12421,12421,12421,12421,12421,12421,12747,12747,13073,
+13073,13073,13073,13073,12910,13073,12910,12983,12983,13146,12983,13146,13146,13146,13146,13309,
+13309,13472,13309,13472,13309,13472,13472,13472,13635,13635,13635,13635,13635,13635,13635,13635,
+13798,13798,13798,13961,13798,13961,13961,13961,13961,14124,14124,14124,13961,14124,14124,14124,
+14124,14287,14124,14287,14287,14287,14287,14287,14285,14285,14285,0,807,807,795,1447,
+2099,2749,3401,3401,3311,3311,3963,4615,4613,4613,5265,5917,5905,5905,6557,7209,
+7208,7209,7208,7859,8511,8511,7873,8199,8525,8851,8851,9176,9176,9501,9501,9827,
+9827,10153,10153,10479,10479,10467,10467,10467,10793,10793,10793,11119,11119,11445,11445,11445,
+11445,11771,11771,11769,11769,12095,11769,12095,12095,12421,12421,12421,12421,12421,12421,12421,
+12747,12747,12747,13073,13073,12910,12910,12910,12910,13073,13073,12983,12983,12983,12983,13146,
+13146,13146,13146,13309,13309,13309,13309,13472,13309,13472,13472,13635,13635,13635,13635,13635,
+13635,13635,13635,13798,13798,13798,13798,13961,13798,13961,13798,13961,13961,13961,13961,13961,
+13961,14124,13961,14124,14124,14124,14124,14287,14287,14287,14287,14287,0,155,807,795,
+1447,2099,2749,2749,3401,3401,3311,3963,4615,4615,4613,5265,5917,5917,5905,5905,
+6557,6557,7209,7208,7859,7859,8511,8511,8199,8525,8525,8851,8851,8851,9175,9501,
+9501,9827,9827,10153,10153,10153,10479,10479,10467,10467,10467,10793,10793,10793,11119,11119,
+11119,11445,11445,11771,11771,11771,11771,11769,11769,12095,12095,12095,12095,12095,12421,12421,
+12421,12421,12421,12747,12584,12584,12747,12747,12747,12910,12910,13073,13073,13073,13073,12983,
+12983,12983,12983,13146,13146,13146,13146,13146,13146,13309,13472,13472,13472,13635,13472,13635,
+13472,13635,13635,13635,13635,13635,13635,13798,13635,13798,13798,13798,13798,13961,13961,13961,
+13961,13961,13961,13961,13961,13961,13961,14124,14124,14124,14287,14287,14287,0,807,807,
+795,1447,2099,2099,2097,2749,3401,3311,3963,3963,4615,4613,5265,5265,5917,5917,
+5905,5905,6557,7209,7208,7208,7859,7859,8185,8185,8199,8199,8525,8525,8851,9176,
+9176,9501,9501,9501,9501,9827,10153,10153,10153,10479,10479,10467,10467,10467,10793,10793,
+11119,11119,11119,11119,11445,11445,11445,11771,11771,11769,11769,11769,11769,11769,12095,12095,
+12095,12421,12421,12421,12421,12421,12584,12584,12584,12747,12747,12747,12910,12910,12910,13073,
+12910,13073,13073,12983,12983,12983,12983,12983,12983,13146,13146,13309,13309,13309,13309,13472,
+13472,13472,13472,13635,13635,13635,13635,13635,13635,13635,13635,13635,13635,13798,13798,13798,
+13798,13798,13961,13961,13961,13961,13961,13961,13961,13961,13961,14124,14124,14124,0,155,
+807,795,1447,2099,2097,2097,2749,3401,3311,3311,3963,3963,4615,4613,5265,5917,
+5917,5905,5905,5905,6557,7209,7208,7533,7533,7859,8185,8185,8199,8199,8199,8525,
+8851,8851,9176,9175,9175,9501,9501,9827,9827,10153,10153,10479,10479,10467,10467,10467,
+10793,10793,11119,11119,11119,11119,11119,11445,11445,11445,11771,11771,11771,11769,11769,11769,
+11769,12095,12095,12095,12421,12421,12258,12421,12421,12421,12584,12584,12747,12747,12747,12910,
+12910,12910,12910,13073,13073,13073,13073,12983,12983,12983,12983,13146,13146,13146,13146,13309,
+13309,13309,13309,13309,13309,13472,13472,13472,13635,13635,13635,13635,13635,13635,13635,13635,
+13635,13798,13798,13798,13798,13798,13798,13961,13961,13961,13961,13961,13961,13961,13961,0,
+155,807,795,1447,2099,2099,2097,2749,3401,3401,3311,3311,3963,4615,4613,5265,
+5917,5917,5917,5905,5905,6231,7209,6883,7208,7208,7533,7859,8185,8185,7873,8199,
+8525,8525,8851,8851,9176,9175,9175,9501,9501,9827,9827,10153,10153,10479,10479,10479,
+10467,10467,10793,10793,10793,11119,11119,11119,11119,11119,11445,11445,11771,11771,11771,11771,
+11769,11769,11769,11769,11769,12095,12095,12258,12258,12258,12421,12421,12421,12584,12584,12584,
+12747,12747,12747,12910,12747,12910,12910,13073,13073,13073,13073,12983,12983,12983,12983,13146,
+13146,13146,13146,13146,13309,13309,13309,13472,13309,13472,13472,13472,13472,13472,13635,13635,
+13635,13635,13635,13635,13635,13635,13635,13798,13798,13798,13798,13961,13961,13961,13961,13961,
+0,155,807,795,1447,1447,2099,2097,2749,3401,3401,3311,3311,3963,4615,4615,
+4613,5265,5917,5917,5905,5905,6557,6557,6883,6883,7208,7533,7859,7859,8185,8185,
+8199,8199,8199,8525,8851,8851,9176,9175,9175,9501,9501,9827,9827,10153,10153,10479,
+10479,10479,10479,10467,10467,10793,10793,11119,11119,11119,11119,11119,11445,11445,11445,11771,
+11771,11771,11771,11769,11769,11769,11932,12095,12095,12095,12095,12258,12258,12421,12421,12421,
+12584,12584,12584,12747,12584,12747,12747,12910,12910,13073,12910,13073,13073,13073,13073,12983,
+12983,12983,12983,12983,12983,13146,13146,13309,13146,13309,13309,13309,13309,13472,13309,13472,
+13472,13635,13635,13635,13635,13635,13635,13635,13635,13635,13635,13798,13798,13798,13798,13961,
+13798,0,155,807,795,1447,2099,2099,2097,2097,3401,3401,3311,3311,3963,3963,
+4615,4613,5265,5265,5917,5591,5905,6231,6557,6557,6883,7209,7533,7533,7859,7859,
+8185,8185,7873,8199,8199,8525,8851,9176,9176,9175,9175,9175,9501,9827,9827,10153,
+10153,10153,10153,10479,10479,10467,10467,10793,10467,10793,10793,11119,11119,11119,11119,11445,
+11445,11771,11771,11771,11771,11771,11769,11932,11932,11932,11932,12095,12095,12258,12258,12258,
+12258,12421,12421,12421,12584,12584,12584,12747,12747,12910,12747,12910,12910,12910,12910,13073,
+12910,13073,13073,12983,12983,12983,12983,12983,13146,13146,13146,13309,13146,13309,13146,13309,
+13309,13309,13472,13472,13472,13635,13472,13635,13635,13635,13635,13635,13635,13635,13635,13798,
+13798,13798,0,807,807,795,795,1447,2099,2099,2097,2749,3401,3401,3311,3311,
+3963,4615,4613,4613,4939,5265,5591,5917,6231,6231,6557,6557,6883,7209,7533,7533,
+7859,7859,8185,8185,8199,8199,8525,8851,8851,8851,9176,9176,9175,9501,9501,9827,
+9827,9827,9827,10153,10153,10479,10479,10467,10467,10467,10467,10793,10793,11119,11119,11119,
+11119,11119,11445,11445,11445,11771,11771,11771,11608,11769,11769,11932,11932,12095,12095,12258,
+12095,12258,12258,12258,12421,12421,12421,12584,12584,12584,12747,12747,12747,12910,12747,12910,
+12910,12910,12910,13073,13073,13073,13073,12983,12983,12983,12983,12983,12983,13146,13146,13146,
+13146,13309,13309,13309,13309,13309,13472,13472,13472,13472,13472,13635,13472,13635,13635,13635,
+13635,13635,13635,0,807,807,795,795,1447,2099,2097,2097,2749,3401,3401,3311,
+3311,3637,3963,4289,4613,4939,5265,5591,5917,5917,6231,6231,6557,6883,7209,7209,
+7533,7533,7859,7859,8185,8185,7873,8199,8525,8525,8851,8851,8851,9175,9175,9175,
+9501,9501,9827,9827,9827,10153,10153,10153,10479,10479,10467,10467,10467,10793,10793,10793,
+11119,11119,11119,11119,11119,11445,11445,11445,11445,11608,11608,11771,11771,11932,11932,11932,
+11932,12095,12095,12258,12095,12258,12258,12258,12421,12421,12584,12584,12584,12747,12747,12584,
+12747,12747,12747,12910,12910,13073,13073,13073,13073,13073,13073,12983,12983,12983,12983,12983,
+12983,12983,13146,13309,13309,13309,13309,13309,13309,13309,13309,13309,13472,13472,13472,13635,
+13472,13635,13635,13635,0,155,807,795,795,1447,2099,2099,2097,2749,3401,3401,
+3311,3311,3637,3963,4289,4613,4939,4939,5265,5591,5917,5905,6231,6557,6557,6557,
+6883,7209,7533,7533,7859,8185,8185,8185,8199,8199,8199,8525,8525,8851,9176,9176,
+9175,9175,9175,9827,9827,9827,9827,9827,10153,10479,10479,10479,10479,10467,10467,10467,
+10793,10793,10793,11119,11119,11119,11119,11119,11282,11445,11445,11608,11608,11608,11771,11769,
+11769,11932,11932,12095,11932,12095,12095,12095,12258,12258,12258,12421,12421,12421,12584,12584,
+12584,12584,12584,12747,12747,12747,12910,12910,12910,13073,12910,13073,13073,13073,13073,12983,
+12983,12983,12983,13146,13146,13309,13146,13309,13309,13309,13309,13309,13309,13309,13309,13472,
+13309,13472,13472,13472,13472,0,807,807,795,795,1447,1447,2099,2423,2749,3401,
+3401,3401,3637,3637,4289,4289,4615,4613,4939,5265,5591,5591,5905,5905,6231,6231,
+6557,6883,7209,7208,7533,7533,7859,7859,8185,8185,7873,8199,8199,8525,8851,8851,
+8851,9176,9176,9175,9501,9501,9827,9827,9827,10153,10153,10153,10479,10479,10479,10467,
+10467,10467,10467,10793,10793,10793,11119,11119,11119,11282,11282,11282,11445,11445,11608,11608,
+11608,11771,11771,11769,11932,11932,11932,11932,11932,12095,12095,12258,12258,12258,12421,12421,
+12421,12421,12421,12421,12584,12584,12747,12747,12747,12910,12747,12910,12910,13073,13073,13073,
+13073,13073,13073,12983,12983,13146,12983,13146,13146,13146,13146,13309,13146,13309,13309,13309,
+13309,13309,13309,13472,13309,13472,0,155,807,481,1121,1447,1773,1773,2423,2423,
+2749,2749,3075,3311,3637,3963,4289,4289,4613,4939,5265,5265,5591,5917,5905,5905,
+6231,6557,6883,6883,7209,7208,7208,7533,7859,7859,8185,8185,7873,8199,8199,8525,
+8525,8851,8851,9176,9175,9175,9175,9501,9501,9827,9827,9827,10153,10153,10153,10479,
+10479,10479,10467,10467,10467,10467,10467,10793,10793,11119,11119,11119,11282,11282,11282,11445,
+11445,11445,11608,11608,11771,11769,11771,11769,11769,11932,11932,12095,12095,12095,12095,12258,
+12258,12421,12421,12421,12421,12421,12421,12584,12584,12584,12747,12747,12747,12910,12747,12910,
+12910,13073,13073,13073,13073,13073,13073,12983,12983,12983,12983,13146,12983,13146,13146,13146,
+13309,13309,13309,13309,13309,13309,13309,0,155,481,795,1121,1447,1447,1773,2099,
+2423,2749,3075,3075,3311,3637,3963,3963,4289,4289,4613,4939,5265,5591,5917,5917,
+5905,5905,6231,6557,6883,6883,7209,7208,7533,7533,7859,7859,8185,8511,7873,8199,
+8199,8525,8525,8851,8851,9176,9176,9175,9175,9501,9827,9827,9827,9827,9827,9827,
+10153,10479,10479,10479,10479,10467,10467,10467,10467,10630,10956,10956,10956,11119,11119,11282,
+11282,11282,11445,11445,11445,11608,11771,11771,11771,11769,11769,11932,11932,11932,11932,12095,
+12095,12258,12258,12258,12258,12421,12421,12421,12421,12421,12584,12584,12584,12747,12584,12747,
+12747,12910,12910,13073,12910,13073,12910,12910,13073,13073,13073,12983,12983,12983,12983,12983,
+12983,13146,13146,13146,13309,13309,13309,13309,0,155,481,807,1121,1121,1447,1773,
+2097,2423,2749,2749,3075,3401,3637,3637,3963,3963,4289,4613,4939,5265,5591,5591,
+5917,5917,5905,6231,6557,6557,6883,6883,7209,7208,7533,7533,7859,8185,8185,8185,
+7873,8199,8525,8525,8525,8851,8851,9176,9176,9175,9175,9501,9501,9827,9827,9827,
+9827,10153,10153,10479,10479,10479,10479,10467,10467,10467,10630,10793,10793,10956,10956,11119,
+11119,11282,11119,11282,11282,11445,11608,11608,11608,11771,11771,11769,11769,11769,11769,11932,
+11932,12095,12095,12095,12095,12258,12258,12421,12421,12421,12421,12421,12421,12421,12421,12584,
+12584,12747,12747,12910,12747,12910,12747,12747,12910,12910,12910,13073,13073,13073,13073,12983,
+12983,12983,12983,12983,12983,13146,13146,13146,13146,0,155,481,807,1121,1447,1447,
+1773,2099,2423,2423,2749,3075,3401,3311,3637,3637,3963,4289,4613,4613,4939,5265,
+5591,5591,5917,5905,6231,6231,6557,6557,6883,7209,7208,7208,7533,7533,7859,7859,
+8185,8511,8199,8199,8525,8525,8525,8851,8851,9176,9176,9175,9175,9501,9501,9501,
+9827,9827,9827,9827,10153,10153,10479,10479,10479,10467,10467,10467,10630,10793,10793,10956,
+10956,11119,10956,11119,11119,11282,11282,11445,11445,11608,11608,11608,11771,11771,11771,11769,
+11769,11932,11932,11932,11932,12095,12095,12258,12258,12258,12258,12421,12421,12421,12421,12421,
+12421,12584,12584,12584,12747,12747,12747,12747,12747,12747,12747,12747,12910,12910,13073,13073,
+13073,13073,13073,12983,12983,12983,12983,12983,12983,12983,0,155,481,807,1121,1121,
+1447,1773,2099,2423,2749,2749,3075,3401,3311,3311,3637,3963,4289,4289,4613,4939,
+5265,5265,5591,5591,5917,5905,6231,6231,6557,6883,7209,7209,7208,7208,7533,7533,
+7859,8185,8511,8185,8199,8525,8525,8525,8525,8525,8851,9176,9176,9175,9175,9501,
+9175,9501,9827,9827,9827,9827,10153,10479,10479,10479,10479,10479,10467,10630,10630,10793,
+10793,10793,10793,10956,10956,11119,11119,11282,11282,11282,11445,11445,11608,11608,11608,11771,
+11771,11771,11769,11769,11769,11932,11932,12095,12095,12095,12095,12258,12258,12258,12258,12421,
+12421,12421,12421,12421,12584,12584,12584,12747,12584,12747,12747,12747,12747,12747,12747,12910,
+12910,12910,13073,13073,13073,13073,13073,12983,12983,12983,12983,0,155,481,807,795,
+1121,1447,1773,1773,2423,2423,2749,2749,3075,3401,3311,3637,3963,3963,4289,4615,
+4939,4939,4939,5265,5591,5917,5905,5905,6231,6231,6557,6883,6883,7209,7208,7208,
+7533,7533,7859,7859,8185,8185,8199,8199,8525,8525,8525,8525,8851,9176,9176,9176,
+9175,9175,9501,9501,9501,9827,9827,9827,10153,10153,10479,10479,10153,10479,10479,10467,
+10630,10630,10630,10793,10793,10956,10956,10956,11119,11119,11282,11282,11282,11445,11445,11445,
+11608,11608,11771,11771,11771,11769,11769,11769,11932,11932,11932,12095,12095,12258,12095,12258,
+12258,12258,12421,12421,12421,12421,12421,12421,12421,12584,12584,12747,12584,12747,12747,12747,
+12747,12747,12910,12910,12910,13073,13073,13073,13073,13073,13073,12983,0,155,481,807,
+795,1121,1447,1447,1773,2099,2423,2749,3075,3075,3401,3311,3637,3637,3963,3963,
+4615,4615,4613,4939,5265,5591,5917,5917,5905,5905,6231,6231,6557,6883,7209,7209,
+7208,7208,7533,7859,7859,7859,8185,8185,8199,8199,8199,8525,8525,8525,8851,8851,
+9176,9176,9175,9175,9175,9501,9501,9827,9827,9827,9827,10153,9990,10153,10316,10316,
+10479,10467,10467,10630,10630,10630,10793,10793,10956,10956,10956,11119,11119,11282,11282,11282,
+11445,11445,11445,11608,11608,11608,11771,11771,11769,11769,11769,11932,11932,11932,11932,12095,
+12095,12095,12095,12258,12258,12421,12421,12421,12421,12421,12421,12584,12421,12584,12584,12747,
+12747,12747,12747,12747,12747,12747,12910,12910,12910,13073,13073,13073,13073,0,481,481,
+807,795,1121,1121,1447,1773,2097,2423,2749,2749,3075,3401,3311,3311,3637,3963,
+4289,4289,4613,4613,4939,4939,5265,5591,5917,5917,5905,5905,6231,6231,6557,6883,
+7209,7209,7208,7533,7533,7533,7859,7859,8185,8185,7873,8199,8525,8525,8525,8525,
+8851,9176,9176,9176,9175,9175,9175,9501,9501,9827,9827,9827,9990,9990,10153,10153,
+10153,10316,10316,10479,10467,10467,10630,10630,10630,10793,10793,10956,10956,11119,11119,11119,
+11119,11282,11282,11445,11445,11445,11608,11608,11608,11771,11771,11771,11769,11769,11932,11932,
+11769,11932,11932,12095,12095,12258,12258,12258,12258,12421,12421,12421,12421,12421,12421,12584,
+12584,12747,12584,12747,12747,12747,12747,12747,12747,12910,12910,12910,13073,13073,0,155,
+481,807,795,1121,1447,1447,1773,2099,2423,2423,2749,3075,3401,3401,3311,3637,
+3963,4289,4615,4615,4613,4613,4939,5265,5591,5591,5917,5917,5905,5905,6231,6557,
+6883,6883,7209,7209,7208,7208,7533,7859,7859,7859,8185,8185,8199,8199,8199,8525,
+8525,8525,8851,9176,9176,9176,9176,9175,9175,9501,9501,9827,9664,9827,9827,9990,
+9990,10153,10153,10316,10479,10479,10479,10467,10467,10630,10630,10793,10793,10956,10956,11119,
+10956,11119,11119,11282,11282,11282,11282,11445,11445,11608,11608,11608,11771,11771,11771,11769,
+11769,11769,11769,11932,11932,12095,11932,12095,12095,12258,12258,12258,12258,12421,12421,12421,
+12421,12421,12421,12584,12584,12584,12584,12747,12747,12747,12747,12747,12910,12910,12747,0,
+155,481,807,795,1121,1121,1447,1773,2099,2097,2749,2749,3075,3075,3401,3311,
+3637,3637,3963,4289,4615,4615,4613,4939,5265,5265,5591,5917,5917,5905,5905,6231,
+6557,6557,6557,6883,7209,7209,7208,7533,7859,7859,7859,7859,8185,8185,7873,8199,
+8525,8525,8525,8851,8851,9176,9176,9176,9175,9175,9175,9501,9501,9664,9664,9827,
+9827,9990,9990,10153,10153,10316,10316,10479,10479,10467,10467,10630,10630,10793,10793,10793,
+10793,10956,10956,11119,11119,11282,11119,11282,11282,11445,11445,11608,11445,11608,11608,11771,
+11771,11771,11769,11769,11769,11932,11932,11932,11932,12095,12095,12095,12095,12258,12258,12258,
+12421,12421,12421,12421,12421,12584,12421,12584,12584,12584,12747,12747,12747,12747,12747,12747,
+0,155,481,481,795,795,1121,1447,1773,2099,2097,2097,2423,2749,3075,3401,
+3311,3311,3637,3963,4289,4289,4615,4615,4613,4939,5265,5591,5917,5917,5905,5905,
+5905,6231,6557,6557,6883,6883,7209,7209,7208,7533,7859,7859,7859,7859,8185,8185,
+7873,8199,8199,8525,8525,8525,8851,8851,9176,9176,9176,9175,9338,9338,9501,9664,
+9664,9827,9827,9990,9990,10153,10153,10316,10316,10479,10479,10467,10467,10467,10630,10630,
+10630,10793,10793,10956,10956,11119,11119,11119,11119,11282,11282,11445,11282,11445,11445,11608,
+11771,11771,11771,11771,11771,11769,11769,11769,11769,11932,11932,12095,12095,12095,12095,12095,
+12258,12258,12258,12421,12421,12421,12421,12421,12421,12421,12421,12584,12584,12747,12747,12747,
+12747,0,155,481,807,795,1121,1121,1447,1773,2099,2099,2097,2423,2749,3075,
+3401,3401,3311,3637,3963,3963,4289,4289,4615,4613,4939,5265,5591,5591,5917,5917,
+5905,5905,6231,6557,6557,6557,6883,6883,7209,7208,7533,7533,7859,7859,7859,7859,
+8185,8511,7873,8199,8525,8525,8525,8525,8525,9176,9176,9176,9176,9175,9338,9501,
+9501,9664,9664,9664,9827,9990,9990,10153,10153,10316,10316,10316,10479,10479,10467,10467,
+10467,10630,10630,10630,10793,10793,10956,11119,11119,11119,11119,11119,11119,11282,11282,11445,
+11445,11608,11608,11608,11771,11771,11771,11769,11771,11769,11769,11932,11932,12095,12095,12095,
+12095,12095,12095,12258,12258,12258,12258,12421,12421,12421,12421,12421,12421,12584,12584,12584,
+12584,12584,0,155,481,807,795,795,1121,1447,1773,2099,2097,2097,2423,2749,
+3075,3075,3401,3311,3311,3637,3963,3963,4615,4615,4613,4613,4939,5265,5591,5591,
+5591,5917,5905,5905,6231,6557,6557,6557,6883,7209,7208,7209,7208,7533,7859,7859,
+7859,7859,8185,8185,8199,8199,8199,8525,8525,8525,8851,8851,8851,9013,9013,9175,
+9338,9338,9501,9501,9664,9827,9827,9990,9990,9990,9990,10153,10316,10316,10316,10479,
+10479,10467,10467,10467,10630,10630,10793,10956,10956,10956,11119,11119,11119,11119,11119,11282,
+11282,11282,11445,11445,11608,11608,11608,11771,11771,11771,11771,11769,11769,11932,11769,11932,
+11932,12095,12095,12095,12095,12095,12095,12258,12258,12258,12258,12421,12421,12421,12421,12584,
+12421,12584,12421,0,155,481,807,807,795,1121,1447,1773,2099,2099,2097,2423,
+2749,3075,3401,3401,3311,3311,3637,3963,4289,4289,4615,4615,4613,4939,5265,5265,
+5265,5591,5917,5917,5905,6231,6557,6557,6557,6557,6883,6883,7209,7208,7533,7533,
+7859,7859,7859,7859,8185,8185,7873,8199,8199,8525,8525,8525,8688,8851,8851,9013,
+9176,9175,9338,9338,9338,9501,9664,9664,9827,9827,9827,9990,9990,10153,10153,10316,
+10316,10479,10479,10467,10467,10467,10630,10630,10793,10793,10956,10956,10956,11119,11119,11119,
+11119,11119,11282,11282,11282,11445,11445,11608,11608,11608,11771,11771,11608,11769,11771,11769,
+11769,11932,11932,12095,11932,12095,12095,12095,12095,12095,12095,12258,12258,12421,12421,12421,
+12421,12421,12421,12421,0,155,481,807,795,795,1121,1447,1773,1773,2099,2097,
+2423,2749,3075,3075,3401,3401,3311,3311,3637,3963,4289,4289,4615,4613,4939,4939,
+5265,5265,5591,5591,5917,5905,6231,6231,6557,6557,6557,6557,6883,7209,7208,7208,
+7533,7533,7859,7859,7859,7859,8185,8185,7873,8199,8199,8525,8362,8525,8688,8851,
+9013,9013,9013,9175,9175,9338,9501,9501,9664,9664,9664,9827,9827,9990,9990,10153,
+10153,10316,10316,10479,10479,10479,10467,10467,10630,10630,10630,10793,10793,10793,10956,10956,
+11119,11119,11119,11119,11119,11282,11282,11445,11445,11445,11445,11608,11445,11608,11608,11771,
+11771,11769,11769,11932,11769,11932,11932,12095,12095,12095,12095,12095,12095,12095,12258,12258,
+12258,12421,12421,12421,12421,0,155,481,807,807,795,795,1447,1447,1773,2099,
+2097,2097,2423,2749,3075,3401,3401,3311,3311,3637,3963,3963,4289,4289,4615,4613,
+4939,5265,5265,5265,5591,5591,5917,5905,6231,6231,6557,6557,6557,6557,6883,7209,
+7208,7208,7208,7533,7859,7859,7859,7859,8185,8511,7873,8199,8199,8362,8525,8688,
+8688,8851,8851,9013,9013,9176,9338,9338,9338,9501,9501,9501,9664,9827,9827,9990,
+9990,10153,10153,10316,10316,10479,10479,10479,10479,10467,10467,10630,10630,10793,10793,10793,
+10793,10956,11119,11119,11119,11119,11119,11282,11282,11282,11282,11445,11445,11445,11608,11608,
+11608,11771,11771,11771,11769,11769,11769,11932,11769,11932,11932,11932,12095,12095,12095,12095,
+12095,12258,12258,12258,12421,12421,0,155,481,807,807,795,1121,1121,1447,1773,
+2099,2099,2097,2423,2749,3075,3401,3401,3311,3311,3637,3963,3963,3963,4289,4615,
+4613,4939,5265,5265,5265,5265,5591,5917,5905,5905,6231,6231,6557,6557,6557,6883,
+7209,7209,7208,7208,7208,7533,7859,7859,7859,8185,8511,8185,8036,8199,8362,8525,
+8525,8688,8688,8851,8851,9013,9013,9175,9175,9338,9338,9338,9501,9664,9664,9827,
+9827,9827,9990,10153,10153,10316,10316,10316,10316,10479,10479,10467,10467,10630,10467,10630,
+10630,10793,10793,10956,10956,11119,11119,11119,11119,11119,11119,11282,11282,11445,11445,11445,
+11445,11445,11608,11608,11771,11771,11771,11769,11769,11769,11769,11769,11932,11932,11932,12095,
+12095,12095,12095,12095,12258,12258,12258,0,155,481,807,807,795,795,1121,1447,
+1773,2099,2097,2097,2423,2749,3075,3075,3401,3401,3311,3637,3963,3963,3963,4289,
+4615,4615,4613,4939,5265,5265,5265,5591,5917,5917,5905,5905,6231,6231,6557,6557,
+6883,6883,7209,7209,7208,7208,7533,7533,7859,7859,7859,7859,8185,8511,8199,8199,
+8362,8525,8525,8688,8688,8851,8851,9013,9013,9176,9175,9338,9175,9501,9501,9501,
+9664,9664,9827,9990,9990,10153,10153,10153,10153,10316,10316,10479,10479,10467,10467,10467,
+10467,10630,10630,10793,10793,10956,10956,10956,11119,11119,11119,11119,11119,11282,11282,11445,
+11445,11445,11445,11445,11445,11608,11608,11608,11771,11771,11769,11769,11769,11769,11769,11932,
+11932,11932,12095,12095,12095,12095,12095,12095,0,155,481,807,807,795,795,1121,
+1447,1773,2099,2099,2097,2423,2749,2749,3401,3075,3401,3311,3637,3637,3963,3963,
+4289,4289,4615,4613,4939,4939,5265,5265,5591,5591,5917,5917,5905,5905,6231,6231,
+6557,6557,6883,6883,7209,7209,7208,7208,7533,7533,7859,7859,7859,8185,8511,8185,
+8199,8199,8362,8525,8525,8525,8688,8688,8851,9013,9013,9176,9176,9175,9338,9338,
+9501,9501,9501,9827,9827,9827,9990,9990,9990,10153,10153,10316,10316,10316,10479,10479,
+10467,10467,10467,10630,10630,10630,10793,10793,10956,10956,10956,11119,11119,11119,11119,11119,
+11282,11282,11282,11445,11445,11445,11445,11445,11608,11608,11771,11771,11771,11771,11769,11769,
+11769,11932,11769,11932,11932,12095,12095,12095,12095,0,155,481,807,807,795,795,
+1121,1447,1773,1773,2099,2097,2423,2749,2749,2749,3075,3075,3311,3311,3637,3963,
+3963,3963,4289,4615,4613,4613,4939,5265,5265,5265,5591,5917,5917,5917,5905,5905,
+6231,6557,6557,6557,6883,6883,7209,7209,7208,7208,7533,7533,7859,7859,7859,8022,
+8185,8185,8199,8199,8362,8362,8525,8525,8688,8851,8851,8851,9013,9176,9175,9175,
+9175,9338,9338,9501,9664,9664,9827,9827,9827,9990,9990,9990,10153,10153,10316,10479,
+10479,10479,10479,10467,10467,10467,10630,10630,10630,10793,10793,10793,10956,10956,10956,11119,
+11119,11119,11119,11282,11282,11445,11445,11445,11445,11445,11608,11608,11608,11771,11771,11771,
+11771,11769,11769,11769,11769,11932,11932,12095,11932,12095,0,155,155,481,807,795,
+1121,1121,1447,1447,1773,2099,2097,2097,2423,2749,2749,3075,3401,3401,3311,3637,
+3963,3963,3963,3963,4289,4615,4613,4939,5265,5265,5265,5265,5591,5917,5917,5905,
+5905,6231,6557,6557,6557,6557,6883,7209,7209,7209,7208,7208,7533,7533,7696,7859,
+8022,8022,8185,8185,8199,8199,8199,8362,8525,8525,8688,8688,8851,9013,9013,9176,
+9176,9175,9175,9338,9501,9501,9501,9664,9664,9827,9827,9827,9990,9990,9990,10153,
+10316,10316,10479,10479,10479,10467,10467,10467,10467,10630,10630,10630,10793,10793,10793,10956,
+11119,11119,11119,11119,11119,11282,11119,11282,11282,11445,11445,11445,11445,11608,11608,11771,
+11771,11771,11771,11771,11769,11769,11769,11932,11769,11932,11932,0,155,155,481,807,
+795,1121,1447,1447,1447,1773,2099,2099,2097,2423,2749,2749,3075,3075,3401,3311,
+3637,3637,3963,3963,3963,4289,4615,4613,4939,4939,5265,5265,5265,5265,5591,5917,
+5905,5905,5905,6231,6557,6557,6557,6557,6883,6883,7209,7209,7208,7371,7533,7696,
+7859,7696,7859,8022,8185,8185,8036,8199,8362,8362,8525,8525,8688,8851,8851,9013,
+9013,9176,9176,9175,9175,9338,9338,9501,9501,9664,9827,9827,9827,9827,9827,9990,
+10153,10153,10316,10316,10316,10479,10479,10479,10467,10467,10467,10630,10467,10630,10630,10793,
+10793,10956,10956,11119,11119,11119,11119,11119,11119,11282,11282,11445,11445,11445,11445,11445,
+11608,11608,11608,11771,11771,11771,11771,11769,11769,11769,11769,11932,0,155,155,481,
+807,795,1121,1121,1447,1447,1773,2099,2097,2097,2423,2749,2749,2749,3075,3401,
+3311,3311,3637,3637,3963,3963,4289,4289,4615,4613,4939,4939,5265,5265,5591,5591,
+5917,5917,5905,5905,6231,6231,6557,6557,6557,6557,6883,7209,7209,7208,7371,7371,
+7533,7533,7696,7859,8022,8022,8185,8185,8036,8199,8199,8362,8525,8525,8688,8851,
+8851,9013,9013,9176,9176,9175,9175,9338,9338,9501,9501,9664,9664,9827,9827,9827,
+9990,9990,9990,10153,10153,10153,10316,10479,10479,10479,10479,10467,10467,10467,10467,10630,
+10793,10793,10793,10956,10956,10956,11119,11119,11119,11119,11119,11282,11282,11282,11445,11445,
+11445,11445,11445,11608,11608,11608,11771,11771,11771,11771,11771,11769,11769,0,155,155,
+481,807,795,795,1121,1447,1447,1773,2099,2099,2097,2423,2749,2749,3075,3075,
+3401,3401,3311,3311,3963,3963,3963,3963,4289,4615,4613,4613,4939,4939,5265,5265,
+5591,5591,5917,5917,5905,5905,6231,6231,6557,6557,6557,6883,7209,6883,7046,7209,
+7371,7371,7533,7696,7859,7859,8022,8022,8185,8185,8036,8199,8362,8362,8525,8688,
+8688,8851,8851,8851,9013,9176,9176,9175,9175,9338,9338,9501,9501,9664,9664,9827,
+9827,9827,9827,9990,9990,10153,10153,10316,10316,10479,10479,10479,10479,10467,10467,10467,
+10630,10793,10793,10793,10793,10793,10956,10956,10956,11119,11119,11119,11119,11282,11282,11282,
+11282,11445,11445,11445,11445,11445,11608,11608,11608,11771,11771,11771,11771,11769,0,155,
+155,481,807,795,1121,1121,1447,1447,1773,1773,2099,2097,2423,2423,2749,2749,
+3075,3075,3401,3311,3311,3637,3963,3963,3963,4289,4615,4615,4613,4613,4939,5265,
+5265,5265,5591,5591,5917,5917,5905,5905,6231,6231,6557,6557,6720,6720,7046,7046,
+7209,7208,7371,7371,7533,7696,7859,7859,8022,8022,8185,8185,8199,8199,8199,8362,
+8525,8525,8688,8688,8851,9013,9013,9176,9013,9176,9175,9338,9338,9501,9501,9664,
+9664,9827,9827,9827,9827,9827,9990,10153,10153,10153,10316,10316,10479,10479,10479,10467,
+10467,10467,10630,10630,10793,10793,10793,10793,10793,10793,10956,10956,11119,11119,11119,11119,
+11119,11282,11282,11445,11445,11445,11445,11445,11445,11608,11608,11608,11771,11771,11771,0,
+155,481,481,807,795,795,1121,1121,1447,1447,1773,2099,2097,2097,2423,2749,
+2749,3075,3401,3401,3311,3311,3637,3637,3963,3963,4289,4289,4615,4613,4613,4939,
+5265,5265,5265,5265,5591,5917,5917,5905,5905,5905,6231,6231,6394,6720,6883,6883,
+7046,7046,7209,7208,7371,7533,7696,7696,7859,7859,8022,8022,8185,8185,8036,8199,
+8362,8362,8525,8525,8525,8688,8851,8851,8851,9013,9176,9176,9175,9338,9338,9338,
+9501,9664,9664,9827,9827,9827,9827,9827,9990,9990,10153,10153,10153,10479,10479,10479,
+10479,10479,10467,10467,10467,10630,10630,10793,10793,10793,10793,10793,10793,10956,10956,11119,
+11119,11119,11119,11282,11119,11282,11282,11445,11445,11445,11445,11445,11445,11608,11608,11771,
+0,155,481,481,807,807,795,1121,1447,1447,1447,1773,2099,2099,2097,2423,
+2749,2749,3075,3075,3401,3401,3311,3311,3637,3963,3963,4289,4615,4615,4613,4613,
+4613,4939,5265,5265,5265,5591,5917,5917,5917,5905,5905,6068,6231,6394,6557,6557,
+6720,6883,7046,7046,7208,7371,7533,7371,7533,7696,7859,7859,8022,8022,8185,8185,
+8199,8199,8199,8362,8362,8525,8688,8688,8688,8851,8851,9013,9176,9176,9175,9175,
+9338,9338,9501,9664,9664,9664,9664,9827,9827,9827,9827,9990,9990,10153,10316,10316,
+10479,10479,10316,10479,10479,10467,10467,10630,10630,10630,10630,10793,10793,10793,10793,10956,
+10956,11119,11119,11119,11119,11119,11119,11282,11282,11445,11282,11445,11445,11445,11445,11608,
+11608,0,155,155,481,807,795,795,1121,1121,1447,1447,1773,2099,2097,2097,
+2423,2749,2749,2749,3075,3401,3401,3311,3311,3637,3963,3963,4289,4289,4615,4615,
+4613,4613,4939,4939,5265,5265,5591,5591,5917,5917,5905,5905,6231,6231,6394,6394,
+6557,6720,6883,6883,7046,7046,7208,7208,7371,7533,7696,7696,7859,7859,8022,8022,
+8185,8185,8036,8199,8199,8362,8525,8525,8525,8688,8688,8851,9013,9013,9176,9176,
+9176,9175,9338,9338,9501,9501,9501,9664,9664,9827,9827,9827,9827,9990,10153,10153,
+10153,10316,10153,10153,10316,10479,10479,10467,10467,10467,10467,10630,10630,10793,10793,10793,
+10793,10956,10956,10956,11119,11119,11119,11119,11119,11282,11119,11282,11282,11445,11445,11445,
+11445,11445,0,155,481,481,807,807,795,795,1121,1447,1447,1773,2099,2099,
+2097,2423,2423,2749,2749,3075,3401,3401,3311,3311,3637,3637,3963,3963,4289,4289,
+4615,4615,4613,4613,4939,5265,5265,5265,5591,5917,5917,5754,5905,6068,6231,6231,
+6394,6557,6720,6720,6883,6883,7046,7046,7208,7371,7533,7533,7696,7696,7859,7859,
+8022,8022,8185,8185,8036,8199,8199,8362,8362,8525,8525,8688,8851,8851,8851,9013,
+9013,9176,9175,9175,9338,9338,9338,9501,9501,9664,9664,9827,9827,9827,9827,9990,
+9990,10153,10153,10153,10153,10316,10316,10479,10479,10479,10467,10467,10467,10630,10630,10793,
+10793,10793,10793,10793,10956,10956,10956,11119,11119,11119,11119,11119,11119,11282,11282,11445,
+11445,11445,11445,0,155,155,481,807,807,795,1121,1121,1447,1447,1773,2099,
+2099,2097,2423,2423,2749,2749,2749,3075,3401,3401,3311,3311,3637,3963,3963,3963,
+4289,4289,4615,4613,4613,4939,5265,5265,5265,5265,5591,5591,5754,5917,6068,6068,
+6231,6231,6394,6557,6720,6720,6883,6883,7046,7046,7208,7371,7371,7533,7696,7696,
+7859,7859,8022,8022,8185,8348,8036,8199,8199,8362,8525,8525,8525,8688,8688,8851,
+8851,9013,9176,9176,9176,9175,9175,9175,9338,9501,9501,9664,9664,9827,9827,9827,
+9827,9990,9990,10153,10153,10153,10153,10153,10316,10316,10479,10479,10479,10467,10467,10467,
+10630,10630,10793,10793,10793,10793,10793,10793,10956,10956,11119,11119,11119,11119,11119,11119,
+11282,11282,11282,11445,0,155,155,481,807,807,795,795,1121,1447,1447,1773,
+2099,2099,2097,2097,2423,2423,2749,2749,3075,3401,3401,3311,3311,3637,3963,3963,
+3963,3963,4289,4615,4613,4613,4939,4776,5102,5102,5428,5428,5591,5754,5917,5917,
+6068,6068,6231,6394,6557,6557,6720,6720,6883,6883,7046,7209,7208,7371,7371,7371,
+7533,7696,7859,7859,8022,8185,8348,8185,8036,8199,8362,8525,8525,8525,8525,8688,
+8688,8851,8851,9013,9013,9176,9176,9175,9175,9338,9338,9501,9501,9501,9664,9827,
+9827,9827,9827,9827,9990,9990,10153,10153,10153,10153,10316,10479,10479,10479,10479,10467,
+10467,10467,10467,10630,10630,10793,10793,10793,10793,10793,10956,11119,11119,11119,11119,11119,
+11119,11119,11119,11282,11282,0,155,155,481,807,807,795,795,1121,1447,1447,
+1773,1773,2099,2099,2097,2423,2749,2749,2749,3075,3401,3401,3311,3311,3311,3637,
+3963,3963,4289,4289,4615,4615,4613,4776,4939,4939,5102,5265,5428,5428,5591,5754,
+5917,5905,6068,6231,6231,6231,6394,6557,6720,6720,6883,7046,7209,7209,7208,7208,
+7371,7533,7696,7696,7859,7859,8022,8022,8185,8348,8199,8199,8362,8362,8525,8525,
+8525,8688,8688,8688,8851,9013,9013,9176,9176,9175,9175,9175,9338,9338,9501,9664,
+9664,9827,9664,9827,9827,9827,9990,9990,9990,10153,10153,10153,10316,10316,10479,10479,
+10479,10467,10467,10467,10467,10630,10630,10630,10630,10793,10793,10793,10956,10956,11119,11119,
+11119,11119,11119,11119,11119,11119,0,155,155,481,807,807,795,795,1121,1447,
+1447,1447,1773,2099,2097,2097,2423,2423,2749,2749,3075,3401,3401,3401,3311,3311,
+3637,3963,3963,3963,4289,4289,4452,4452,4776,4776,4939,5102,5265,5265,5428,5591,
+5754,5754,5905,5905,6068,6068,6231,6394,6557,6557,6720,6883,7046,7046,7209,7209,
+7208,7371,7533,7533,7696,7696,7859,7859,8022,8185,8348,8185,8199,8199,8362,8525,
+8525,8525,8525,8525,8688,8851,8851,9013,9013,9176,9176,9175,9175,9175,9175,9338,
+9501,9501,9664,9664,9664,9827,9827,9827,9827,9990,9990,10153,10153,10153,10153,10316,
+10316,10479,10479,10479,10467,10467,10467,10467,10467,10630,10630,10793,10793,10793,10793,10956,
+10956,11119,11119,11119,11119,11119,11119,0,155,155,481,807,807,795,795,1121,
+1447,1447,1773,1773,2099,2099,2097,2097,2423,2749,2749,3075,3401,3401,3401,3311,
+3311,3311,3637,3963,3963,4126,4289,4452,4615,4615,4776,4939,5102,5102,5265,5428,
+5591,5591,5754,5917,5905,5905,6068,6231,6394,6394,6557,6720,6720,6883,7046,7046,
+7209,7209,7208,7371,7533,7533,7696,7696,7859,7859,8022,8022,8185,8185,8199,8199,
+8362,8362,8525,8525,8525,8688,8688,8851,8851,9013,9176,9176,9176,9175,9175,9175,
+9338,9338,9501,9501,9501,9664,9664,9827,9827,9827,9827,9990,9990,10153,10153,10153,
+10153,10316,10316,10479,10479,10479,10479,10467,10467,10467,10467,10630,10630,10793,10793,10793,
+10793,10956,10956,10956,10956,11119,11119,11119,0,155,155,481,807,807,795,795,
+1121,1447,1447,1447,1773,1773,2099,2097,2423,2423,2749,2749,2749,3075,3401,3401,
+3311,3311,3474,3637,3800,3963,4126,4126,4289,4452,4613,4776,4939,4939,5102,5102,
+5265,5428,5591,5754,5917,5917,5905,5905,6068,6231,6394,6394,6557,6720,6883,6883,
+7046,7046,7209,7208,7371,7371,7533,7533,7696,7696,7859,7859,8022,8022,8185,8185,
+8199,8199,8199,8362,8525,8525,8525,8525,8688,8851,8851,9013,9013,9176,9176,9176,
+9175,9175,9175,9501,9501,9501,9501,9664,9664,9827,9827,9827,9827,9990,9990,10153,
+10153,10153,10153,10316,10316,10316,10479,10479,10479,10467,10467,10467,10467,10630,10630,10793,
+10793,10793,10793,10793,10793,10956,10956,11119,11119,0,155,155,481,807,807,795,
+795,795,1121,1447,1447,1773,2099,2099,2097,2097,2423,2423,2749,2749,3075,3401,
+3401,3401,3311,3474,3800,3800,3963,3963,4126,4289,4452,4615,4776,4776,4939,4939,
+5102,5265,5428,5591,5754,5754,5917,5917,5905,6068,6231,6231,6394,6394,6557,6720,
+6883,6883,7046,7209,7209,7209,7208,7371,7533,7533,7696,7859,7859,7859,7859,8022,
+8185,8185,8036,8199,8199,8362,8525,8525,8525,8688,8688,8851,8851,9013,9013,9176,
+9176,9175,9175,9175,9338,9338,9501,9501,9501,9664,9664,9664,9827,9827,9827,9990,
+9827,9990,10153,10153,10153,10153,10316,10316,10479,10479,10479,10479,10467,10467,10467,10630,
+10630,10793,10793,10793,10793,10793,10793,10956,10956,11119,0,155,481,481,807,807,
+795,795,795,1121,1447,1447,1773,1773,2099,2099,2097,2423,2749,2749,2749,2912,
+3401,3401,3401,3311,3474,3637,3800,3800,4126,4126,4289,4289,4452,4615,4776,4776,
+4939,5102,5265,5265,5428,5591,5754,5754,5917,5905,6068,6068,6231,6231,6394,6557,
+6720,6720,6883,6883,7046,7046,7209,7208,7371,7371,7533,7533,7696,7696,7859,7859,
+8022,8022,8185,8185,8036,8199,8199,8362,8525,8525,8525,8688,8688,8851,8851,9013,
+9013,9176,9176,9176,9175,9175,9338,9501,9501,9501,9501,9501,9664,9827,9827,9827,
+9827,9827,9990,9990,10153,10153,10153,10153,10316,10316,10479,10479,10479,10479,10479,10467,
+10467,10467,10630,10630,10630,10793,10793,10793,10793,10956,10956,0,155,155,481,807,
+807,795,795,795,1121,1447,1447,1447,1773,2099,2097,2260,2260,2423,2586,2749,
+2912,3075,3238,3238,3311,3474,3637,3800,3963,3963,4126,4126,4289,4452,4615,4613,
+4776,4939,5102,5102,5265,5428,5591,5591,5754,5754,5917,5905,6068,6068,6231,6394,
+6557,6557,6720,6720,6883,6883,7046,7209,7208,7208,7371,7371,7533,7533,7696,7859,
+7859,7859,8022,8022,8185,8185,8036,8199,8362,8362,8525,8525,8525,8688,8688,8688,
+8851,9013,9013,9176,9013,9176,9176,9175,9338,9338,9501,9501,9501,9664,9664,9664,
+9827,9827,9827,9827,9827,9990,9990,10153,10153,10153,10316,10316,10316,10479,10479,10479,
+10479,10467,10467,10467,10467,10630,10630,10630,10793,10793,10793,10793,0,16376,155,481,
+807,807,795,795,958,1121,1447,1447,1610,1773,1936,1936,2260,2260,2423,2586,
+2749,2912,3075,3075,3238,3238,3474,3474,3637,3800,3963,3963,4126,4289,4452,4452,
+4613,4776,4939,4939,5102,5265,5428,5428,5428,5591,5754,5917,5905,5905,6068,6068,
+6231,6394,6557,6557,6720,6720,6883,6883,7046,7209,7208,7208,7371,7371,7533,7533,
+7696,7859,7859,7859,8022,8022,8185,8185,8199,8199,8199,8362,8525,8525,8525,8525,
+8688,8688,8851,9013,8851,9013,9013,9176,9175,9175,9175,9338,9338,9501,9501,9501,
+9664,9664,9664,9827,9827,9827,9827,9990,9990,10153,10153,10153,10153,10153,10316,10316,
+10479,10479,10479,10467,10467,10467,10467,10467,10630,10630,10630,10793,10793,0,155,318,
+481,481,807,644,795,1121,1284,1284,1610,1610,1773,1773,2099,2097,2260,2423,
+2586,2586,2749,2912,3075,3238,3401,3311,3474,3637,3800,3800,3963,3963,4126,4289,
+4452,4615,4776,4776,4939,4939,5102,5102,5265,5428,5591,5754,5917,5917,5905,5905,
+6068,6231,6231,6394,6557,6557,6720,6720,6883,6883,7209,7209,7208,7208,7371,7371,
+7533,7696,7859,7859,7859,7859,8022,8022,8185,8185,8036,8199,8362,8362,8525,8525,
+8525,8525,8688,8688,8851,8851,8851,9013,9013,9176,9176,9175,9175,9338,9501,9501,
+9501,9501,9501,9501,9664,9827,9827,9827,9827,9990,9990,10153,10153,10153,10153,10153,
+10153,10316,10316,10479,10479,10479,10467,10467,10467,10467,10467,10630,10630,10793,0,155,
+155,318,481,644,795,958,1121,1121,1284,1447,1610,1773,1936,1936,2097,2260,
+2423,2423,2586,2749,2912,3075,3238,3238,3311,3474,3637,3637,3800,3800,3963,4126,
+4289,4452,4615,4615,4776,4776,4939,4939,5265,5265,5428,5428,5591,5754,5917,5917,
+5905,5905,6068,6068,6231,6394,6557,6557,6720,6883,7046,6883,7046,7209,7208,7208,
+7371,7533,7696,7533,7696,7859,7859,7859,8022,8022,8185,8185,8199,8199,8199,8362,
+8362,8525,8525,8525,8688,8851,8851,8851,8851,9013,9013,9176,9176,9175,9175,9338,
+9338,9501,9501,9501,9501,9664,9664,9827,9827,9827,9827,9990,9990,9990,9990,10153,
+10153,10153,10153,10316,10316,10479,10479,10479,10479,10467,10467,10467,10467,10630,10630,0,
+155,318,481,481,644,807,958,958,1121,1284,1447,1610,1773,1773,1936,2099,
+2260,2423,2586,2586,2749,2912,3075,3075,3238,3401,3311,3474,3637,3637,3800,3963,
+4126,4126,4289,4452,4615,4613,4776,4939,5102,5102,5265,5265,5428,5591,5754,5754,
+5917,5917,5905,5905,6068,6231,6394,6557,6557,6557,6720,6720,6883,7046,7209,7209,
+7208,7208,7371,7371,7533,7696,7859,7859,7859,7859,8022,8022,8185,8185,8036,8199,
+8199,8362,8525,8525,8525,8688,8688,8688,8851,8851,8851,9013,9013,9176,9176,9175,
+9175,9338,9338,9338,9501,9501,9501,9501,9664,9664,9827,9827,9827,9990,9827,9827,
+9990,10153,10153,10153,10153,10316,10316,10479,10479,10479,10479,10467,10467,10467,10467,10467,
+0,155,318,318,481,644,807,958,1121,1121,1284,1447,1610,1610,1773,1936,
+2097,2260,2423,2423,2586,2749,2912,3075,3238,3238,3401,3311,3474,3474,3800,3800,
+3963,3963,4126,4289,4452,4615,4613,4613,4776,4939,5102,5102,5265,5428,5591,5591,
+5754,5917,5917,5905,5905,6068,6231,6231,6394,6557,6557,6557,6720,6883,7046,7046,
+7209,7209,7208,7208,7371,7533,7696,7696,7696,7859,7859,7859,8022,8022,8185,8185,
+8036,8199,8199,8362,8362,8525,8525,8525,8688,8851,8851,8851,8851,8851,9013,9176,
+9176,9175,9175,9175,9338,9338,9501,9501,9501,9501,9664,9827,9827,9827,9827,9827,
+9827,9990,9990,10153,10153,10153,10153,10316,10316,10479,10479,10479,10479,10479,10467,10467,
+10467,0,155,155,318,481,644,807,958,958,1121,1284,1447,1610,1773,1773,
+1936,2099,2260,2260,2423,2586,2749,2912,3075,3075,3238,3238,3311,3311,3474,3637,
+3800,3800,4126,4126,4289,4289,4452,4615,4613,4776,4939,4939,5102,5102,5265,5428,
+5591,5754,5917,5917,5905,5905,5905,6068,6231,6394,6557,6557,6557,6557,6720,6883,
+7046,7046,7209,7209,7208,7208,7371,7371,7533,7696,7859,7859,7859,7859,8022,8022,
+8185,8348,8036,8036,8199,8362,8525,8525,8525,8688,8688,8688,8851,8851,8851,9013,
+9013,9176,9176,9176,9175,9175,9338,9338,9338,9501,9501,9501,9664,9664,9827,9827,
+9827,9827,9827,9827,9990,9990,10153,10153,10153,10316,10316,10316,10479,10479,10479,10479,
+10479,10467,0,155,318,318,481,644,807,795,958,1121,1284,1284,1610,1610,
+1773,1773,1936,2097,2260,2423,2586,2586,2749,2912,3075,3238,3401,3401,3311,3474,
+3637,3800,3963,3963,4126,4126,4452,4452,4615,4613,4776,4776,4939,4939,5102,5265,
+5428,5591,5754,5754,5917,5917,5905,5905,6068,6231,6394,6394,6557,6557,6557,6720,
+6883,6883,7046,7046,7209,7209,7208,7371,7371,7533,7696,7533,7696,7859,7859,7859,
+8022,8185,8348,8185,8199,8199,8199,8362,8362,8525,8525,8525,8688,8688,8688,8851,
+8851,8851,9013,9176,9176,9175,9175,9175,9175,9338,9338,9501,9501,9501,9501,9664,
+9664,9827,9827,9827,9827,9827,9990,10153,10153,10153,10153,10153,10316,10316,10316,10479,
+10479,10479,10479,0,155,318,481,481,644,807,795,958,1121,1121,1284,1447,
+1610,1773,1936,1936,2097,2260,2423,2423,2586,2749,2912,3075,3238,3238,3401,3311,
+3474,3474,3637,3800,3963,4126,4289,4289,4452,4452,4615,4613,4776,4776,4939,5102,
+5265,5265,5428,5591,5754,5754,5917,5917,5905,5905,6068,6231,6394,6394,6557,6557,
+6720,6557,6720,6883,7046,7046,7209,7208,7208,7208,7371,7371,7533,7696,7859,7859,
+7859,7859,8022,8022,8185,8185,8199,8199,8199,8362,8525,8525,8525,8525,8525,8688,
+8851,8851,8851,9013,9013,9176,9176,9176,9175,9175,9175,9338,9338,9501,9501,9501,
+9501,9664,9827,9827,9827,9827,9827,9827,9990,9990,10153,10153,10153,10153,10153,10316,
+10316,10479,10479,10479,0,155,318,481,644,644,807,795,958,958,1121,1284,
+1447,1610,1773,1773,1936,2099,2260,2423,2586,2586,2749,2912,3075,3075,3238,3401,
+3311,3311,3474,3637,3800,3963,4126,4126,4289,4289,4452,4615,4613,4613,4939,4939,
+5102,5102,5265,5428,5591,5591,5591,5754,5917,5917,5905,6068,6231,6231,6394,6394,
+6557,6557,6557,6720,6883,6883,7046,7209,7209,7209,7208,7208,7371,7533,7696,7696,
+7859,7859,7859,7859,8022,8185,8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,
+8688,8688,8851,8851,8851,8851,9013,9176,9176,9176,9176,9175,9175,9338,9338,9501,
+9501,9501,9501,9664,9664,9827,9827,9827,9827,9827,9827,9990,9990,10153,10153,10153,
+10153,10316,10316,10479,10479,0,155,318,481,481,644,807,795,958,1121,1121,
+1284,1447,1610,1610,1773,1936,2097,2260,2423,2423,2586,2586,2749,2912,3075,3238,
+3401,3401,3311,3474,3637,3637,3800,3963,4126,4126,4289,4452,4615,4615,4613,4776,
+4939,4939,5102,5265,5265,5265,5428,5591,5754,5754,5917,5905,6068,6068,6231,6231,
+6394,6394,6557,6557,6720,6720,6883,7046,7209,7209,7209,7208,7208,7208,7371,7533,
+7696,7696,7859,7859,7859,7859,8022,8022,8185,8185,8199,8199,8199,8362,8362,8525,
+8525,8525,8688,8688,8851,8851,8851,9013,9013,9176,9176,9176,9175,9175,9175,9338,
+9338,9501,9501,9501,9501,9664,9664,9827,9827,9827,9827,9827,9827,9827,9990,10153,
+10153,10153,10153,10153,10316,10479,0,155,318,318,481,644,807,795,958,958,
+1121,1284,1447,1610,1773,1936,1936,2099,2097,2260,2423,2586,2749,2749,2912,2912,
+3238,3238,3401,3311,3474,3474,3637,3800,3963,3963,4126,4126,4289,4452,4615,4613,
+4776,4776,4939,4939,5102,5265,5265,5428,5591,5591,5754,5754,5917,5905,6068,6068,
+6231,6231,6394,6394,6557,6557,6720,6883,6883,7046,7209,7209,7209,7208,7208,7371,
+7533,7533,7696,7696,7859,7859,7859,7859,8022,8185,8185,8185,8199,8199,8199,8362,
+8362,8525,8525,8525,8688,8688,8851,8851,8851,8851,9013,9013,9176,9176,9176,9175,
+9175,9175,9338,9501,9501,9501,9501,9664,9664,9827,9827,9827,9827,9827,9827,9990,
+9990,9990,10153,10153,10153,10316,10316,0,16376,155,481,481,644,644,795,795,
+958,1121,1284,1447,1610,1610,1773,1936,2099,2097,2260,2260,2423,2586,2749,2749,
+2912,3075,3238,3401,3311,3311,3474,3637,3800,3800,3963,3963,4289,4289,4452,4615,
+4613,4613,4776,4776,4939,5102,5265,5265,5428,5428,5591,5591,5754,5917,5905,5905,
+6068,6068,6231,6231,6394,6557,6557,6557,6720,6720,6883,7046,7209,7209,7208,7208,
+7371,7208,7371,7533,7696,7696,7859,7859,7859,7859,8022,8022,8185,8185,8199,8199,
+8199,8362,8362,8525,8525,8525,8525,8688,8851,8851,8851,8851,8851,9176,9176,9176,
+9176,9175,9175,9338,9338,9501,9501,9501,9501,9664,9664,9827,9664,9827,9827,9827,
+9827,9827,9990,9990,10153,10153,10153,10153,0,155,318,318,481,644,807,795,
+958,958,1121,1284,1447,1447,1610,1773,1936,2099,2097,2097,2260,2423,2586,2749,
+2912,2912,3075,3238,3401,3401,3311,3311,3474,3637,3800,3963,4126,4126,4289,4289,
+4452,4615,4613,4613,4776,4939,5102,5102,5265,5265,5428,5428,5591,5754,5917,5917,
+5905,5905,6068,6068,6231,6394,6557,6557,6557,6557,6720,6883,7046,7046,7209,7209,
+7209,7208,7208,7371,7533,7533,7696,7696,7859,7859,7859,7859,8022,8185,8185,8185,
+8199,8199,8199,8362,8362,8525,8525,8525,8688,8688,8688,8851,8851,8851,9013,9013,
+9176,9176,9176,9175,9175,9175,9338,9338,9501,9501,9501,9664,9501,9664,9827,9827,
+9827,9827,9827,9827,9990,9990,10153,10153,10153,0,155,155,318,481,644,807,
+795,795,958,1121,1284,1447,1610,1610,1773,1936,2099,2099,2097,2260,2423,2586,
+2749,2749,2912,3075,3238,3401,3401,3311,3311,3474,3637,3800,3963,3963,4126,4126,
+4289,4452,4615,4615,4776,4776,4939,4939,5102,5265,5265,5265,5428,5591,5754,5754,
+5917,5917,5905,5905,6068,6068,6231,6394,6557,6557,6557,6720,6883,6883,7046,7046,
+7209,7209,7208,7208,7371,7371,7533,7533,7696,7696,7859,7859,7859,7859,8022,8185,
+8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,8525,8688,8688,8851,8851,8851,
+8851,9013,9013,9176,9176,9175,9175,9175,9175,9501,9501,9501,9501,9501,9501,9664,
+9664,9827,9827,9827,9827,9827,9990,9990,9990,10071,0,155,318,318,481,644,
+807,807,795,958,1121,1284,1447,1447,1610,1773,1936,2099,2097,2097,2260,2423,
+2586,2586,2749,2912,3075,3238,3401,3401,3311,3311,3474,3474,3637,3800,3963,3963,
+4126,4289,4452,4452,4615,4613,4776,4776,4939,5102,5265,5265,5265,5428,5591,5591,
+5754,5917,5917,5917,5905,5905,6068,6231,6394,6394,6557,6557,6557,6720,6883,6883,
+7046,7046,7209,7209,7208,7208,7371,7533,7533,7533,7696,7696,7859,7859,7859,8022,
+8185,8185,8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,8525,8688,8688,8851,
+8851,8851,8851,9013,9176,9176,9176,9175,9175,9175,9338,9338,9501,9501,9501,9501,
+9501,9664,9664,9827,9827,9827,9827,9827,9908,9990,9990,0,155,155,318,481,
+644,807,795,795,958,1121,1284,1284,1447,1610,1773,1936,2099,2099,2097,2260,
+2423,2423,2749,2749,2912,2912,3075,3238,3401,3401,3311,3474,3637,3800,3800,3963,
+3963,3963,4126,4289,4452,4615,4613,4613,4776,4776,4939,5102,5265,5265,5428,5428,
+5591,5591,5754,5917,5917,5905,5905,6068,6231,6231,6394,6394,6557,6557,6720,6720,
+6883,6883,7046,7046,7046,7209,7208,7208,7371,7371,7533,7533,7696,7696,7859,7859,
+8022,7859,8022,8185,8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,8525,8688,
+8688,8851,8851,8851,8851,9013,9013,9176,9176,9176,9175,9175,9175,9338,9338,9338,
+9501,9501,9501,9664,9664,9827,9827,9827,9827,9908,9908,9908,0,16376,155,318,
+481,644,807,807,795,795,1121,1121,1447,1447,1610,1610,1773,1936,2099,2097,
+2260,2260,2423,2586,2749,2749,2912,3075,3238,3401,3401,3311,3474,3637,3800,3800,
+3963,3963,3963,4126,4289,4452,4615,4615,4613,4613,4776,4939,5102,5265,5265,5265,
+5428,5428,5591,5591,5754,5917,5905,5905,5905,6068,6231,6231,6394,6557,6557,6557,
+6557,6720,6883,6883,6883,7046,7209,7209,7208,7208,7371,7533,7533,7533,7696,7696,
+7859,7859,7859,8022,8022,8185,8185,8185,8199,8199,8199,8362,8362,8362,8525,8525,
+8525,8688,8688,8851,8851,8851,8851,9013,9013,9176,9176,9175,9175,9175,9175,9175,
+9338,9501,9501,9501,9501,9501,9664,9827,9827,9745,9745,9827,9908,0,155,318,
+481,481,644,807,807,795,958,958,1121,1284,1447,1447,1610,1773,1936,2099,
+2097,2097,2260,2423,2586,2749,2912,2912,3075,3075,3238,3238,3311,3311,3474,3637,
+3800,3800,3963,3963,4126,4126,4289,4452,4615,4615,4613,4776,4939,4939,5102,5265,
+5265,5265,5428,5428,5754,5754,5917,5917,5905,5905,6068,6068,6231,6231,6394,6394,
+6557,6557,6720,6720,6883,6883,7046,7046,7209,7209,7208,7371,7533,7533,7533,7533,
+7696,7696,7859,7859,7859,7859,8022,8185,8185,8185,8199,8199,8199,8199,8362,8525,
+8525,8525,8525,8525,8688,8851,8851,8851,8851,9013,9013,9176,9176,9176,9175,9175,
+9175,9338,9338,9338,9501,9501,9501,9664,9582,9664,9664,9745,9827,9827,0,155,
+318,318,481,644,807,807,795,795,958,1121,1284,1447,1610,1610,1773,1936,
+2099,2099,2097,2260,2423,2586,2749,2749,2912,2912,3075,3238,3401,3401,3311,3474,
+3637,3800,3963,3963,3963,3963,4126,4289,4452,4452,4615,4613,4776,4776,4939,5102,
+5265,5265,5265,5265,5428,5591,5754,5754,5917,5917,5905,5905,6068,6068,6231,6231,
+6394,6557,6557,6557,6720,6883,6883,6883,7046,7046,7209,7209,7208,7371,7533,7533,
+7533,7533,7696,7696,7859,7859,7859,8022,8022,8185,8185,8185,8199,8199,8199,8199,
+8362,8525,8525,8525,8525,8688,8688,8851,8851,8851,8851,9013,9013,9176,9176,9176,
+9176,9175,9175,9175,9338,9338,9501,9501,9501,9582,9582,9664,9745,9745,9745,0,
+155,318,481,481,644,807,807,795,795,958,1121,1284,1447,1447,1610,1773,
+1936,2099,2097,2097,2260,2423,2586,2586,2749,2749,2912,3075,3238,3238,3401,3311,
+3474,3474,3637,3800,3963,3963,3963,4126,4289,4289,4452,4615,4613,4613,4776,4776,
+5102,4939,5102,5265,5265,5428,5591,5591,5754,5754,5917,5917,5905,5905,6068,6068,
+6231,6231,6394,6557,6557,6557,6720,6883,6883,6883,7046,7046,7209,7208,7371,7371,
+7533,7533,7533,7533,7696,7696,7859,7859,7859,7859,8022,8185,8185,8185,8036,8199,
+8199,8362,8525,8525,8525,8525,8525,8525,8688,8688,8851,8851,8851,9013,9013,9176,
+9176,9176,9175,9175,9175,9175,9175,9338,9419,9419,9501,9582,9582,9664,9664,9745,
+0,155,318,318,481,644,807,807,795,958,958,1121,1284,1447,1447,1610,
+1773,1936,2099,2099,2097,2097,2423,2423,2749,2749,2749,2749,2912,3075,3238,3401,
+3311,3311,3474,3637,3800,3800,3963,3963,3963,4126,4289,4452,4615,4615,4613,4613,
+4776,4776,4939,5102,5265,5265,5428,5428,5591,5591,5754,5917,5917,5905,5905,5905,
+6068,6231,6231,6394,6557,6557,6557,6557,6720,6883,6883,6883,7046,7209,7209,7209,
+7208,7371,7533,7533,7533,7533,7696,7696,7859,7859,7859,8022,8185,8185,8185,8185,
+8199,8199,8199,8362,8362,8525,8525,8525,8525,8525,8525,8688,8851,8851,8851,9013,
+9013,9176,9176,9176,9176,9175,9175,9175,9256,9338,9419,9501,9501,9582,9582,9664,
+9664,0,155,155,318,318,481,644,807,795,958,958,1121,1284,1447,1447,
+1610,1610,1773,1936,2099,2097,2260,2260,2423,2586,2749,2749,2749,2912,3075,3238,
+3401,3401,3311,3474,3637,3637,3800,3800,3963,3963,4126,4289,4452,4452,4615,4615,
+4613,4613,4939,4939,5102,5102,5265,5265,5428,5428,5591,5754,5917,5917,5917,5905,
+5905,6068,6231,6231,6394,6394,6557,6557,6557,6720,6883,6883,6883,6883,7046,7046,
+7209,7208,7371,7371,7533,7533,7533,7533,7696,7696,7859,7859,8022,8022,8185,8185,
+8185,8185,8199,8199,8199,8362,8525,8525,8525,8525,8525,8525,8688,8688,8851,8851,
+8851,9013,9013,9176,9176,9176,9176,9175,9175,9256,9338,9338,9419,9419,9501,9582,
+9582,9664,0,155,155,318,481,481,644,807,795,958,1121,1121,1284,1447,
+1447,1447,1610,1773,1936,2099,2097,2097,2260,2423,2586,2749,2749,2749,2912,3075,
+3238,3238,3401,3311,3311,3474,3637,3637,3963,3963,3963,3963,4126,4289,4452,4615,
+4615,4613,4776,4776,4939,4939,5102,5265,5265,5265,5428,5591,5754,5754,5917,5917,
+5905,5905,6068,6068,6231,6231,6394,6394,6557,6557,6720,6720,6883,6883,6883,6883,
+7046,7209,7208,7208,7208,7371,7371,7533,7533,7533,7696,7696,7859,7859,8022,8022,
+8185,8185,8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,8525,8525,8688,8851,
+8851,8851,8851,9013,9013,9176,9176,9176,9176,9175,9256,9256,9338,9338,9419,9501,
+9501,9501,9582,0,155,155,318,318,481,644,807,795,958,958,1121,1284,
+1447,1447,1610,1610,1773,1936,2099,2099,2097,2260,2423,2586,2749,2749,2749,2912,
+3075,3238,3401,3401,3311,3311,3474,3637,3800,3800,3963,3963,4126,4126,4289,4452,
+4615,4615,4613,4613,4776,4776,4939,5102,5265,5265,5265,5428,5591,5591,5754,5917,
+5917,5917,5905,5905,6068,6231,6231,6231,6394,6394,6557,6557,6557,6720,6883,6883,
+6883,6883,7046,7209,7208,7208,7208,7371,7533,7533,7533,7533,7696,7859,7859,7859,
+8022,8022,8022,8022,8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,8525,8525,
+8688,8688,8851,8851,8851,9013,9013,9013,9176,9176,9095,9175,9175,9256,9338,9338,
+9419,9419,9501,9501,0,155,155,318,481,481,644,807,795,795,958,1121,
+1284,1447,1447,1447,1610,1773,1936,2099,2097,2097,2260,2423,2586,2586,2749,2749,
+2912,3075,3238,3238,3401,3401,3311,3311,3474,3637,3800,3963,3963,3963,4126,4126,
+4452,4452,4615,4615,4613,4613,4776,4776,4939,5102,5265,5265,5428,5428,5591,5591,
+5591,5591,5754,5917,5905,6068,6231,6231,6231,6231,6394,6394,6557,6557,6720,6720,
+6883,6883,6883,7046,7209,7209,7208,7208,7208,7371,7533,7533,7533,7696,7696,7696,
+7859,7859,7859,7859,8022,8185,8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,
+8525,8525,8525,8851,8851,8851,8851,8851,9013,9176,9013,9095,9095,9176,9256,9256,
+9338,9338,9338,9419,9501,0,155,155,318,318,481,644,807,795,958,958,
+1121,1284,1447,1447,1447,1610,1773,1936,2099,2099,2097,2097,2423,2423,2586,2749,
+2749,2749,2912,3075,3238,3401,3401,3311,3311,3474,3637,3800,3963,3963,3963,4126,
+4289,4289,4452,4615,4615,4615,4613,4613,4776,4939,5102,5265,5265,5265,5428,5428,
+5591,5591,5754,5754,5917,5917,5905,6068,6231,6231,6231,6231,6394,6394,6557,6557,
+6720,6720,6883,6883,7046,7046,7209,7209,7208,7208,7371,7371,7533,7533,7533,7533,
+7696,7859,7859,7859,7859,7859,8022,8022,8185,8185,8199,8199,8199,8199,8362,8525,
+8525,8525,8525,8525,8688,8688,8851,8851,8851,9013,8932,8932,9013,9095,9095,9175,
+9175,9256,9256,9338,9338,9419,0,155,155,155,318,481,644,807,795,795,
+958,958,1121,1284,1447,1447,1610,1610,1773,1936,2099,2097,2260,2260,2423,2586,
+2749,2749,2749,2912,3075,3238,3401,3401,3311,3311,3474,3474,3637,3800,3963,3963,
+4126,4126,4289,4289,4452,4615,4615,4613,4776,4776,4939,4939,5102,5265,5265,5265,
+5428,5591,5591,5591,5754,5754,5917,5905,6068,6068,6231,6231,6231,6231,6394,6557,
+6557,6557,6883,6720,6883,6883,7046,7046,7209,7209,7208,7208,7371,7371,7533,7533,
+7533,7696,7859,7859,7859,7859,7859,7859,8022,8185,8185,8185,8199,8199,8199,8362,
+8362,8525,8525,8525,8525,8525,8525,8688,8688,8851,8851,8851,8932,9013,9013,9095,
+9095,9176,9175,9256,9256,9338,9338,0,155,155,318,481,644,644,807,807,
+795,958,1121,1121,1284,1447,1447,1447,1610,1773,1936,2099,2097,2097,2260,2423,
+2586,2749,2749,2749,2912,2912,3075,3238,3401,3401,3311,3311,3474,3637,3800,3963,
+3963,3963,4126,4126,4289,4452,4615,4615,4613,4613,4776,4776,4939,4939,5102,5265,
+5265,5265,5428,5591,5591,5591,5754,5917,5905,5905,5905,6068,6231,6231,6231,6394,
+6557,6557,6557,6557,6720,6883,6883,6883,7046,7046,7209,7209,7208,7208,7371,7371,
+7533,7533,7533,7696,7859,7859,7859,7859,7859,7859,8022,8185,8185,8185,8199,8199,
+8199,8362,8362,8525,8525,8525,8525,8525,8525,8606,8769,8769,8851,8932,8932,8932,
+9013,9095,9095,9176,9176,9256,9256,9338,0,155,155,318,481,481,644,807,
+795,795,958,958,1121,1284,1447,1447,1610,1610,1773,1936,2099,2099,2097,2260,
+2423,2423,2586,2749,2749,2749,2912,3075,3238,3401,3401,3311,3311,3474,3637,3637,
+3800,3963,3963,3963,4126,4289,4452,4452,4615,4615,4613,4776,4939,4939,4939,4939,
+5265,5265,5265,5428,5591,5591,5591,5591,5754,5917,5905,5905,6068,6068,6231,6231,
+6231,6394,6557,6557,6557,6720,6883,6883,6883,6883,7046,7046,7209,7209,7208,7208,
+7371,7371,7533,7533,7696,7696,7859,7859,7859,7859,7859,8022,8185,8185,8185,8185,
+8199,8199,8199,8362,8362,8525,8525,8525,8525,8525,8606,8688,8769,8769,8851,8851,
+8932,9013,9013,9095,9095,9095,9175,9256,9256,0,155,155,318,481,644,644,
+807,807,795,795,958,1121,1284,1447,1447,1447,1610,1773,1936,2099,2097,2097,
+2260,2260,2423,2586,2749,2749,2912,2912,3075,3075,3401,3401,3311,3311,3474,3474,
+3637,3800,3963,3963,3963,3963,4126,4289,4452,4615,4615,4613,4776,4776,4939,4939,
+5102,5102,5265,5265,5428,5428,5591,5591,5591,5754,5917,5917,5905,5905,6068,6068,
+6231,6231,6394,6394,6557,6557,6557,6720,6883,6883,6883,6883,7046,7046,7209,7209,
+7208,7208,7371,7533,7533,7533,7533,7696,7859,7859,7859,7859,8022,7859,8022,8022,
+8185,8185,8199,8199,8199,8362,8362,8525,8525,8525,8525,8606,8688,8688,8769,8769,
+8851,8932,8932,8932,9013,9013,9095,9176,9176,9175,0,155,155,155,481,481,
+644,807,807,795,958,958,1121,1284,1447,1447,1610,1773,1936,1936,2099,2099,
+2097,2097,2260,2423,2586,2586,2749,2749,2912,2912,3075,3238,3401,3401,3311,3311,
+3474,3637,3800,3800,3963,3963,4126,4126,4289,4289,4452,4452,4615,4613,4776,4939,
+4939,4939,5102,5102,5265,5265,5428,5428,5591,5591,5754,5754,5917,5917,5905,5905,
+6068,6231,6231,6231,6394,6394,6557,6557,6720,6720,6883,6883,6883,6883,7046,7046,
+7209,7208,7208,7208,7371,7371,7533,7533,7696,7696,7859,7859,7859,7859,7859,8022,
+8022,8185,8185,8185,8199,8199,8199,8362,8362,8362,8362,8443,8606,8606,8606,8688,
+8688,8769,8851,8851,8932,8932,9013,9095,9095,9176,9176,0,155,155,155,318,
+481,644,807,807,795,795,958,1121,1284,1447,1447,1447,1610,1773,1936,1936,
+2099,2097,2097,2260,2423,2423,2586,2749,2749,2912,3075,3075,3238,3401,3401,3311,
+3311,3311,3474,3637,3800,3963,3963,3963,4126,4126,4289,4289,4452,4615,4613,4776,
+4939,4939,4939,4939,5102,5265,5265,5428,5591,5591,5591,5591,5754,5917,5917,5905,
+5905,5905,6068,6231,6231,6231,6394,6557,6557,6557,6557,6720,6883,6883,6883,6883,
+7209,7209,7209,7209,7208,7208,7371,7533,7533,7533,7696,7696,7859,7859,7859,7859,
+7859,7859,8022,8185,8185,8185,8199,8199,8199,8280,8362,8362,8443,8525,8525,8606,
+8606,8688,8769,8769,8769,8851,8851,8932,9013,9095,9095,9176,0,155,155,318,
+481,481,644,807,807,795,795,958,1121,1284,1447,1447,1447,1610,1773,1936,
+2099,2099,2097,2097,2260,2260,2423,2586,2749,2749,2912,2912,3075,3238,3401,3401,
+3311,3311,3311,3474,3637,3800,3800,3963,3963,4126,4289,4289,4289,4452,4615,4615,
+4613,4776,4939,4939,4939,5102,5265,5265,5265,5428,5591,5591,5591,5754,5917,5754,
+5917,5905,5905,6068,6231,6231,6231,6231,6394,6394,6557,6557,6720,6720,6883,6883,
+6883,7046,7209,7209,7209,7208,7208,7208,7371,7533,7533,7533,7696,7696,7859,7859,
+7859,7859,7859,8022,8185,8185,8185,8185,8199,8199,8199,8280,8362,8443,8443,8525,
+8525,8606,8606,8688,8688,8769,8769,8851,8932,8932,9013,9095,9095,0,155,155,
+318,318,481,644,807,807,795,795,958,1121,1284,1284,1447,1447,1610,1773,
+1936,1936,2099,2099,2097,2260,2423,2423,2586,2749,2749,2749,2912,3075,3238,3401,
+3401,3401,3311,3311,3637,3637,3637,3800,3963,3963,4126,4126,4289,4289,4452,4452,
+4615,4613,4776,4776,4939,4939,4939,5102,5265,5265,5428,5428,5591,5591,5591,5754,
+5917,5917,5905,5905,6068,6068,6231,6231,6231,6231,6394,6557,6557,6557,6720,6720,
+6883,6883,6883,7046,7209,7209,7209,7208,7208,7371,7533,7533,7533,7533,7696,7696,
+7859,7859,7859,7859,7859,7859,8022,8185,8185,8185,8117,8117,8280,8362,8362,8443,
+8443,8525,8525,8606,8606,8688,8688,8769,8769,8932,8932,8932,9013,9013,0,155,
+155,155,318,481,644,807,807,795,795,958,1121,1284,1447,1447,1447,1610,
+1773,1773,1936,2099,2097,2097,2260,2260,2423,2586,2749,2749,2912,2912,3075,3075,
+3401,3401,3401,3311,3474,3474,3637,3637,3800,3963,3963,3963,4126,4289,4289,4289,
+4452,4615,4613,4613,4776,4776,4939,4939,5102,5265,5265,5265,5428,5428,5591,5591,
+5754,5754,5917,5917,5905,5905,6068,6068,6231,6231,6231,6231,6394,6557,6557,6557,
+6720,6720,6883,6883,6883,7046,7209,7209,7208,7208,7371,7208,7371,7533,7533,7533,
+7696,7696,7859,7859,7859,7859,7859,8022,8185,8185,8185,8185,8199,8280,8280,8362,
+8362,8362,8443,8525,8525,8606,8606,8688,8688,8769,8851,8851,8932,8932,9013,0,
+155,155,318,318,481,644,807,807,795,795,958,1121,1284,1284,1447,1447,
+1610,1610,1936,1936,2099,2099,2097,2097,2260,2423,2586,2586,2749,2749,2912,2912,
+3075,3075,3401,3401,3311,3474,3637,3637,3637,3637,3800,3963,3963,4126,4289,4289,
+4289,4289,4452,4615,4613,4776,4939,4939,4939,4939,5102,5265,5265,5265,5428,5591,
+5591,5591,5754,5754,5917,5917,5905,5905,6068,6068,6231,6231,6231,6394,6557,6557,
+6557,6557,6720,6720,6883,6883,7046,7046,7209,7209,7209,7208,7208,7371,7533,7533,
+7533,7533,7696,7696,7859,7859,7859,7859,8022,8022,8185,8185,8185,8185,8199,8199,
+8280,8280,8362,8443,8443,8525,8525,8525,8606,8688,8769,8769,8769,8851,8932,8932,
+0,155,155,155,318,481,644,807,807,795,795,795,958,1121,1284,1447,
+1447,1447,1610,1773,1936,1936,2099,2097,2097,2260,2423,2423,2586,2586,2749,2912,
+3075,3075,3075,3075,3238,3401,3474,3474,3637,3637,3637,3800,3963,3963,4126,4126,
+4289,4289,4289,4452,4615,4613,4776,4776,4939,4939,4939,4939,5102,5265,5265,5265,
+5428,5591,5591,5591,5754,5917,5917,5917,5905,5905,6068,6068,6231,6231,6394,6557,
+6557,6557,6557,6557,6720,6883,6883,6883,7046,7046,7209,7209,7208,7208,7208,7208,
+7371,7533,7533,7533,7696,7696,7859,7859,7859,7859,8022,8022,8104,8104,8185,8185,
+8199,8199,8199,8362,8362,8362,8443,8443,8525,8606,8606,8688,8688,8769,8851,8851,
+8932,0,155,155,318,481,644,644,807,807,795,795,795,958,1121,1284,
+1447,1447,1447,1610,1773,1936,2099,2099,2097,2097,2260,2423,2423,2586,2749,2749,
+2749,2912,3075,3075,3075,3238,3401,3311,3474,3474,3637,3637,3800,3800,3963,3963,
+4126,4126,4289,4289,4452,4452,4615,4613,4776,4776,4939,4939,4939,5102,5265,5265,
+5265,5428,5591,5591,5591,5591,5754,5917,5917,5905,5905,5905,6068,6231,6231,6231,
+6394,6557,6557,6557,6557,6557,6720,6883,6883,6883,7046,7046,7209,7209,7208,7208,
+7208,7371,7371,7533,7533,7533,7696,7696,7859,7859,7859,7859,8022,7941,8022,8104,
+8185,8185,8117,8199,8280,8280,8362,8362,8362,8525,8525,8606,8606,8688,8688,8769,
+8769,8851,0,155,155,318,481,481,644,807,807,795,795,795,958,1121,
+1284,1284,1447,1447,1610,1773,1936,1773,2099,2099,2097,2260,2423,2423,2586,2586,
+2749,2749,2912,3075,3075,3075,3238,3401,3311,3311,3474,3637,3637,3637,3800,3963,
+3963,3963,4126,4289,4289,4289,4452,4615,4613,4613,4776,4776,4939,4939,5102,5102,
+5265,5265,5428,5428,5591,5591,5754,5754,5917,5917,5905,5905,5905,6068,6231,6231,
+6231,6394,6557,6557,6557,6557,6557,6720,6720,6883,6883,6883,7046,7046,7209,7209,
+7208,7208,7208,7208,7371,7533,7533,7533,7696,7859,7859,7859,7859,7941,7941,8022,
+8104,8104,8185,8185,8199,8199,8199,8280,8280,8362,8443,8525,8525,8606,8606,8688,
+8688,8769,8769,0,155,155,318,318,481,644,807,807,795,795,958,958,
+1121,1284,1284,1447,1447,1610,1773,1773,1936,2099,2097,2097,2260,2423,2423,2423,
+2586,2749,2749,2749,3075,3075,3075,3075,3238,3401,3311,3474,3637,3637,3637,3800,
+3963,3963,3963,4126,4289,4289,4289,4452,4615,4615,4613,4613,4776,4939,4939,4939,
+5102,5102,5265,5265,5428,5591,5591,5591,5754,5754,5917,5917,5905,5905,6068,6068,
+6231,6231,6231,6394,6557,6557,6557,6557,6557,6557,6720,6883,6883,6883,7209,7209,
+7209,7209,7208,7208,7208,7371,7533,7533,7533,7533,7696,7696,7778,7778,7859,7941,
+8022,8022,8104,8104,8185,8185,8117,8199,8199,8280,8362,8443,8443,8525,8525,8525,
+8606,8688,8688,8769,0,16376,155,155,481,481,481,644,807,807,795,958,
+1121,1121,1284,1447,1447,1447,1610,1773,1773,1773,1936,2099,2097,2097,2260,2423,
+2423,2586,2749,2749,2749,2912,3075,3075,3238,3238,3401,3311,3474,3474,3637,3637,
+3637,3800,3963,3963,4126,4126,4289,4289,4452,4452,4615,4613,4613,4776,4939,4939,
+4939,4939,5102,5265,5265,5428,5591,5591,5591,5591,5754,5754,5917,5917,5905,5905,
+6068,6068,6231,6231,6394,6394,6557,6557,6557,6557,6557,6720,6883,6883,7046,7046,
+7046,7209,7209,7209,7208,7208,7371,7371,7533,7533,7533,7615,7696,7696,7778,7778,
+7859,7941,8022,8022,8104,8104,8185,8185,8117,8199,8280,8362,8362,8362,8443,8443,
+8525,8606,8606,8688,8688,0,155,155,155,318,481,481,481,807,795,795,
+958,1121,1121,1121,1284,1447,1447,1610,1773,1773,1773,1936,2099,2097,2260,2260,
+2423,2423,2586,2586,2749,2749,2912,3075,3075,3075,3238,3401,3311,3311,3474,3474,
+3637,3637,3800,3963,3963,3963,4126,4289,4289,4289,4452,4615,4613,4613,4613,4776,
+4939,4939,4939,5102,5265,5265,5265,5428,5591,5591,5591,5591,5754,5754,5917,5917,
+5905,5905,6068,6231,6231,6231,6394,6394,6557,6557,6557,6557,6720,6720,6883,6883,
+6883,7046,7209,7209,7209,7209,7208,7208,7371,7371,7533,7452,7615,7615,7696,7696,
+7778,7859,7859,7941,8022,8022,8104,8104,8185,8267,8199,8199,8280,8280,8362,8362,
+8443,8525,8525,8525,8606,8606,0,155,155,155,318,481,481,644,807,807,
+795,958,1121,1121,1284,1284,1447,1447,1610,1610,1773,1773,1936,2099,2097,2097,
+2260,2423,2423,2586,2749,2749,2749,2912,3075,3075,3075,3238,3401,3401,3311,3311,
+3474,3637,3637,3800,3800,3963,3963,4126,4289,4289,4289,4452,4615,4615,4613,4613,
+4776,4776,4939,4939,5102,5102,5265,5265,5428,5428,5591,5428,5591,5591,5754,5917,
+5917,5905,5905,5905,6068,6231,6231,6231,6394,6394,6557,6557,6557,6557,6720,6720,
+6883,6883,7046,7046,7209,7209,7209,7208,7208,7208,7289,7371,7452,7533,7615,7615,
+7696,7696,7778,7778,7859,7941,8022,8022,8104,8185,8267,8185,8199,8199,8199,8280,
+8280,8362,8443,8443,8525,8525,8525,0,155,155,318,318,481,481,644,644,
+807,795,958,1121,1121,1121,1284,1447,1447,1610,1773,1773,1773,1936,2099,2099,
+2097,2260,2423,2423,2586,2586,2749,2749,2912,3075,3075,3075,3238,3401,3401,3311,
+3311,3474,3637,3637,3800,3800,3963,3963,4126,4126,4289,4289,4452,4452,4615,4615,
+4613,4613,4776,4939,4939,4939,5102,5265,5265,5265,5265,5265,5591,5591,5591,5754,
+5917,5917,5917,5905,5905,5905,6068,6231,6231,6231,6394,6394,6557,6557,6557,6557,
+6720,6720,6883,6883,7046,7046,7209,7209,7209,7209,7208,7289,7371,7452,7533,7533,
+7615,7615,7696,7696,7778,7859,7941,7941,8022,8022,8104,8104,8185,8185,8117,8199,
+8199,8280,8362,8362,8362,8443,8525,8525,0,155,155,155,318,481,481,644,
+807,807,795,958,1121,1121,1121,1284,1447,1447,1610,1610,1773,1773,1936,2099,
+2097,2097,2260,2423,2423,2423,2586,2749,2749,2749,2912,3075,3075,3075,3238,3401,
+3311,3311,3474,3637,3637,3637,3800,3800,3963,3963,4126,4289,4289,4289,4452,4452,
+4615,4615,4613,4776,4939,4939,4939,4939,5102,5265,5265,5265,5428,5428,5591,5591,
+5591,5754,5917,5917,5905,5905,5905,5905,6068,6231,6231,6231,6394,6557,6557,6557,
+6557,6557,6720,6883,6883,6883,7046,7046,7209,7209,7209,7208,7289,7371,7452,7452,
+7452,7533,7615,7615,7696,7778,7859,7859,7941,7941,8022,8022,8104,8104,8185,8185,
+8117,8199,8199,8280,8280,8362,8443,8443,8525,0,155,155,155,318,481,481,
+644,644,807,795,958,1121,1121,1121,1284,1284,1447,1447,1610,1773,1773,1773,
+1936,2099,2097,2097,2260,2423,2423,2586,2749,2749,2749,2912,3075,3075,3238,3238,
+3401,3401,3311,3474,3637,3637,3637,3637,3800,3963,3963,4126,4289,4289,4289,4289,
+4452,4615,4613,4613,4776,4776,4939,4939,4939,5102,5265,5265,5265,5265,5428,5428,
+5591,5591,5754,5754,5917,5917,5905,5905,5905,6068,6231,6231,6394,6231,6394,6557,
+6557,6557,6557,6720,6883,6883,6883,6883,7046,7046,7209,7128,7208,7208,7289,7289,
+7371,7452,7533,7533,7615,7615,7696,7778,7859,7859,7941,7941,8022,8022,8104,8104,
+8185,8267,8117,8199,8199,8280,8362,8362,8443,8525,0,155,155,318,318,481,
+481,644,807,807,795,795,958,1121,1121,1121,1284,1447,1447,1610,1773,1773,
+1773,1936,2099,2097,2260,2260,2423,2423,2586,2586,2749,2749,2912,2912,3075,3075,
+3238,3238,3401,3311,3311,3474,3637,3637,3800,3800,3963,3963,3963,4126,4289,4289,
+4289,4452,4615,4615,4613,4613,4776,4776,4939,4939,5102,5102,5265,5265,5265,5265,
+5428,5591,5591,5591,5754,5917,5917,5917,5905,5905,6068,6068,6231,6231,6231,6394,
+6557,6557,6557,6557,6557,6720,6720,6883,6883,6965,7046,7046,7128,7128,7208,7208,
+7289,7371,7452,7452,7533,7533,7615,7696,7696,7778,7859,7778,7859,7941,8022,8022,
+8104,8104,8185,8185,8117,8199,8199,8280,8362,8443,8443,0,155,155,318,318,
+481,481,644,807,807,795,795,958,1121,1121,1284,1284,1447,1447,1610,1610,
+1773,1773,1936,2099,2097,2097,2260,2423,2423,2423,2586,2749,2749,2749,2912,3075,
+3075,3238,3401,3401,3311,3311,3474,3637,3637,3637,3800,3800,3963,3963,4126,4126,
+4289,4289,4452,4452,4615,4615,4613,4613,4776,4776,4939,4939,5102,5265,5265,5265,
+5265,5265,5428,5591,5591,5754,5917,5917,5917,5917,5905,5905,6068,6068,6231,6231,
+6394,6394,6557,6557,6557,6557,6557,6720,6883,6883,6883,6965,7046,7046,7128,7128,
+7208,7208,7289,7371,7452,7452,7533,7533,7615,7615,7696,7696,7778,7859,7941,7941,
+8022,8022,8104,8104,8185,8267,8117,8199,8280,8362,8362,8443,0,155,155,318,
+481,481,481,644,807,807,795,795,958,1121,1121,1121,1284,1447,1447,1610,
+1773,1773,1773,1936,2099,2099,2097,2260,2423,2423,2423,2586,2749,2749,2749,2912,
+3075,3075,3238,3238,3401,3401,3311,3311,3474,3637,3637,3637,3800,3963,3963,3963,
+4126,4289,4289,4289,4452,4615,4615,4615,4613,4776,4939,4939,4939,5102,5265,5265,
+5265,5265,5265,5428,5591,5591,5754,5754,5917,5917,5917,5905,5905,5905,6068,6068,
+6231,6231,6394,6394,6557,6557,6557,6557,6639,6720,6802,6883,6965,6965,7046,7046,
+7128,7128,7208,7289,7371,7371,7452,7452,7533,7533,7615,7615,7696,7778,7859,7859,
+7859,7941,8022,8022,8104,8185,8267,8267,8117,8280,8280,8362,8362,0,155,155,
+318,318,481,481,644,807,807,795,795,958,1121,1121,1121,1284,1447,1447,
+1610,1773,1773,1773,1936,2099,2097,2097,2260,2260,2423,2423,2586,2586,2749,2749,
+2912,2912,3075,3075,3238,3401,3401,3311,3311,3474,3637,3637,3637,3637,3800,3963,
+3963,4126,4126,4289,4289,4289,4452,4615,4615,4613,4776,4776,4939,4939,4939,5102,
+5265,5265,5265,5265,5428,5428,5591,5591,5754,5754,5917,5917,5905,5905,5905,5905,
+6068,6231,6231,6231,6394,6394,6557,6557,6557,6639,6720,6802,6883,6802,6883,6965,
+7046,7046,7128,7209,7289,7289,7371,7371,7452,7452,7533,7533,7615,7615,7696,7696,
+7778,7859,7941,7941,8022,8022,8104,8185,8267,8185,8199,8199,8280,8280,0,16376,
+155,155,318,481,481,481,807,807,795,795,958,1121,1121,1121,1447,1447,
+1447,1447,1610,1773,1773,1936,2099,2099,2097,2097,2260,2423,2423,2423,2586,2749,
+2749,2749,2912,3075,3075,3238,3401,3401,3311,3311,3474,3474,3637,3637,3637,3800,
+3963,3963,3963,4126,4289,4289,4289,4452,4615,4615,4613,4613,4776,4776,4939,4939,
+5102,5265,5265,5265,5265,5265,5428,5591,5591,5591,5754,5754,5917,5917,5905,5905,
+5905,6068,6231,6068,6231,6231,6394,6394,6476,6476,6639,6639,6720,6720,6802,6883,
+6965,6965,7046,7046,7128,7209,7208,7289,7371,7371,7452,7452,7533,7533,7615,7615,
+7696,7778,7859,7859,7941,7941,8022,8104,8104,8104,8185,8185,8199,8199,8199,0,
+16376,155,155,318,481,481,644,644,807,795,795,958,1121,1121,1121,1284,
+1447,1447,1610,1610,1773,1773,1936,1936,2099,2097,2097,2260,2423,2423,2423,2586,
+2749,2749,2912,2912,3075,3075,3238,3238,3401,3401,3311,3311,3474,3474,3637,3800,
+3963,3963,3963,3963,4126,4126,4289,4289,4452,4452,4615,4615,4613,4613,4776,4939,
+4939,4939,5102,5265,5265,5265,5265,5265,5428,5428,5591,5591,5754,5917,5917,5917,
+5905,5905,5905,5905,6068,6231,6231,6313,6394,6394,6476,6557,6639,6639,6720,6802,
+6883,6883,6965,6965,7046,7046,7128,7209,7289,7289,7289,7371,7452,7452,7533,7533,
+7615,7615,7696,7778,7859,7859,7941,7941,8022,7941,8022,8104,8185,8185,8117,8199,
+0,155,155,155,318,481,481,644,807,807,795,795,958,958,1121,1121,
+1284,1447,1447,1447,1610,1773,1773,1936,2099,2099,2097,2097,2260,2260,2423,2423,
+2586,2749,2749,2749,2912,3075,3075,3238,3401,3401,3401,3311,3311,3474,3637,3637,
+3800,3800,3963,3963,3963,3963,4126,4289,4289,4289,4452,4615,4615,4613,4613,4613,
+4939,4939,4939,5102,5265,5265,5265,5265,5265,5428,5591,5591,5591,5754,5917,5917,
+5917,5917,5905,5905,5905,6068,6231,6150,6313,6313,6394,6476,6557,6557,6639,6639,
+6720,6802,6883,6883,6965,6965,7046,7046,7128,7209,7208,7289,7371,7371,7452,7452,
+7533,7533,7615,7696,7778,7778,7859,7859,7859,7859,7941,8022,8104,8104,8185,8185,
+8199};
+
+#endif
@@ -0,0 +1,115 @@
+/******************************************************************************
+*  @file    snr_sequential.h
+*  @date    10/16/2026
+*  @version 1.0
+*
+*  @brief Convergence test for the sequential (early terminating) estimate.
+*
+*  @section DESCRIPTION
+*
+*  Built with -DSNR_SEQ_PRECISION=P, snr_est_LUT_correction does not always
+*  wait for all num_samp_to_average noise terms of a dwell.  Every
+*  SNR_SEQ_CHECK terms it scales the partial noiseVarSum_final up to the
+*  whole dwell (snr_seq_scale_noise, a multiply from a table rather than a
+*  divide) and asks snr_seq_converged whether that estimate is already
+*  good enough.  If so it is written out at once and the rest of the dwell
+*  is ignored; otherwise the estimate comes at the end of the dwell as usual.
+*
+*  The noise variance sum is the only part still moving: abs_energy_sum is
+*  complete once the noise terms start.  Its relative standard error after
+*  k terms is taken from the terms themselves,
+*
+*      rel^2 = (k*S2 - S1^2) / ((k-1)*S1^2)
+*
+*  with S1 and S2 the sums of the terms and of their squares, each term
+*  first shifted down by SNR_SEQ_TERM_SHIFT so S2 fits in 64 bits.  An
+*  error of SNR_SEQ_Z standard errors either way moves the lookup index by
+*  at most the next 16 entry step of snr_seq_rel2.  The estimate has
+*  converged when the LUT values at the two ends of that index interval
+*  are at most 2*P tenths of a dB apart.  Because it is the corrected
+*  value that is tested, the test passes sooner where the LUT is flat.
+*
+*  The test is rearranged so it needs no divide: z^2*rel^2 > snr_seq_rel2[j]
+*  is tested as SNR_SEQ_Z2*(k*S2 - S1^2) > snr_seq_rel2[j]*(k-1)*S1^2.  Only
+*  float adds, multiplies and compares are used, all correctly rounded, so
+*  the host model takes the same decisions as the kernel.
+*  Include snr_index.h first.  On the host this file is compiled through
+*  cl_compat.h.
+*
+*******************************************************************************/
+
+#ifndef SNR_SEQUENTIAL_H_
+#define SNR_SEQUENTIAL_H_
+
+#define SNR_SEQ_CHECK_SHIFT  6
+#define SNR_SEQ_CHECK        (1<<SNR_SEQ_CHECK_SHIFT)  // noise terms between convergence tests
+#define SNR_SEQ_DWELL_TERMS  512   // num_samp_to_average, the noise terms of a whole dwell
+#define SNR_SEQ_SCALE_SHIFT  16
+#define SNR_SEQ_MIN_TERMS    64    // noise terms before the first test
+#define SNR_SEQ_TERM_SHIFT   24    // noise terms are at most 2^49, so (t>>24)^2 * 512 < 2^60
+#define SNR_SEQ_Z2           4.0f  // SNR_SEQ_Z = 2 standard errors, about 95%
+#define SNR_SEQ_STEPS        32
+#define SNR_SEQ_STEP_INDEX   16    // lookup index entries per step of snr_seq_rel2
+
+
+// (1 - 10^(-16*(j+1)/1000))^2: the squared relative error of the noise variance
+// sum that moves lookup_index by 16*(j+1) entries in either direction
+__constant float snr_seq_rel2[SNR_SEQ_STEPS]={
+	0.00130833953f, 0.00504577421f, 0.0109485323f, 0.0187748784f,
+	0.0283034287f, 0.0393315905f, 0.0516741164f, 0.0651617651f,
+	0.079640062f, 0.0949681505f, 0.111017729f, 0.127672067f,
+	0.144825095f, 0.16238056f, 0.180251247f, 0.198358256f,
+	0.216630336f, 0.235003267f, 0.253419291f, 0.271826581f,
+	0.290178755f, 0.308434429f, 0.326556794f, 0.344513235f,
+	0.362274978f, 0.379816759f, 0.397116523f, 0.414155144f,
+	0.430916168f, 0.447385577f, 0.463551568f, 0.479404353f};
+
+
+// round(2^16 * SNR_SEQ_DWELL_TERMS / (j*SNR_SEQ_CHECK)): scales a noise sum of
+// j*SNR_SEQ_CHECK terms up to a whole dwell.  Exact for j = 1, 2 and 4, and
+// within 2^-16 otherwise.  A sum of j*SNR_SEQ_CHECK terms is at most 2^40*j,
+// so the product stays below 2^60.
+__constant unsigned int snr_seq_scale[SNR_SEQ_DWELL_TERMS/SNR_SEQ_CHECK]={
+	0, 524288, 262144, 174763, 131072, 104858, 87381, 74898};
+
+
+// noiseVarSum_final of num_terms noise terms, a multiple of SNR_SEQ_CHECK
+// below SNR_SEQ_DWELL_TERMS, scaled up to the whole dwell
+unsigned long snr_seq_scale_noise(unsigned long noiseVarSum_final, int num_terms)
+{
+	return (noiseVarSum_final * snr_seq_scale[num_terms >> SNR_SEQ_CHECK_SHIFT]) >> SNR_SEQ_SCALE_SHIFT;
+}
+
+
+// 1 if the estimate at lookup_index, from num_terms noise terms whose shifted
+// sums are noise_shifted_sum and noise_shifted_sq_sum, is within precision
+// tenths of a dB of the LUT value at both ends of its confidence interval
+int snr_seq_converged(unsigned long noise_shifted_sum, unsigned long noise_shifted_sq_sum,
+	int num_terms, int lookup_index, __constant short *lut, int precision)
+{
+	if (noise_shifted_sum == 0) {
+		return 1;  // no measurable noise
+	}
+	float s1 = (float)noise_shifted_sum;
+	float s2 = (float)noise_shifted_sq_sum;
+	float k = (float)num_terms;
+	float spread = k*s2;
+	spread = spread - s1*s1;
+	float scale = (k - 1.0f)*s1;
+	scale = scale*s1;
+	float z2_spread = SNR_SEQ_Z2*spread;  // z^2*rel^2 times scale
+
+	int step = 0;
+	while (step < SNR_SEQ_STEPS && snr_seq_rel2[step]*scale < z2_spread) {
+		step += 1;
+	}
+	if (step == SNR_SEQ_STEPS) {
+		return 0;  // the interval is wider than the table
+	}
+	int half_width = SNR_SEQ_STEP_INDEX*(step+1);
+	int lo = (lookup_index > half_width) ? lookup_index - half_width : 0;
+	int hi = (lookup_index + half_width < SNR_INDEX_LUT_LEN-1) ? lookup_index + half_width : SNR_INDEX_LUT_LEN-1;
+	return (lut[hi] - lut[lo]) <= 2*precision;
+}
+
+#endif
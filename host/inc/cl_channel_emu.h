@@ -0,0 +1,158 @@
+/******************************************************************************
+*  @file    cl_channel_emu.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Lets the Intel FPGA OpenCL kernels compile unchanged as C++ threads.
+*
+*  @section DESCRIPTION
+*
+*  Include this, then the .cl file, inside a namespace (see
+*  snr_kernels_emu.cpp).  It maps
+*
+*    __kernel, __global, __constant      onto plain C++
+*    char2, uint, ushort                 onto host types
+*    channel T name __attribute__((depth(n)))
+*                                        onto a global of type T that only
+*                                        names the channel, aligned to
+*                                        n*CL_EMU_DEPTH_UNIT to record n
+*    read_channel_intel/write_channel_intel
+*                                        onto a bounded lock-free single
+*                                        producer/single consumer queue per
+*                                        channel, blocking when empty/full
+*
+*  Each queue holds the channel's declared depth, 1 if it declares none,
+*  so a host launch order that would stall on the device also stalls here.
+*  The depth must be a power of two.  Build with -DCL_EMU_CHANNEL_DEPTH=n
+*  to give every channel depth n instead; that only lets the producers run
+*  further ahead, and the kernels' outputs do not change.  Reach a channel's
+*  queue from host code with cl_emu_channel(name).
+*
+*  Kernels that loop forever, like snr_est_LUT_correction, are stopped by
+*  closing their input channel: once it is empty read_channel_intel throws
+*  cl_emu::channel_closed, which the thread running the kernel catches.
+*
+*******************************************************************************/
+
+#ifndef CL_CHANNEL_EMU_H_
+#define CL_CHANNEL_EMU_H_
+
+#include <stddef.h>
+#include <stdio.h>
+#include <math.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "cl_compat.h"
+
+#define CL_EMU_DEPTH_UNIT  64  // more than the alignment of any channel's type
+
+
+namespace cl_emu {
+
+struct channel_closed {};
+
+template<typename T> class SpscQueue {
+public:
+	explicit SpscQueue(size_t depth) : depth(depth), head(0), tail(0), closed(false)
+	{
+		size_t n = 1;
+		while (n < depth)
+			n <<= 1;
+		buf.resize(n);
+		mask = n - 1;
+	}
+
+	// Only call while no kernel is using the channel
+	void reset()
+	{
+		head.store(0);
+		tail.store(0);
+		closed.store(false);
+	}
+
+	void close() { closed.store(true, std::memory_order_release); }
+
+	void write(const T &v)
+	{
+		size_t t = tail.load(std::memory_order_relaxed);
+		for (int spins = 0; t - head.load(std::memory_order_acquire) >= depth; spins++) {
+			if (closed.load(std::memory_order_acquire))
+				throw channel_closed();
+			backoff(spins);
+		}
+		buf[t & mask] = v;
+		tail.store(t + 1, std::memory_order_release);
+	}
+
+	T read()
+	{
+		size_t h = head.load(std::memory_order_relaxed);
+		for (int spins = 0; tail.load(std::memory_order_acquire) == h; spins++) {
+			// Let the consumer drain whatever was written before the close
+			if (closed.load(std::memory_order_acquire) && tail.load(std::memory_order_acquire) == h)
+				throw channel_closed();
+			backoff(spins);
+		}
+		T v = buf[h & mask];
+		head.store(h + 1, std::memory_order_release);
+		return v;
+	}
+
+private:
+	static void backoff(int spins)
+	{
+		if (spins > 64)
+			std::this_thread::yield();
+	}
+
+	std::vector<T> buf;
+	size_t depth;
+	size_t mask;
+	alignas(64) std::atomic<size_t> head;
+	alignas(64) std::atomic<size_t> tail;
+	std::atomic<bool> closed;
+};
+
+// One queue per channel variable, found at compile time.  Use
+// cl_emu_channel, which passes the depth declared for the channel.
+template<typename T, T &C> SpscQueue<T> &channel_queue(size_t depth)
+{
+	static SpscQueue<T> q(depth);
+	return q;
+}
+
+inline size_t channel_depth(size_t alignment)
+{
+#ifdef CL_EMU_CHANNEL_DEPTH
+	return CL_EMU_CHANNEL_DEPTH;
+#else
+	return std::max(alignment / CL_EMU_DEPTH_UNIT, (size_t)1);
+#endif
+}
+
+// Pin t to one core, wrapping around if there are fewer cores than threads
+void pin_thread(std::thread &t, unsigned int index);
+
+}  // namespace cl_emu
+
+
+//**********************************************
+// OpenCL C as C++
+//**********************************************
+#define __kernel
+#define __global
+#define channel
+#define depth(n)                   aligned((n)*CL_EMU_DEPTH_UNIT)
+#define cl_emu_channel(ch)         (::cl_emu::channel_queue<decltype(ch), ch>(::cl_emu::channel_depth(__alignof__(ch))))
+#define read_channel_intel(ch)     (cl_emu_channel(ch).read())
+#define write_channel_intel(ch, v) (cl_emu_channel(ch).write(v))
+
+typedef unsigned int uint;
+typedef unsigned short ushort;
+typedef unsigned char uchar;
+typedef struct char2 { char x; char y; } char2;
+
+#endif
@@ -0,0 +1,32 @@
+/******************************************************************************
+*  @file    cl_compat.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Lets the OpenCL C device headers compile as host C++.
+*
+*  @section DESCRIPTION
+*
+*  device/cordic.h, device/round.h, device/snr_index.h and the SNR LUT
+*  coefficient headers are written in OpenCL C.  Including this header
+*  first maps the few OpenCL qualifiers and built-ins they use onto plain
+*  C++ so the native engine runs the exact same arithmetic as the kernel.
+*  OpenCL int/long are 32/64 bits, which matches the LP64 Linux hosts this
+*  is built on.
+*
+*******************************************************************************/
+
+#ifndef CL_COMPAT_H_
+#define CL_COMPAT_H_
+
+#ifndef __OPENCL_VERSION__
+#define __constant const
+
+// OpenCL clz for ulong, which is 64 for 0
+static inline int clz(unsigned long x)
+{
+	return x ? __builtin_clzl(x) : 64;
+}
+#endif
+
+#endif
@@ -0,0 +1,49 @@
+/******************************************************************************
+*  @file    cordic_batch.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Batch versions of the device CORDIC functions.
+*
+*  @section DESCRIPTION
+*
+*  These run 8 (AVX2) or 16 (AVX-512) CORDICs per instruction with 32 bit
+*  lanes and branch free rotation decisions, and return exactly what the
+*  scalar functions in device/cordic.h return for each element:
+*
+*      mag_cordic_batch          mag_cordic(x[i], y[i]),  |x[i]|,|y[i]| <= 32768
+*      arctan_cordic_batch       arctan_cordic(x[i], y[i])
+*      sin_cos_cordic_24b_batch  sin_cos_cordic_24b(theta[i])
+*
+*  The widest instruction set the CPU supports is picked the first time one
+*  of them is called.  Anything else, and any CPU that is not x86, falls back
+*  to the scalar functions.
+*
+*******************************************************************************/
+
+#ifndef CORDIC_BATCH_H_
+#define CORDIC_BATCH_H_
+
+#include <stddef.h>
+
+// The AVX2 and AVX-512 paths here and in the engines built on them, and the
+// __attribute__((target)) that compiles them, exist only on x86
+#if defined(__x86_64__) || defined(__i386__)
+#define CORDIC_BATCH_X86
+#endif
+
+typedef enum { CORDIC_ISA_SCALAR, CORDIC_ISA_AVX2, CORDIC_ISA_AVX512 } cordic_isa_t;
+
+void mag_cordic_batch(const int *x, const int *y, unsigned int *mag, size_t n);
+void arctan_cordic_batch(const short *x, const short *y, unsigned short *atan, size_t n);
+void sin_cos_cordic_24b_batch(const int *theta, int *cos, int *sin, size_t n);
+
+// Instruction set the batch functions are using
+cordic_isa_t cordic_batch_isa();
+const char *cordic_batch_isa_name(cordic_isa_t isa);
+
+// Use a narrower instruction set, e.g. to compare against the scalar path.
+// Returns false, and changes nothing, if the CPU does not support isa.
+bool cordic_batch_force_isa(cordic_isa_t isa);
+
+#endif
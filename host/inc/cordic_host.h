@@ -0,0 +1,30 @@
+/******************************************************************************
+*  @file    cordic_host.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Host prototypes for the device CORDIC compiled in cordic.cpp.
+*
+*  @section DESCRIPTION
+*
+*  These must match the definitions in device/cordic.h exactly.
+*
+*******************************************************************************/
+
+#ifndef CORDIC_HOST_H_
+#define CORDIC_HOST_H_
+
+typedef struct cos_sin {
+	int cos;
+	int sin;
+} cos_sin;
+
+#define ATANTABLESZ 24
+extern const int atanTable[];
+
+unsigned int mag_cordic(int x, int y);
+unsigned short arctan_cordic(short x, short y);
+unsigned int arctan_cordic_24b(short x, short y);
+struct cos_sin sin_cos_cordic_24b(int theta);
+
+#endif
@@ -0,0 +1,107 @@
+/******************************************************************************
+*  @file    iq_async.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Reads binary I/Q captures ahead of the estimator with io_uring.
+*
+*  @section DESCRIPTION
+*
+*  IqAsyncReader takes the same captures as IqStreamReader (planar I and Q
+*  files, raw or .iq8, or one file of interleaved char2 pairs) and returns
+*  the same chunk views, but reads with read(2) style I/O instead of
+*  mapping the files.  That suits replaying captures from NVMe, where page
+*  faults on a mapping leave one read in flight at a time.
+*
+*  The reader owns depth chunk buffers, registered with the ring once so
+*  the kernel does not have to map them on every read.  Chunks are read
+*  into the buffers in turn and up to depth of them are in flight at once.
+*  next() hands out the oldest chunk in place and, on the following call,
+*  queues the read after the last one in flight into its buffer.  While
+*  the estimator works on one chunk the next depth-1 are being read.
+*
+*  Where io_uring is missing (older kernels, or a seccomp policy that
+*  blocks it) the reader falls back to pread of each chunk when it is
+*  needed; the views and estimates are the same.
+*
+*******************************************************************************/
+
+#ifndef IQ_ASYNC_H_
+#define IQ_ASYNC_H_
+
+#include <stddef.h>
+#include <vector>
+#include "iq_file.h"
+
+#define IQ_ASYNC_DEPTH  4  // chunks in flight
+
+
+class IqAsyncReader {
+public:
+	explicit IqAsyncReader(size_t chunk_samples = IQ_STREAM_CHUNK, unsigned int depth = IQ_ASYNC_DEPTH);
+	~IqAsyncReader();
+
+	// Planar capture: an I file and a Q file of the same length
+	bool open(const char *file_I, const char *file_Q);
+	// Interleaved capture: I0 Q0 I1 Q1 ...
+	bool open(const char *file_iq);
+	void close();
+
+	unsigned long long num_samples() const { return total; }
+	bool interleaved() const { return is_interleaved; }
+	// false if the reads fall back to pread
+	bool uring() const { return ring_fd >= 0; }
+
+	// The next chunk of up to chunk_samples samples; false at the end or on
+	// a read error.  The view stays valid until the next call.
+	bool next(iq_view_t *view);
+
+private:
+	IqAsyncReader(const IqAsyncReader &);
+	IqAsyncReader &operator=(const IqAsyncReader &);
+
+	struct Slot {
+		char *buf;                   // planar: I then Q; interleaved: the pairs
+		unsigned long long chunk;    // chunk number being read into buf
+		int pending;                 // reads not yet completed
+		bool failed;
+	};
+
+	bool open_file(int i, const char *filename, unsigned long long *num_bytes);
+	bool setup_ring();
+	void teardown_ring();
+	void queue_chunk(unsigned int s, unsigned long long chunk);
+	void submit();
+	bool wait_slot(unsigned int s);
+	bool finish_read(unsigned int s, int plane, long done);
+	size_t chunk_len(unsigned long long chunk) const;
+
+	size_t chunk_samples;
+	unsigned int depth;
+	unsigned long long total;
+	unsigned long long num_chunks;
+	unsigned long long next_chunk;   // next chunk to hand out
+	unsigned long long queued;       // chunks queued so far
+	bool is_interleaved;
+	bool held;                       // the last chunk handed out is still in its slot
+	int fd[2];
+	size_t data_offset[2];           // IQ8_HEADER_LEN for .iq8 files, otherwise 0
+	std::vector<Slot> slots;
+	std::vector<char> planes;        // I then Q, for deinterleaving
+
+	// io_uring state, ring_fd < 0 when reading with pread
+	int ring_fd;
+	bool fixed_buffers;              // buffers registered, reads use READ_FIXED
+	void *sq_ring;
+	void *cq_ring;
+	void *sqes;
+	size_t sq_ring_len;
+	size_t cq_ring_len;
+	size_t sqes_len;
+	unsigned int *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned int *cq_head, *cq_tail, *cq_mask;
+	void *cqes;
+	unsigned int to_submit;
+};
+
+#endif
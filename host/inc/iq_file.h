@@ -0,0 +1,147 @@
+/******************************************************************************
+*  @file    iq_file.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Loads I or Q test vectors, caching the parsed samples in a binary
+*  .iq8 sidecar next to the text file, and streams binary I/Q captures.
+*
+*  @section DESCRIPTION
+*
+*  The text vectors hold one integer per line.  The first load of a file
+*  parses it on all cores and writes <file>.iq8; later loads memory-map the
+*  sidecar and do no parsing at all.  The sidecar records the size and
+*  modification time of the text file it came from and is ignored (and
+*  rewritten) once the text file changes.
+*
+*  .iq8 layout, host byte order:
+*
+*    uint32 magic IQ8_MAGIC
+*    uint32 version IQ8_VERSION
+*    uint64 num_samples
+*    uint64 source_size            size of the text file in bytes
+*    int64  source_mtime_ns        its modification time
+*    ... zero padding up to IQ8_HEADER_LEN bytes
+*    int8   samples[num_samples]
+*
+*  The samples start IQ8_HEADER_LEN bytes into a page aligned mapping, so
+*  they are aligned for the OpenCL runtime too.
+*
+*  IqStreamReader walks binary int8 captures of any size in fixed size
+*  chunks: either two planes (raw I and Q files, or .iq8 files) or one
+*  file of interleaved char2 I/Q pairs.  The files are memory-mapped and
+*  the pages behind each chunk are dropped once the reader moves past it,
+*  so memory use stays at about one chunk whatever the file size.
+*
+*******************************************************************************/
+
+#ifndef IQ_FILE_H_
+#define IQ_FILE_H_
+
+#include <stddef.h>
+#include <vector>
+
+#define IQ8_MAGIC       0x00385149  // "IQ8"
+#define IQ8_VERSION     1
+#define IQ8_HEADER_LEN  64
+
+#define IQ_STREAM_CHUNK  (1024*1024)  // samples per chunk, a whole number of dwells
+
+
+// A read only memory mapping of a whole file, unmapped by the destructor
+class MappedFile {
+public:
+	MappedFile() : base(NULL), len(0) {}
+	~MappedFile() { close(); }
+
+	bool open(const char *filename);
+	void close();
+
+	const char *data() const { return (const char *)base; }
+	size_t size() const { return len; }
+
+	// madvise the whole pages within [offset, offset+length)
+	void advise(size_t offset, size_t length, int advice);
+
+private:
+	MappedFile(const MappedFile &);
+	MappedFile &operator=(const MappedFile &);
+
+	void *base;
+	size_t len;
+};
+
+
+// Parse a text vector the way read_test_vector_file_char always has: one
+// sample per line, the line's leading integer truncated to char, 0 if the
+// line has none.  Large files are split at line boundaries and parsed on
+// all cores.  Returns -1 if the file cannot be read.
+int parse_text_vector(const char *filename, std::vector<char> &samples);
+
+// A text vector's samples, from its .iq8 sidecar when that is current,
+// otherwise parsed and then cached in a new sidecar.  If the sidecar
+// cannot be written (e.g. a read only directory) the samples are still
+// returned.
+class IqVectorFile {
+public:
+	IqVectorFile() : from_sidecar(false) {}
+
+	int load(const char *filename);
+
+	const char *data() const { return from_sidecar ? sidecar.data() + IQ8_HEADER_LEN : parsed.data(); }
+	size_t size() const { return from_sidecar ? sidecar.size() - IQ8_HEADER_LEN : parsed.size(); }
+	bool cached() const { return from_sidecar; }
+
+private:
+	bool from_sidecar;
+	MappedFile sidecar;
+	std::vector<char> parsed;
+};
+
+
+// One chunk of a stream.  I and Q are always valid.  For planar captures
+// they point into the mappings; for interleaved ones iq points into the
+// mapping and I and Q into the reader's deinterleave buffer.  The views stay
+// valid until the next call to next().
+typedef struct iq_view_t {
+	unsigned long long first_sample;
+	size_t num_samples;
+	const char *I;
+	const char *Q;
+	const char *iq;                  // interleaved captures only, otherwise NULL
+} iq_view_t;
+
+class IqStreamReader {
+public:
+	explicit IqStreamReader(size_t chunk_samples = IQ_STREAM_CHUNK)
+		: chunk_samples(chunk_samples), total(0), pos(0), is_interleaved(false) {}
+
+	// Planar capture: an I file and a Q file of the same length
+	bool open(const char *file_I, const char *file_Q);
+	// Interleaved capture: I0 Q0 I1 Q1 ...
+	bool open(const char *file_iq);
+
+	unsigned long long num_samples() const { return total; }
+	bool interleaved() const { return is_interleaved; }
+
+	// The next chunk of up to chunk_samples samples; false at the end
+	bool next(iq_view_t *view);
+	void rewind() { pos = 0; }
+
+private:
+	IqStreamReader(const IqStreamReader &);
+	IqStreamReader &operator=(const IqStreamReader &);
+
+	bool map_samples(int i, const char *filename);
+
+	size_t chunk_samples;
+	unsigned long long total;
+	unsigned long long pos;
+	bool is_interleaved;
+	MappedFile map[2];
+	const char *samples[2];          // start of the samples in each mapping
+	size_t data_offset[2];           // IQ8_HEADER_LEN for .iq8 files, otherwise 0
+	std::vector<char> planes;        // I then Q, for deinterleaving
+};
+
+#endif
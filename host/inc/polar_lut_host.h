@@ -0,0 +1,68 @@
+/******************************************************************************
+*  @file    polar_lut_host.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Host side table lookups that replace the CORDIC for char I/Q.
+*
+*  @section DESCRIPTION
+*
+*  mag_lut_int8(x, y) returns exactly mag_cordic((int)x<<8, (int)y<<8) and
+*  arctan_lut_int8(x, y) returns exactly arctan_cordic(x, y), using the
+*  first quadrant tables in device/polar_tables_int8.h (generated by
+*  tools/gen_polar_tables.cpp).  The device equivalents are in
+*  device/polar_lut.h.
+*
+*******************************************************************************/
+
+#ifndef POLAR_LUT_HOST_H_
+#define POLAR_LUT_HOST_H_
+
+#define POLAR_LUT_DIM  129  // |x| and |y| of a char run from 0 to 128
+
+// Defined in polar_lut.cpp
+extern const unsigned short mag_table_int8[];
+extern const unsigned short arctan_table_int8[];
+
+
+// The magnitude only depends on |x| and |y|
+static inline unsigned int polar_lut_fold_mag(const unsigned short *tab, char x, char y)
+{
+	int xa = x < 0 ? -x : x;
+	int ya = y < 0 ? -y : y;
+	return tab[xa*POLAR_LUT_DIM + ya];
+}
+
+// Same axis special cases and quadrant rotation as arctan_cordic/checkQuadrant
+static inline unsigned short polar_lut_fold_arctan(const unsigned short *tab, char x, char y)
+{
+	int quadrant, xf, yf;
+
+	if (x == 0)
+		return (y >= 0) ? 16384 : 49152;
+	if (y == 0)
+		return (x >= 0) ? 0 : 32768;
+
+	if (x > 0 && y > 0) {
+		quadrant = 0; xf = x; yf = y;
+	} else if (x < 0 && y > 0) {
+		quadrant = 1; xf = y; yf = -x;
+	} else if (x < 0 && y < 0) {
+		quadrant = 2; xf = -x; yf = -y;
+	} else {
+		quadrant = 3; xf = -y; yf = x;
+	}
+	return (unsigned short)((quadrant<<14) | tab[xf*POLAR_LUT_DIM + yf]);
+}
+
+static inline unsigned int mag_lut_int8(char x, char y)
+{
+	return polar_lut_fold_mag(mag_table_int8, x, y);
+}
+
+static inline unsigned short arctan_lut_int8(char x, char y)
+{
+	return polar_lut_fold_arctan(arctan_table_int8, x, y);
+}
+
+#endif
@@ -0,0 +1,75 @@
+/******************************************************************************
+*  @file    snr_agc.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Block AGC that brings any input level to the operating point of
+*  SNR_estimator_LUT_coefficients_AGC_at_21.h.
+*
+*  @section DESCRIPTION
+*
+*  The LUT corrects the estimator's bias at one input level, the one the
+*  *_21Mag test vectors are recorded at.  SnrBlockAgc scales each block of
+*  SNR_AGC_BLOCK samples to int8 so that its signal amplitude is
+*  target_rms, saturating anything that does not fit.  The blocks are one
+*  dwell long, so feed it from a dwell boundary and every estimate sees a
+*  single gain.
+*
+*  The signal level is measured over about the last SNR_AGC_SPAN blocks,
+*  and the gain only follows it once the measurement is significant.  That
+*  takes about 0 dB SNR after one dwell and -5 dB after SNR_AGC_SPAN
+*  dwells; until then the gain is held, at first at unity (the sample's
+*  int8 value), so input that is already at the LUT's level estimates the
+*  same with or without the AGC.  Feed one sample type per SnrBlockAgc.
+*
+*  The power is an exact integer sum and the gain is applied in fixed
+*  point (gain = gain_q * 2^-shift with a 15 bit gain_q), so the output
+*  does not depend on the instruction set.  Both passes run with one SIMD
+*  lane per sample, picked like the batch CORDIC (cordic_batch_isa()).
+*  sc16 and fc32 input (see snr_sample.h) come out as int8 directly.
+*
+*******************************************************************************/
+
+#ifndef SNR_AGC_H_
+#define SNR_AGC_H_
+
+#include <stddef.h>
+#include "snr_engine.h"
+
+#define SNR_AGC_BLOCK       SNR_DWELL_LENGTH  // one gain per dwell
+#define SNR_AGC_TARGET_RMS  21.0f             // I/Q amplitude the LUT was made at
+#define SNR_AGC_SPAN        16                // blocks the signal level is measured over
+
+
+class SnrBlockAgc {
+public:
+	explicit SnrBlockAgc(float target_rms = SNR_AGC_TARGET_RMS);
+
+	// Forget the measured level and return to unity gain
+	void reset();
+
+	// Scale n samples to int8, one gain per SNR_AGC_BLOCK starting at I[0].
+	// out_I/out_Q may be I/Q for char input.
+	void process(const char *I, const char *Q, char *out_I, char *out_Q, size_t n);
+	void process(const short *I, const short *Q, char *out_I, char *out_Q, size_t n);
+	void process(const float *I, const float *Q, char *out_I, char *out_Q, size_t n);
+
+	float target() const { return target_rms; }
+	// Gain of the last block, in output units per input unit (for fc32, per 2^-15)
+	double last_gain() const { return gain; }
+	// I or Q values saturated so far
+	unsigned long long clipped() const { return num_clipped; }
+
+private:
+	template <typename T> void process_blocks(const T *I, const T *Q, char *out_I, char *out_Q, size_t n);
+
+	float target_rms;
+	double gain;
+	bool measured;       // gain has been set from a significant signal level
+	double sum_m2;       // weighted moments of the recent blocks, see process_blocks
+	double sum_m4;
+	double sum_n;
+	unsigned long long num_clipped;
+};
+
+#endif
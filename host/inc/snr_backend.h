@@ -0,0 +1,94 @@
+/******************************************************************************
+*  @file    snr_backend.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Interface the host uses to run the SNR estimator on a capture.
+*
+*  @section DESCRIPTION
+*
+*  A backend turns an I/Q capture into one LUT corrected estimate per
+*  SNR_DWELL_LENGTH samples, exactly like the data_in ->
+*  snr_est_LUT_correction -> data_out kernels.  The host picks one at run
+*  time:
+*
+*    opencl  the kernels on an FPGA or the Intel emulator (main.cpp)
+*    cpu     SnrEngine, with the dwells split across all cores
+*    emu     the .cl kernels compiled as C++ on emulated channels
+*
+*  Each backend instance holds its own state, so several threads can each
+*  drive their own instance.  A single instance must only be used by one
+*  thread at a time.  emu instances share the emulated channels, so their
+*  runs are serialized.
+*
+*******************************************************************************/
+
+#ifndef SNR_BACKEND_H_
+#define SNR_BACKEND_H_
+
+#include <vector>
+#include "snr_engine.h"
+
+// Fill est_offsets[0 .. num_captures] with where each capture's estimates
+// start in a batch, from the capture_offsets[0 .. num_captures] sample table.
+// Returns the total number of estimates.
+static inline unsigned int snr_batch_est_offsets(const unsigned int *capture_offsets,
+	unsigned int num_captures, unsigned int *est_offsets)
+{
+	est_offsets[0] = 0;
+	for (unsigned int c = 0; c < num_captures; c++)
+		est_offsets[c+1] = est_offsets[c] + (capture_offsets[c+1] - capture_offsets[c]) / SNR_DWELL_LENGTH;
+	return est_offsets[num_captures];
+}
+
+class SnrBackend {
+public:
+	SnrBackend() : last_samples(0), last_seconds(0) {}
+	virtual ~SnrBackend() {}
+
+	virtual const char *name() const = 0;
+
+	// Set up the backend.  Returns false if it cannot run on this machine.
+	virtual bool init() = 0;
+
+	// Estimate num_samples samples of I/Q, writing num_samples/SNR_DWELL_LENGTH
+	// estimates to snr_est_out.  Returns false on failure.
+	virtual bool run(const char *dataIn_I, const char *dataIn_Q, int num_samples, short *snr_est_out) = 0;
+
+	// Estimate num_captures captures packed back to back in dataIn_I/Q, with
+	// capture c at samples capture_offsets[c] .. capture_offsets[c+1]-1.  Each
+	// capture starts a new dwell, and its estimates are written to snr_est_out
+	// starting at est_offsets[c] as filled in by snr_batch_est_offsets.  The
+	// default runs the captures one at a time.
+	virtual bool run_batch(const char *dataIn_I, const char *dataIn_Q,
+		const unsigned int *capture_offsets, unsigned int num_captures, short *snr_est_out)
+	{
+		std::vector<unsigned int> est_offsets(num_captures+1);
+		snr_batch_est_offsets(capture_offsets, num_captures, est_offsets.data());
+
+		double seconds = 0;
+		for (unsigned int c = 0; c < num_captures; c++) {
+			unsigned int start = capture_offsets[c];
+			if (!run(dataIn_I + start, dataIn_Q + start, capture_offsets[c+1] - start,
+				snr_est_out + est_offsets[c]))
+				return false;
+			seconds += last_seconds;
+		}
+		last_samples = capture_offsets[num_captures];
+		last_seconds = seconds;
+		return true;
+	}
+
+	// Samples per second of the last run
+	double throughput() const { return last_seconds > 0 ? last_samples/last_seconds : 0; }
+	double run_seconds() const { return last_seconds; }
+
+protected:
+	double last_samples;
+	double last_seconds;
+};
+
+// The native backends, "cpu" or "emu".  NULL for any other name.
+SnrBackend *create_native_backend(const char *name);
+
+#endif
@@ -0,0 +1,56 @@
+/******************************************************************************
+*  @file    snr_daemon.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Keeps a backend initialized and serves estimation jobs over a
+*  Unix domain socket.
+*
+*  @section DESCRIPTION
+*
+*  Starting the OpenCL backend programs the FPGA, builds the program and
+*  makes the queues, kernels and buffers.  The daemon does that once and
+*  then runs every job on the same warm backend, so a job costs only its
+*  transfer and kernel time.
+*
+*  A client connects and may send any number of jobs on the connection.
+*  All fields are host byte order, since both ends are on one machine:
+*
+*    job    uint32 magic SNR_DAEMON_JOB_MAGIC
+*           uint32 num_captures
+*           uint32 capture_offsets[num_captures+1]   as for SnrBackend::run_batch
+*           char   I[capture_offsets[num_captures]]
+*           char   Q[capture_offsets[num_captures]]
+*
+*    reply  uint32 magic SNR_DAEMON_REPLY_MAGIC
+*           int32  status                            0 on success
+*           uint32 num_estimates
+*           short  snr_est[num_estimates]            tenths of a dB
+*
+*  Connections are served one at a time, because the backends are not
+*  reentrant.
+*
+*******************************************************************************/
+
+#ifndef SNR_DAEMON_H_
+#define SNR_DAEMON_H_
+
+#include "snr_backend.h"
+
+#define SNR_DAEMON_JOB_MAGIC    0x4a524e53  // "SNRJ"
+#define SNR_DAEMON_REPLY_MAGIC  0x52524e53  // "SNRR"
+#define SNR_DAEMON_MAX_SAMPLES  (1u<<30)
+#define SNR_DAEMON_MAX_CAPTURES (1u<<24)
+
+// Serve jobs on socket_path with backend until SIGINT or SIGTERM.  Any
+// stale socket file is replaced.  Returns 0 on a clean shutdown.
+int snr_daemon_serve(SnrBackend *backend, const char *socket_path);
+
+// Client side of one job.  fd is a connection from snr_daemon_connect and
+// can be reused for further jobs.  snr_est_out must hold every estimate, see
+// snr_batch_est_offsets.  Returns the number of estimates, or -1 on error.
+int snr_daemon_connect(const char *socket_path);
+int snr_daemon_request(int fd, const char *dataIn_I, const char *dataIn_Q,
+	const unsigned int *capture_offsets, unsigned int num_captures, short *snr_est_out);
+
+#endif
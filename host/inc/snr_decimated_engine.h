@@ -0,0 +1,128 @@
+/******************************************************************************
+*  @file    snr_decimated_engine.h
+*  @date    10/16/2026
+*  @version 1.0
+*
+*  @brief Native SNR estimator that only looks at one sample in k.
+*
+*  @section DESCRIPTION
+*
+*  For low priority monitoring the estimator can run on a subset of each
+*  SNR_DWELL_LENGTH sample dwell.  SnrDecimatedEngine takes one sample from
+*  every group of k, either the first of each group or a random one, so
+*  each dwell still gives one estimate but from SNR_DWELL_LENGTH/k samples.
+*  Only those samples have their magnitude computed, which is most of the
+*  cost.  The estimator then runs with num_samp_to_average
+*  SNR_NUM_SAMP_TO_AVG/k, the arithmetic of snr_window_step in
+*  device/SNR_estimator_multi_window.cl, and the correction LUT made for
+*  that window (tools/gen_snr_lut.cpp).  At k = 1 it is SnrEngine.
+*
+*  Random picks keep a periodic pattern in the signal (pilots, a frequency
+*  offset) from lining up with the decimation.  They come from a xorshift32
+*  generator, so a given seed always picks the same samples.
+*
+*  Fewer samples make a noisier estimate.  Against the full dwell estimate,
+*  over the 12 dwells of the bin/ test vectors with first-of-group picks
+*  and random picks from seeds 1 to SNR_DECIM_SEEDS:
+*
+*      k    rms error   largest error (SNR_DECIM_BOUND_<k>)
+*      2    0.3 dB      1.3 dB
+*      4    0.7 dB      2.7 dB
+*      8    1.1 dB      6.4 dB, at 30 dB where the k = 8 LUT is steepest
+*
+*  -g checks that the vectors stay within these bounds.
+*
+*******************************************************************************/
+
+#ifndef SNR_DECIMATED_ENGINE_H_
+#define SNR_DECIMATED_ENGINE_H_
+
+#include <stddef.h>
+#include <vector>
+#include "snr_engine.h"
+
+#define SNR_DECIM_MAX      8    // k of 1, 2, 4 or 8, the windows there are LUTs for
+#define SNR_DECIM_SEEDS    64   // random pick seeds the bounds were measured over
+#define SNR_DECIM_BOUND_2  13   // tenths of a dB, see above
+#define SNR_DECIM_BOUND_4  27
+#define SNR_DECIM_BOUND_8  64
+
+
+class SnrDecimatedEngine {
+public:
+	// decimation must be 1, 2, 4 or 8 (valid_decimation), anything else
+	// fails an assert.  random picks a random sample out of each group
+	// instead of the first.
+	SnrDecimatedEngine(unsigned int decimation, bool random = false, unsigned int seed = 1);
+
+	void reset();
+
+	// Feed n samples.  I and Q are separate planes of char, short or float
+	// samples, see snr_sample.h.
+	template <typename T> void push(const T *I, const T *Q, size_t n);
+
+	// Move up to max_estimates pending estimates into estimates, oldest first.
+	// Returns the number written.
+	size_t poll(snr_estimate_t *estimates, size_t max_estimates);
+	size_t pending() const { return out.size() - out_rd; }
+
+	unsigned int decimation() const { return k; }
+	unsigned long long samples_pushed() const { return sample_cnt; }
+	unsigned long long samples_used() const { return used_cnt; }
+
+	// true for the decimations there is a LUT for: 1, 2, 4 and 8
+	static bool valid_decimation(unsigned int decimation);
+
+	// Largest error seen on the test vectors at this decimation, tenths of a dB
+	static int accuracy_bound(unsigned int decimation);
+
+private:
+	void next_pick();  // pick a sample of the next group
+	void push_mags(const unsigned int *mag, const unsigned long long *sample_ind, size_t n);
+
+	unsigned int k;
+	bool random;
+	unsigned int seed;
+	unsigned int rng;               // xorshift32 state
+	unsigned long long sample_cnt;
+	unsigned long long used_cnt;
+	unsigned long long group;       // first sample of the group pick is in
+	unsigned long long pick;        // index of the next sample to use
+
+	// The estimator on the picked samples, as in snr_window_step
+	int num_samp_to_average;
+	const short *lut;
+	std::vector<unsigned short> delay_line;
+	unsigned int head;
+	int while_loop_cntr;
+	unsigned long abs_energy_sum;
+	unsigned long noiseVarSum;
+
+	std::vector<snr_estimate_t> out;
+	size_t out_rd;
+};
+
+
+template <typename T> void SnrDecimatedEngine::push(const T *I, const T *Q, size_t n)
+{
+	T pick_I[SNR_SAMPLE_BLOCK], pick_Q[SNR_SAMPLE_BLOCK];
+	unsigned long long pick_ind[SNR_SAMPLE_BLOCK];
+	unsigned int mag[SNR_SAMPLE_BLOCK];
+	size_t m = 0;
+	while (pick < sample_cnt + n) {
+		size_t i = (size_t)(pick - sample_cnt);
+		pick_I[m] = I[i];
+		pick_Q[m] = Q[i];
+		pick_ind[m] = pick;
+		m++;
+		next_pick();
+		if (m == SNR_SAMPLE_BLOCK || pick >= sample_cnt + n) {
+			snr_mag_block(pick_I, pick_Q, 1, mag, m);
+			push_mags(mag, pick_ind, m);
+			m = 0;
+		}
+	}
+	sample_cnt += n;
+}
+
+#endif
@@ -0,0 +1,155 @@
+/******************************************************************************
+*  @file    snr_engine.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Native C++ model of the SNR estimator kernels.
+*
+*  @section DESCRIPTION
+*
+*  SnrEngine reproduces data_in -> snr_est_LUT_correction -> data_out from
+*  device/SNR_estimator_LUT_correction_top.cl bit for bit, so the estimator
+*  can be run on machines without the Intel FPGA OpenCL runtime.  Samples
+*  are pushed in as they arrive and estimates are polled out; a new estimate
+*  is produced every SNR_DWELL_LENGTH samples.
+*
+*  With a hop length H the engine instead follows the kernel built with
+*  -DSNR_HOP_LENGTH=H: the accumulators are never restarted, the noise
+*  variance sum slides along with abs_energy_sum, and an estimate of the
+*  last SNR_DWELL_LENGTH samples comes out every H samples.  Each one is
+*  the estimate a dwell ending on the same sample would give.
+*
+*  With a precision P the engine follows the kernel built with
+*  -DSNR_SEQ_PRECISION=P: each dwell's estimate comes out as soon as
+*  snr_seq_converged (device/snr_sequential.h) finds it within P tenths of
+*  a dB, and at the end of the dwell otherwise.  The samples left in the
+*  dwell after an early estimate are skipped without computing their
+*  magnitudes.
+*
+*  push takes int8, sc16 (short) or fc32 (float) samples, see snr_sample.h.
+*
+*******************************************************************************/
+
+#ifndef SNR_ENGINE_H_
+#define SNR_ENGINE_H_
+
+#include <stddef.h>
+#include <vector>
+#include "snr_sample.h"
+
+// These mirror the constants in the device code and must be kept in sync
+#define SNR_DWELL_LENGTH     1024  // data_in raises sof every SNR_DWELL_LENGTH samples
+#define SNR_SYMBOL_LENGTH    512   // SNR_estimator_LUT_correction.cl delay line length
+#define SNR_NUM_SAMP_TO_AVG  512   // num_samp_to_average
+#define SNR_BITS_TO_SHIFT    9     // bits_to_shift = log2(num_samp_to_average)
+#define SNR_LUT_LEN          4096  // SNR_estimator_LUT_coefficients entries
+#define SNR_LUT_OFFSET       1388  // LUT index of a 0 dB raw estimate, 0.01 dB per entry
+
+
+typedef struct snr_estimate_t {
+	unsigned long long sample_ind;   // index of the input sample that completed the dwell
+	unsigned long numerator;
+	unsigned long noiseVarSum_final;
+	short snr_est;                   // LUT corrected estimate in tenths of a dB
+} snr_estimate_t;
+
+
+// Integer path at the end of the kernel (device/snr_index.h): the LUT index
+// of 10*log10(numerator/noiseVarSum_final) from leading zero counts and a
+// log2 table
+int snr_lut_index(unsigned long numerator, unsigned long noiseVarSum_final);
+// The float path it replaced, still built with -DSNR_FLOAT_INDEX: the same
+// index through a single precision divide, log10 and round
+int snr_lookup_index(unsigned long numerator, unsigned long noiseVarSum_final);
+short snr_lut_lookup(int lookup_index);
+
+// The end of dwell step of the kernel: carry rounded noiseVarSum_final,
+// numerator and the LUT corrected estimate from the two accumulators
+snr_estimate_t snr_make_estimate(unsigned long abs_energy_sum, unsigned long noiseVarSum,
+	unsigned long long sample_ind);
+
+
+class SnrEngine {
+public:
+	// hop_length 0 gives one estimate per dwell, otherwise one every
+	// hop_length samples once the first SNR_DWELL_LENGTH have been pushed.
+	// seq_precision > 0 (tenths of a dB) ends each dwell early once its
+	// estimate is that precise; it is ignored with a hop_length.
+	explicit SnrEngine(unsigned int hop_length = 0, int seq_precision = 0);
+
+	// Drop all state, as if the kernels had just been launched
+	void reset();
+
+	// Feed n samples.  I and Q are separate planes, as read from the test
+	// vectors, of char, short or float samples.
+	template <typename T> void push(const T *I, const T *Q, size_t n);
+
+	// Move up to max_estimates pending estimates into estimates, oldest first.
+	// Returns the number written.
+	size_t poll(snr_estimate_t *estimates, size_t max_estimates);
+	size_t pending() const { return out.size() - out_rd; }
+
+	unsigned long long samples_pushed() const { return sample_cnt; }
+	unsigned int hop() const { return hop_length; }
+	// Samples of the dwells that ended early and did not need a magnitude
+	unsigned long long samples_skipped() const { return skipped_cnt; }
+
+private:
+	void push_mags(const unsigned int *mag, size_t n);
+	void push_mags_hop(const unsigned int *mag, size_t n);
+	void push_mags_seq(const unsigned int *mag, size_t n);
+	size_t skip_seq(size_t n);  // skip up to n samples of a dwell already estimated
+	size_t seq_block(size_t m) const;  // up to m samples, ending at the next convergence test
+
+	// data_in state
+	unsigned long long sample_cnt;
+
+	// snr_est_LUT_correction state.  The delay line is circular and holds
+	// magnitudes: delay_line[head] is the magnitude of the sample written
+	// SNR_SYMBOL_LENGTH+1 samples ago.
+	unsigned short delay_line[SNR_SYMBOL_LENGTH+1];
+	unsigned int head;
+	unsigned long noiseVarSum;
+	unsigned long abs_energy_sum;
+	int while_loop_cntr;
+
+	// Hop mode: the last SNR_NUM_SAMP_TO_AVG terms of noiseVarSum, circular
+	unsigned int hop_length;
+	unsigned int hop_cnt;
+	unsigned long noise_line[SNR_NUM_SAMP_TO_AVG];
+	unsigned int noise_head;
+
+	// Sequential mode: shifted sums of the noise terms for snr_seq_converged
+	int seq_precision;
+	bool seq_done;
+	unsigned long noise_shifted_sum;
+	unsigned long noise_shifted_sq_sum;
+	unsigned long long skipped_cnt;
+
+	// SNR_DOUT
+	std::vector<snr_estimate_t> out;
+	size_t out_rd;
+};
+
+
+template <typename T> void SnrEngine::push(const T *I, const T *Q, size_t n)
+{
+	unsigned int mag[SNR_SAMPLE_BLOCK];
+	size_t i = 0;
+	while (i < n) {
+		// After an early estimate the rest of its dwell needs no magnitudes
+		if (seq_done) {
+			i += skip_seq(n - i);
+			if (i == n)
+				break;
+		}
+		size_t m = (n - i < SNR_SAMPLE_BLOCK) ? n - i : SNR_SAMPLE_BLOCK;
+		if (seq_precision > 0)
+			m = seq_block(m);
+		snr_mag_block(I + i, Q + i, 1, mag, m);
+		push_mags(mag, m);
+		i += m;
+	}
+}
+
+#endif
@@ -0,0 +1,27 @@
+/******************************************************************************
+*  @file    snr_kernels_emu.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Runs the SNR estimator .cl kernels natively, one thread per kernel.
+*
+*******************************************************************************/
+
+#ifndef SNR_KERNELS_EMU_H_
+#define SNR_KERNELS_EMU_H_
+
+// Equivalent of enqueueing data_in, snr_est_LUT_correction and data_out from
+// device/SNR_estimator_LUT_correction_top.cl and waiting for data_out.  The
+// kernels run unchanged on three pinned threads connected by the emulated
+// channels.  Returns 0 on success.
+int run_snr_kernels_emulated(const char *dataIn_I, const char *dataIn_Q, unsigned int dataInLen,
+	unsigned int slotLen, short *snr_est_out, int num_output_frames);
+
+// Same for data_in_batch and data_out_batch: num_captures captures packed
+// back to back, with the capture_offsets and est_offsets tables the host
+// passes to the kernels (num_captures+1 entries each).
+int run_snr_kernels_batch_emulated(const char *dataIn_I, const char *dataIn_Q,
+	const unsigned int *capture_offsets, const unsigned int *est_offsets, unsigned int num_captures,
+	unsigned int slotLen, short *snr_est_out);
+
+#endif
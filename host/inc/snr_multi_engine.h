@@ -0,0 +1,80 @@
+/******************************************************************************
+*  @file    snr_multi_engine.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Many channel version of SnrEngine with structure-of-arrays state.
+*
+*  @section DESCRIPTION
+*
+*  SnrMultiEngine runs one copy of snr_est_LUT_correction per carrier, all
+*  in lock step: every channel sees sof at the same sample and produces its
+*  estimate at the same sample, exactly as SnrEngine would on that channel
+*  alone.  The per-channel state is kept in structure-of-arrays form so one
+*  SIMD lane updates one channel (4, 8 or 16 channels per instruction for
+*  SSE2, AVX2 and AVX-512):
+*
+*    delay_line    [SNR_SYMBOL_LENGTH+1][num_channels] ushort magnitudes
+*    abs_energy_sum[num_channels] uint   (at most 513*46341 < 2^25)
+*    noiseVarSum   [num_channels] uint64
+*
+*  That is about 1 KB per channel, so 1000 channels fit in a 1-2 MB L2.
+*
+*******************************************************************************/
+
+#ifndef SNR_MULTI_ENGINE_H_
+#define SNR_MULTI_ENGINE_H_
+
+#include <stddef.h>
+#include <vector>
+#include "snr_engine.h"
+
+
+class SnrMultiEngine {
+public:
+	explicit SnrMultiEngine(unsigned int num_channels);
+
+	void reset();
+
+	// Feed num_samples time steps.  Each time step is num_channels
+	// interleaved samples, i.e. iq[(t*num_channels + ch)*2] is I and the
+	// next element is Q.  T is char, short or float, see snr_sample.h.
+	template <typename T> void push(const T *iq, size_t num_samples);
+
+	// Copy the oldest pending dwell's estimates, one per channel, into
+	// estimates[0 .. num_channels-1].  Returns false if there are none.
+	bool poll(snr_estimate_t *estimates);
+	size_t pending() const { return (out.size() - out_rd) / num_channels; }
+
+	unsigned int channels() const { return num_channels; }
+
+private:
+	void push_step();  // update every channel with this time step's mag[]
+
+	unsigned int num_channels;
+	unsigned int num_lanes;          // num_channels rounded up to a whole SIMD vector
+
+	unsigned long long sample_cnt;
+	unsigned int head;
+	int while_loop_cntr;
+
+	std::vector<unsigned short> delay_line;
+	std::vector<unsigned int> abs_energy_sum;
+	std::vector<unsigned long long> noiseVarSum;
+	std::vector<unsigned int> mag;   // this time step's magnitudes
+
+	std::vector<snr_estimate_t> out;
+	size_t out_rd;
+};
+
+
+template <typename T> void SnrMultiEngine::push(const T *iq, size_t num_samples)
+{
+	for (size_t t = 0; t < num_samples; t++) {
+		const T *step = iq + t*num_channels*2;
+		snr_mag_block(step, step + 1, 2, mag.data(), num_channels);
+		push_step();
+	}
+}
+
+#endif
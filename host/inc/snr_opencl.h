@@ -0,0 +1,92 @@
+/******************************************************************************
+*  @file    snr_opencl.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief OpenCL session for the SNR estimator kernels.
+*
+*  @section DESCRIPTION
+*
+*  OpenClSession owns everything needed to run the kernels: platform,
+*  context, program, one queue per kernel, the kernels and the transfer
+*  buffers.  Its destructor releases them.  Sessions share nothing, so
+*  separate threads can each drive their own session.  A single session
+*  must only be used by one thread at a time.
+*
+*******************************************************************************/
+
+#ifndef SNR_OPENCL_H_
+#define SNR_OPENCL_H_
+
+#include "CL/opencl.h"
+#include "snr_backend.h"
+
+#define SLOT_LEN         4096 // DVB-S2 slot length is 90 symbols
+//#define SLOT_LEN         1100 // DVB-S2 slot length is 90 symbols
+//#define SLOT_LEN         90 // DVB-S2 slot length is 90 symbols
+
+// Long captures are sent to the device in chunks through a ring of buffers
+// so the transfer of one chunk overlaps with processing of the previous one
+#define XFER_NUM_BUFS    2                          // 2 = double buffered
+#define XFER_CHUNK_LEN   (256*SNR_DWELL_LENGTH)     // whole dwells, so sof stays aligned
+
+
+enum KERNELS {
+K_READER,
+K_SNR_EST_LUT_CORRECTION,
+K_WRITER,
+K_READER_BATCH,
+K_WRITER_BATCH,
+K_NUM_KERNELS
+};
+
+
+class OpenClSession {
+public:
+	// device_kernel names the .aocx, emulation selects the emulator platform
+	OpenClSession(const char *device_kernel, bool emulation);
+	~OpenClSession();
+
+	// Find the platform, program the device and make the queues, kernels
+	// and buffers.  Returns false if there is no usable platform.
+	bool init();
+
+	// Each returns the time from the first transfer to the last estimate, in seconds.
+	// run streams through the double buffered transfer ring.
+	double run(const char *dataIn_I, const char *dataIn_Q, int dataInLen, short *snr_est_out);
+	// run_zero_copy uses the arrays in place; they must come from alignedMalloc.
+	double run_zero_copy(char *dataIn_I, char *dataIn_Q, int dataInLen, short *snr_est_out);
+	// run_batch is one launch of data_in_batch/data_out_batch, see SnrBackend::run_batch.
+	double run_batch(const char *dataIn_I, const char *dataIn_Q, const unsigned int *capture_offsets,
+		unsigned int num_captures, short *snr_est_out);
+
+private:
+	OpenClSession(const OpenClSession &);
+	OpenClSession &operator=(const OpenClSession &);
+
+	void launch_estimator();
+
+	const char *device_kernel;
+	bool emulation;
+	unsigned int slotLen;
+
+	cl_platform_id platform;
+	unsigned num_devices;
+	cl_device_id device;
+	cl_context context;
+	cl_command_queue queue[K_NUM_KERNELS];
+	cl_command_queue xfer_queue;  // host to device writes, so they overlap with data_in
+	cl_program program;
+	cl_kernel kernel[K_NUM_KERNELS];
+	cl_mem input_noisy_message_I_buf[XFER_NUM_BUFS];
+	cl_mem input_noisy_message_Q_buf[XFER_NUM_BUFS];
+	cl_mem output_buf[XFER_NUM_BUFS];
+	bool estimator_launched;
+};
+
+
+// Backend on its own OpenClSession.  With zero_copy, run() uses
+// run_zero_copy and the caller's arrays must come from alignedMalloc.
+SnrBackend *create_opencl_backend(const char *device_kernel, bool emulation, bool zero_copy);
+
+#endif
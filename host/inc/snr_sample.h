@@ -0,0 +1,104 @@
+/******************************************************************************
+*  @file    snr_sample.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Sample formats the native estimators take: int8, sc16 and fc32.
+*
+*  @section DESCRIPTION
+*
+*  The kernel reads int8 I/Q and scales it by 256 (x<<8) before mag_cordic,
+*  so everything downstream of the CORDIC already works on 16 bit inputs.
+*  snr_sample<T> maps each format onto that range at compile time:
+*
+*      char    x<<8                 the kernel path, through the polar LUT
+*      short   x                    sc16 (USRP) at native width
+*      float   round(x*32768)       fc32 with full scale +/-1.0, saturated
+*
+*  An sc16 capture that is an int8 capture times 256, or an fc32 capture
+*  that is the int8 capture divided by 128, gives bit for bit the same
+*  estimates.  Wider samples keep their extra resolution in the magnitude
+*  instead of being requantized to 8 bits first.
+*
+*  snr_mag_block reads a block of samples at their own width, either from
+*  planes (stride 1) or interleaved (stride 2), and computes the magnitudes
+*  with mag_cordic_batch.  Int8 uses the polar LUT instead.
+*
+*******************************************************************************/
+
+#ifndef SNR_SAMPLE_H_
+#define SNR_SAMPLE_H_
+
+#include <stddef.h>
+#include "cordic_batch.h"
+#include "polar_lut_host.h"
+
+#define SNR_SAMPLE_BLOCK  256  // magnitudes computed per mag_cordic_batch call
+
+// device/cordic.h, compiled in cordic.cpp
+unsigned int mag_cordic(int x, int y);
+
+
+template <typename T> struct snr_sample;
+
+template <> struct snr_sample<char> {
+	static const char *name() { return "int8"; }
+	static int cordic_in(char x) { return (int)x << 8; }
+};
+
+template <> struct snr_sample<short> {
+	static const char *name() { return "sc16"; }
+	static int cordic_in(short x) { return x; }
+};
+
+template <> struct snr_sample<float> {
+	static const char *name() { return "fc32"; }
+	static int cordic_in(float x)
+	{
+		float v = x * 32768.0f;
+		if (!(v == v))
+			return 0;  // NaN
+		if (v >= 32767.0f)
+			return 32767;
+		if (v <= -32768.0f)
+			return -32768;
+		return (int)(v < 0 ? v - 0.5f : v + 0.5f);
+	}
+};
+
+
+// Magnitude of one sample, as mag_cordic sees it
+template <typename T> static inline unsigned int snr_sample_mag(T x, T y)
+{
+	return mag_cordic(snr_sample<T>::cordic_in(x), snr_sample<T>::cordic_in(y));
+}
+
+static inline unsigned int snr_sample_mag(char x, char y)
+{
+	return mag_lut_int8(x, y);  // == mag_cordic((int)x<<8, (int)y<<8)
+}
+
+
+// mag[i] = snr_sample_mag(I[i*stride], Q[i*stride]) for i < n
+template <typename T> static inline void snr_mag_block(const T *I, const T *Q, size_t stride,
+	unsigned int *mag, size_t n)
+{
+	int x[SNR_SAMPLE_BLOCK], y[SNR_SAMPLE_BLOCK];
+	for (size_t i = 0; i < n; i += SNR_SAMPLE_BLOCK) {
+		size_t m = (n - i < SNR_SAMPLE_BLOCK) ? n - i : SNR_SAMPLE_BLOCK;
+		for (size_t k = 0; k < m; k++) {
+			x[k] = snr_sample<T>::cordic_in(I[(i+k)*stride]);
+			y[k] = snr_sample<T>::cordic_in(Q[(i+k)*stride]);
+		}
+		mag_cordic_batch(x, y, mag + i, m);
+	}
+}
+
+static inline void snr_mag_block(const char *I, const char *Q, size_t stride,
+	unsigned int *mag, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		mag[i] = mag_lut_int8(I[i*stride], Q[i*stride]);
+}
+
+#endif
@@ -0,0 +1,89 @@
+/******************************************************************************
+*  @file    snr_window_engine.h
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Native C++ model of the fused multi window estimator.
+*
+*  @section DESCRIPTION
+*
+*  SnrWindowEngine reproduces the -DSNR_MULTI_WINDOW build of
+*  device/SNR_estimator_LUT_correction_top.cl (snr_est_multi_window) bit for
+*  bit: each sample's magnitude is computed once and feeds the accumulators
+*  of every window, which estimate 90, 512, 1024 and 4096 sample dwells side
+*  by side, each through its own LUT.  The 1024 sample window gives the same
+*  estimates as SnrEngine.
+*
+*  Each window has its own queue of estimates, polled by window index.
+*
+*******************************************************************************/
+
+#ifndef SNR_WINDOW_ENGINE_H_
+#define SNR_WINDOW_ENGINE_H_
+
+#include <stddef.h>
+#include <vector>
+#include "snr_engine.h"
+
+// These mirror the constants in the device code and must be kept in sync
+#define SNR_NUM_WINDOWS   4
+#define SNR_WINDOW_0_AVG  45    // 90 symbol PLHEADER
+#define SNR_WINDOW_1_AVG  256   // 512 sample dwell
+#define SNR_WINDOW_2_AVG  512   // 1024, same as SnrEngine
+#define SNR_WINDOW_3_AVG  2048  // 4096
+
+
+class SnrWindowEngine {
+public:
+	SnrWindowEngine();
+
+	// Drop all state, as if the kernels had just been launched
+	void reset();
+
+	// Feed n samples.  I and Q are separate planes of char, short or float
+	// samples, see snr_sample.h.
+	template <typename T> void push(const T *I, const T *Q, size_t n);
+
+	// Move up to max_estimates pending estimates of window into estimates,
+	// oldest first.  Returns the number written.
+	size_t poll(int window, snr_estimate_t *estimates, size_t max_estimates);
+	size_t pending(int window) const { return win[window].out.size() - win[window].out_rd; }
+
+	// 2*num_samp_to_average of window
+	static unsigned int dwell_length(int window);
+
+	unsigned long long samples_pushed() const { return sample_cnt; }
+
+private:
+	void push_mags(const unsigned int *mag, size_t n);
+
+	// One window of snr_est_multi_window.  The delay line holds
+	// num_samp_to_average+1 magnitudes, delay_line[head] the oldest.
+	struct Window {
+		int num_samp_to_average;
+		const short *lut;
+		std::vector<unsigned short> delay_line;
+		unsigned int head;
+		int while_loop_cntr;
+		unsigned long abs_energy_sum;
+		unsigned long noiseVarSum;
+		std::vector<snr_estimate_t> out;
+		size_t out_rd;
+	};
+
+	unsigned long long sample_cnt;
+	Window win[SNR_NUM_WINDOWS];
+};
+
+
+template <typename T> void SnrWindowEngine::push(const T *I, const T *Q, size_t n)
+{
+	unsigned int mag[SNR_SAMPLE_BLOCK];
+	for (size_t i = 0; i < n; i += SNR_SAMPLE_BLOCK) {
+		size_t m = (n - i < SNR_SAMPLE_BLOCK) ? n - i : SNR_SAMPLE_BLOCK;
+		snr_mag_block(I + i, Q + i, 1, mag, m);
+		push_mags(mag, m);
+	}
+}
+
+#endif
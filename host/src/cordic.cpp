@@ -0,0 +1,30 @@
+/******************************************************************************
+*  @file    cordic.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Host build of the device CORDIC.
+*
+*  @section DESCRIPTION
+*
+*  Compiles device/cordic.h once for the host so the native engine calls the
+*  very same CORDIC code the kernel does.  The prototypes used by the host
+*  are in cordic_host.h.  This must stay the only host file that includes
+*  device/cordic.h, since the functions in it are not inline.
+*
+*******************************************************************************/
+
+#include "cl_compat.h"
+
+// Gives atanTable external linkage so the batch CORDIC can share it
+extern const int atanTable[];
+
+// The device code is compiled as is.  __attribute__((register)) is an Intel
+// FPGA compiler hint.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wparentheses"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include "../../device/cordic.h"
+#pragma GCC diagnostic pop
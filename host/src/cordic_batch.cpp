@@ -0,0 +1,351 @@
+/******************************************************************************
+*  @file    cordic_batch.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief AVX2/AVX-512 batch CORDIC with a scalar fallback.
+*
+*  @section DESCRIPTION
+*
+*  The scalar cordic() carries its x/y/z stages in 64 bit longs, but for the
+*  input ranges used here every stage fits in 32 bits:
+*
+*    mag_cordic          |x|,|y| <= 2^15, so |x_vec|,|y_vec| <= 1.647*2^15.5
+*                        and the x*CORDIC_GAIN product stays below 2^32
+*    arctan_cordic       same bound on x/y, and z stays within +/-2^23
+*    sin_cos_cordic_24b  x_vec/y_vec <= 1.647*0x9B6F23 ~= 2^24
+*
+*  and an arithmetic shift of a 32 bit lane equals the same shift of the
+*  64 bit value.  So running each stage in 32 bit lanes is bit exact.  The
+*  rotation decision turns into a conditional negate, (v ^ m) - m, with m
+*  all ones where the scalar code takes its "else" branch.
+*
+*  The vector code is written once with GCC vector extensions and forced
+*  inline into one wrapper per instruction set, which is compiled for that
+*  target with __attribute__((target)).  No special compiler flags needed.
+*  Off x86 only the scalar fallback is built.
+*
+*******************************************************************************/
+
+#include <string.h>
+#include <atomic>
+#include "cordic_host.h"
+#include "cordic_batch.h"
+
+#define CORDIC_GAIN (0x9b75)  // as in device/cordic.h
+
+// The vector types are only used inside always_inline code compiled for AVX
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+typedef int   v8si  __attribute__((vector_size(32)));
+typedef short v8hi  __attribute__((vector_size(16)));
+typedef int   v16si __attribute__((vector_size(64)));
+typedef short v16hi __attribute__((vector_size(32)));
+
+#define BATCH_INLINE static inline __attribute__((always_inline))
+
+
+//**********************************************
+// Lane-width independent CORDIC stages
+//**********************************************
+
+// v where m is 0, -v where m is all ones
+template<typename V> BATCH_INLINE V cond_neg(V v, V m)
+{
+	return (v ^ m) - m;
+}
+
+// Vector mode: rotate towards y=0.  The scalar code adds when y >= 0.
+template<typename V> BATCH_INLINE void cordic_vector(V &x, V &y, V &z)
+{
+	for (int i = 0; i < ATANTABLESZ; i++) {
+		V m = y >> 31;
+		V xs = x >> i;
+		V ys = y >> i;
+		x = x + cond_neg(ys, m);
+		y = y - cond_neg(xs, m);
+		z = z + cond_neg(V{} + atanTable[i], m);
+	}
+}
+
+// Rotation mode: drive z to 0.  The scalar code adds when z < 0.
+template<typename V> BATCH_INLINE void cordic_rotation(V &x, V &y, V &z)
+{
+	for (int i = 0; i < ATANTABLESZ; i++) {
+		V m = ~(z >> 31);
+		V xs = x >> i;
+		V ys = y >> i;
+		x = x + cond_neg(ys, m);
+		y = y - cond_neg(xs, m);
+		z = z + cond_neg(V{} + atanTable[i], m);
+	}
+}
+
+template<typename V> BATCH_INLINE V vabs(V v)
+{
+	return cond_neg(v, v >> 31);
+}
+
+template<typename V> BATCH_INLINE V vload(const int *p)
+{
+	V v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+template<typename V, typename VH> BATCH_INLINE V vload(const short *p)
+{
+	VH v;
+	memcpy(&v, p, sizeof(v));
+	return __builtin_convertvector(v, V);
+}
+
+// mag_cordic: first quadrant, vector mode, then round(x*CORDIC_GAIN / 2^16)
+template<typename V> BATCH_INLINE void mag_block(const int *px, const int *py, unsigned int *pmag)
+{
+	typedef unsigned int VU __attribute__((vector_size(sizeof(V))));
+	V x = vabs(vload<V>(px));
+	V y = vabs(vload<V>(py));
+	V z = V{};
+	cordic_vector(x, y, z);
+	VU mag = (VU)x * (unsigned int)CORDIC_GAIN;
+	mag = (mag >> 16) + ((mag >> 15) & 1);
+	memcpy(pmag, &mag, sizeof(mag));
+}
+
+// arctan_cordic: axis special cases, checkQuadrant, vector mode, round_i(z, 9)
+template<typename V, typename VH> BATCH_INLINE void arctan_block(const short *px, const short *py, unsigned short *patan)
+{
+	V x = vload<V, VH>(px);
+	V y = vload<V, VH>(py);
+	V xneg = x >> 31;
+	V yneg = y >> 31;
+
+	// Quadrant 1 and 3 swap x and y, then 2 and 3 negate the new x and 1 and 2
+	// the new y.  checkQuadrant keeps the results in shorts, hence the wrap.
+	V swap = xneg ^ yneg;
+	V quadrant = (yneg & 2) | (swap & 1);
+	V xf = cond_neg((x & ~swap) | (y & swap), yneg);
+	V yf = cond_neg((y & ~swap) | (x & swap), xneg);
+	xf = (xf << 16) >> 16;
+	yf = (yf << 16) >> 16;
+
+	V z = V{};
+	cordic_vector(xf, yf, z);
+	V atan_1q = (z >> 9) + ((z >> 8) & 1);
+	V atan = (quadrant << 14) | (atan_1q & 0x3fff);
+
+	// on an axis
+	V xzero = (x == 0);
+	V yzero = (y == 0);
+	V on_x = (xneg & 32768);
+	V on_y = (yneg & (49152 ^ 16384)) ^ 16384;
+	atan = (atan & ~yzero) | (on_x & yzero);
+	atan = (atan & ~xzero) | (on_y & xzero);
+
+	VH out = __builtin_convertvector(atan, VH);
+	memcpy(patan, &out, sizeof(out));
+}
+
+// sin_cos_cordic_24b: fold theta into the first quadrant, rotate, unfold
+template<typename V> BATCH_INLINE void sin_cos_block(const int *ptheta, int *pcos, int *psin)
+{
+	const int cordic_gain_inv_24b = 0x9B6F23;
+	V theta = vload<V>(ptheta);
+	V bit22 = -((theta >> 22) & 1);
+	V bit23 = -((theta >> 23) & 1);
+	V theta_22b = theta & 0x003fffff;
+	V theta_corrected = (theta_22b & ~bit22) | ((0x003fffff - theta_22b) & bit22);
+
+	V x = V{} + cordic_gain_inv_24b;
+	V y = V{};
+	V z = theta_corrected << 1;
+	cordic_rotation(x, y, z);
+
+	V c = cond_neg(x, bit22 ^ bit23);
+	V s = cond_neg(y, bit23);
+	memcpy(pcos, &c, sizeof(c));
+	memcpy(psin, &s, sizeof(s));
+}
+
+
+//**********************************************
+// Scalar fallback
+//**********************************************
+static void mag_cordic_batch_scalar(const int *x, const int *y, unsigned int *mag, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		mag[i] = mag_cordic(x[i], y[i]);
+}
+
+static void arctan_cordic_batch_scalar(const short *x, const short *y, unsigned short *atan, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		atan[i] = arctan_cordic(x[i], y[i]);
+}
+
+static void sin_cos_cordic_24b_batch_scalar(const int *theta, int *cos, int *sin, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		struct cos_sin cs = sin_cos_cordic_24b(theta[i]);
+		cos[i] = cs.cos;
+		sin[i] = cs.sin;
+	}
+}
+
+
+#ifdef CORDIC_BATCH_X86
+//**********************************************
+// AVX2, 8 lanes
+//**********************************************
+__attribute__((target("avx2")))
+static void mag_cordic_batch_avx2(const int *x, const int *y, unsigned int *mag, size_t n)
+{
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8)
+		mag_block<v8si>(x+i, y+i, mag+i);
+	mag_cordic_batch_scalar(x+i, y+i, mag+i, n-i);
+}
+
+__attribute__((target("avx2")))
+static void arctan_cordic_batch_avx2(const short *x, const short *y, unsigned short *atan, size_t n)
+{
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8)
+		arctan_block<v8si, v8hi>(x+i, y+i, atan+i);
+	arctan_cordic_batch_scalar(x+i, y+i, atan+i, n-i);
+}
+
+__attribute__((target("avx2")))
+static void sin_cos_cordic_24b_batch_avx2(const int *theta, int *cos, int *sin, size_t n)
+{
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8)
+		sin_cos_block<v8si>(theta+i, cos+i, sin+i);
+	sin_cos_cordic_24b_batch_scalar(theta+i, cos+i, sin+i, n-i);
+}
+
+
+//**********************************************
+// AVX-512, 16 lanes
+//**********************************************
+__attribute__((target("avx512f,avx512bw")))
+static void mag_cordic_batch_avx512(const int *x, const int *y, unsigned int *mag, size_t n)
+{
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16)
+		mag_block<v16si>(x+i, y+i, mag+i);
+	mag_cordic_batch_avx2(x+i, y+i, mag+i, n-i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void arctan_cordic_batch_avx512(const short *x, const short *y, unsigned short *atan, size_t n)
+{
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16)
+		arctan_block<v16si, v16hi>(x+i, y+i, atan+i);
+	arctan_cordic_batch_avx2(x+i, y+i, atan+i, n-i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void sin_cos_cordic_24b_batch_avx512(const int *theta, int *cos, int *sin, size_t n)
+{
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16)
+		sin_cos_block<v16si>(theta+i, cos+i, sin+i);
+	sin_cos_cordic_24b_batch_avx2(theta+i, cos+i, sin+i, n-i);
+}
+#endif
+
+
+//**********************************************
+// Runtime dispatch
+//**********************************************
+// Atomic since any thread may be the first to dispatch, or may call
+// cordic_batch_force_isa, while others are dispatching
+static std::atomic<int> batch_isa(-1);
+
+static bool cpu_supports(cordic_isa_t isa)
+{
+#ifdef CORDIC_BATCH_X86
+	__builtin_cpu_init();
+	switch (isa) {
+	case CORDIC_ISA_AVX512:
+		return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+	case CORDIC_ISA_AVX2:
+		return __builtin_cpu_supports("avx2");
+	default:
+		return true;
+	}
+#else
+	return isa == CORDIC_ISA_SCALAR;
+#endif
+}
+
+cordic_isa_t cordic_batch_isa()
+{
+	int isa = batch_isa.load(std::memory_order_relaxed);
+	if (isa < 0) {
+		if (cpu_supports(CORDIC_ISA_AVX512))
+			isa = CORDIC_ISA_AVX512;
+		else if (cpu_supports(CORDIC_ISA_AVX2))
+			isa = CORDIC_ISA_AVX2;
+		else
+			isa = CORDIC_ISA_SCALAR;
+		// Keep a force_isa that got in first
+		int unset = -1;
+		if (!batch_isa.compare_exchange_strong(unset, isa, std::memory_order_relaxed))
+			isa = unset;
+	}
+	return (cordic_isa_t)isa;
+}
+
+const char *cordic_batch_isa_name(cordic_isa_t isa)
+{
+	switch (isa) {
+	case CORDIC_ISA_AVX512: return "avx512";
+	case CORDIC_ISA_AVX2:   return "avx2";
+	default:                return "scalar";
+	}
+}
+
+bool cordic_batch_force_isa(cordic_isa_t isa)
+{
+	if (!cpu_supports(isa))
+		return false;
+	batch_isa.store(isa, std::memory_order_relaxed);
+	return true;
+}
+
+void mag_cordic_batch(const int *x, const int *y, unsigned int *mag, size_t n)
+{
+	switch (cordic_batch_isa()) {
+#ifdef CORDIC_BATCH_X86
+	case CORDIC_ISA_AVX512: mag_cordic_batch_avx512(x, y, mag, n); break;
+	case CORDIC_ISA_AVX2:   mag_cordic_batch_avx2(x, y, mag, n); break;
+#endif
+	default:                mag_cordic_batch_scalar(x, y, mag, n); break;
+	}
+}
+
+void arctan_cordic_batch(const short *x, const short *y, unsigned short *atan, size_t n)
+{
+	switch (cordic_batch_isa()) {
+#ifdef CORDIC_BATCH_X86
+	case CORDIC_ISA_AVX512: arctan_cordic_batch_avx512(x, y, atan, n); break;
+	case CORDIC_ISA_AVX2:   arctan_cordic_batch_avx2(x, y, atan, n); break;
+#endif
+	default:                arctan_cordic_batch_scalar(x, y, atan, n); break;
+	}
+}
+
+void sin_cos_cordic_24b_batch(const int *theta, int *cos, int *sin, size_t n)
+{
+	switch (cordic_batch_isa()) {
+#ifdef CORDIC_BATCH_X86
+	case CORDIC_ISA_AVX512: sin_cos_cordic_24b_batch_avx512(theta, cos, sin, n); break;
+	case CORDIC_ISA_AVX2:   sin_cos_cordic_24b_batch_avx2(theta, cos, sin, n); break;
+#endif
+	default:                sin_cos_cordic_24b_batch_scalar(theta, cos, sin, n); break;
+	}
+}
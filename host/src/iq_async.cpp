@@ -0,0 +1,409 @@
+/******************************************************************************
+*  @file    iq_async.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Reads binary I/Q captures ahead of the estimator with io_uring.
+*
+*  @section DESCRIPTION
+*
+*  The ring is driven with the raw system calls, so there is no liburing
+*  dependency.  Each read's user_data is its slot and plane, 2*slot+plane.
+*  A short read (rare for regular files) is completed with pread.
+*
+*******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include "iq_async.h"
+
+#if defined(__linux__) && defined(__NR_io_uring_setup) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define IQ_HAVE_URING
+#endif
+#endif
+
+#define IQ_ASYNC_ALIGNMENT  4096
+
+
+static bool pread_all(int fd, char *buf, size_t len, off_t offset)
+{
+	while (len > 0) {
+		ssize_t n = pread(fd, buf, len, offset);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		buf += n;
+		len -= n;
+		offset += n;
+	}
+	return true;
+}
+
+
+IqAsyncReader::IqAsyncReader(size_t chunk_samples, unsigned int depth)
+	: chunk_samples(chunk_samples), depth(depth ? depth : 1), total(0), num_chunks(0),
+	next_chunk(0), queued(0), is_interleaved(false), held(false),
+	ring_fd(-1), fixed_buffers(false), sq_ring(NULL), cq_ring(NULL), sqes(NULL),
+	sq_ring_len(0), cq_ring_len(0), sqes_len(0), cqes(NULL), to_submit(0)
+{
+	fd[0] = fd[1] = -1;
+	data_offset[0] = data_offset[1] = 0;
+	slots.resize(this->depth);
+	for (unsigned int s = 0; s < this->depth; s++) {
+		slots[s].buf = NULL;
+		if (posix_memalign((void **)&slots[s].buf, IQ_ASYNC_ALIGNMENT, 2 * chunk_samples) != 0)
+			slots[s].buf = NULL;
+		slots[s].chunk = 0;
+		slots[s].pending = 0;
+		slots[s].failed = false;
+	}
+	setup_ring();
+}
+
+IqAsyncReader::~IqAsyncReader()
+{
+	close();
+	teardown_ring();
+	for (unsigned int s = 0; s < depth; s++)
+		free(slots[s].buf);
+}
+
+
+//**********************************************
+// Ring setup
+//**********************************************
+bool IqAsyncReader::setup_ring()
+{
+#ifdef IQ_HAVE_URING
+	for (unsigned int s = 0; s < depth; s++)
+		if (slots[s].buf == NULL)
+			return false;
+
+	struct io_uring_params p;
+	memset(&p, 0, sizeof(p));
+	int rfd = syscall(__NR_io_uring_setup, 2 * depth, &p);
+	if (rfd < 0)
+		return false;
+
+	sq_ring_len = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	cq_ring_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	bool single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+	if (single_mmap)
+		sq_ring_len = cq_ring_len = (sq_ring_len > cq_ring_len) ? sq_ring_len : cq_ring_len;
+	sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+
+	sq_ring = mmap(NULL, sq_ring_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, rfd, IORING_OFF_SQ_RING);
+	if (sq_ring == MAP_FAILED) {
+		sq_ring = NULL;
+		::close(rfd);
+		return false;
+	}
+	if (single_mmap) {
+		cq_ring = sq_ring;
+	} else {
+		cq_ring = mmap(NULL, cq_ring_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, rfd, IORING_OFF_CQ_RING);
+		if (cq_ring == MAP_FAILED)
+			cq_ring = NULL;
+	}
+	sqes = mmap(NULL, sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, rfd, IORING_OFF_SQES);
+	if (sqes == MAP_FAILED)
+		sqes = NULL;
+	ring_fd = rfd;
+	if (cq_ring == NULL || sqes == NULL) {
+		teardown_ring();
+		return false;
+	}
+
+	char *sq = (char *)sq_ring;
+	char *cq = (char *)cq_ring;
+	sq_head = (unsigned int *)(sq + p.sq_off.head);
+	sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+	sq_mask = (unsigned int *)(sq + p.sq_off.ring_mask);
+	sq_array = (unsigned int *)(sq + p.sq_off.array);
+	cq_head = (unsigned int *)(cq + p.cq_off.head);
+	cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+	cq_mask = (unsigned int *)(cq + p.cq_off.ring_mask);
+	cqes = cq + p.cq_off.cqes;
+
+	// Registering pins the buffers.  Over RLIMIT_MEMLOCK it fails and the
+	// reads go through plain IORING_OP_READ instead.
+	std::vector<struct iovec> iov(depth);
+	for (unsigned int s = 0; s < depth; s++) {
+		iov[s].iov_base = slots[s].buf;
+		iov[s].iov_len = 2 * chunk_samples;
+	}
+	fixed_buffers = syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_BUFFERS, iov.data(), depth) == 0;
+	return true;
+#else
+	return false;
+#endif
+}
+
+void IqAsyncReader::teardown_ring()
+{
+	if (sqes)
+		munmap(sqes, sqes_len);
+	if (cq_ring && cq_ring != sq_ring)
+		munmap(cq_ring, cq_ring_len);
+	if (sq_ring)
+		munmap(sq_ring, sq_ring_len);
+	if (ring_fd >= 0)
+		::close(ring_fd);  // also unregisters the buffers
+	sqes = cq_ring = sq_ring = NULL;
+	ring_fd = -1;
+	fixed_buffers = false;
+}
+
+
+//**********************************************
+// Files
+//**********************************************
+bool IqAsyncReader::open_file(int i, const char *filename, unsigned long long *num_bytes)
+{
+	fd[i] = ::open(filename, O_RDONLY);
+	struct stat st;
+	if (fd[i] < 0 || fstat(fd[i], &st) < 0) {
+		printf("File %s could not be opened\n", filename);
+		return false;
+	}
+	// .iq8 files are read past their header, anything else is raw int8
+	data_offset[i] = 0;
+	unsigned int header[4];
+	if (st.st_size >= IQ8_HEADER_LEN && pread_all(fd[i], (char *)header, sizeof(header), 0)) {
+		unsigned long long n;
+		memcpy(&n, &header[2], sizeof(n));
+		if (header[0] == IQ8_MAGIC && header[1] == IQ8_VERSION && n == (unsigned long long)st.st_size - IQ8_HEADER_LEN)
+			data_offset[i] = IQ8_HEADER_LEN;
+	}
+	*num_bytes = st.st_size - data_offset[i];
+	posix_fadvise(fd[i], 0, 0, POSIX_FADV_SEQUENTIAL);
+	return true;
+}
+
+bool IqAsyncReader::open(const char *file_I, const char *file_Q)
+{
+	close();
+	is_interleaved = false;
+	unsigned long long len_I, len_Q;
+	if (!open_file(0, file_I, &len_I) || !open_file(1, file_Q, &len_Q)) {
+		close();
+		return false;
+	}
+	if (len_I != len_Q) {
+		printf("%s and %s differ in length\n", file_I, file_Q);
+		close();
+		return false;
+	}
+	total = len_I;
+	num_chunks = (total + chunk_samples - 1) / chunk_samples;
+	for (unsigned int s = 0; s < depth && queued < num_chunks; s++)
+		queue_chunk(s, queued++);
+	submit();
+	return true;
+}
+
+bool IqAsyncReader::open(const char *file_iq)
+{
+	close();
+	is_interleaved = true;
+	unsigned long long len;
+	if (!open_file(0, file_iq, &len)) {
+		close();
+		return false;
+	}
+	total = len / 2;
+	num_chunks = (total + chunk_samples - 1) / chunk_samples;
+	planes.resize(2 * chunk_samples);
+	for (unsigned int s = 0; s < depth && queued < num_chunks; s++)
+		queue_chunk(s, queued++);
+	submit();
+	return true;
+}
+
+void IqAsyncReader::close()
+{
+	// Reads still in flight write into the buffers, so let them land first
+	for (unsigned int s = 0; s < depth; s++) {
+		if (ring_fd >= 0)
+			wait_slot(s);
+		slots[s].pending = 0;
+	}
+	for (int i = 0; i < 2; i++) {
+		if (fd[i] >= 0)
+			::close(fd[i]);
+		fd[i] = -1;
+	}
+	total = num_chunks = next_chunk = queued = 0;
+	held = false;
+}
+
+
+//**********************************************
+// Reads
+//**********************************************
+size_t IqAsyncReader::chunk_len(unsigned long long chunk) const
+{
+	unsigned long long first = chunk * chunk_samples;
+	return (total - first < chunk_samples) ? (size_t)(total - first) : chunk_samples;
+}
+
+void IqAsyncReader::queue_chunk(unsigned int s, unsigned long long chunk)
+{
+	Slot &slot = slots[s];
+	slot.chunk = chunk;
+	slot.failed = (slot.buf == NULL);
+	slot.pending = is_interleaved ? 1 : 2;
+	if (ring_fd < 0 || slot.failed)
+		return;  // pread in wait_slot
+
+#ifdef IQ_HAVE_URING
+	size_t len = chunk_len(chunk);
+	for (int plane = 0; plane < slot.pending; plane++) {
+		unsigned int tail = *sq_tail;
+		unsigned int index = tail & *sq_mask;
+		struct io_uring_sqe *sqe = (struct io_uring_sqe *)sqes + index;
+		memset(sqe, 0, sizeof(*sqe));
+		sqe->opcode = fixed_buffers ? IORING_OP_READ_FIXED : IORING_OP_READ;
+		sqe->fd = fd[plane];
+		if (is_interleaved) {
+			sqe->off = data_offset[0] + chunk * chunk_samples * 2;
+			sqe->addr = (unsigned long long)(uintptr_t)slot.buf;
+			sqe->len = 2 * len;
+		} else {
+			sqe->off = data_offset[plane] + chunk * chunk_samples;
+			sqe->addr = (unsigned long long)(uintptr_t)(slot.buf + plane * chunk_samples);
+			sqe->len = len;
+		}
+		sqe->buf_index = s;
+		sqe->user_data = 2 * s + plane;
+		sq_array[index] = index;
+		__atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+		to_submit++;
+	}
+#endif
+}
+
+void IqAsyncReader::submit()
+{
+#ifdef IQ_HAVE_URING
+	while (to_submit > 0) {
+		int n = syscall(__NR_io_uring_enter, ring_fd, to_submit, 0, 0, NULL, 0);
+		if (n < 0 && (errno == EINTR || errno == EAGAIN || errno == EBUSY))
+			continue;
+		if (n <= 0) {
+			perror("io_uring_enter");
+			for (unsigned int s = 0; s < depth; s++)
+				if (slots[s].pending > 0)
+					slots[s].failed = true;
+			return;
+		}
+		to_submit -= n;
+	}
+#endif
+}
+
+// Count one read of slot s done.  done is the read's result; a short read is completed with pread.
+bool IqAsyncReader::finish_read(unsigned int s, int plane, long done)
+{
+	Slot &slot = slots[s];
+	size_t len = chunk_len(slot.chunk) * (is_interleaved ? 2 : 1);
+	char *buf = slot.buf + (is_interleaved ? 0 : plane * chunk_samples);
+	off_t offset = data_offset[plane] + slot.chunk * chunk_samples * (is_interleaved ? 2 : 1);
+	if (done < 0 || (size_t)done > len ||
+		!pread_all(fd[plane], buf + done, len - done, offset + done))
+		slot.failed = true;
+	slot.pending--;
+	return !slot.failed;
+}
+
+bool IqAsyncReader::wait_slot(unsigned int s)
+{
+	Slot &slot = slots[s];
+	if (slot.failed) {
+		slot.pending = 0;
+		return false;
+	}
+	if (ring_fd < 0) {
+		for (int plane = 0, planes_left = slot.pending; plane < planes_left; plane++)
+			finish_read(s, plane, 0);
+		return !slot.failed;
+	}
+
+#ifdef IQ_HAVE_URING
+	while (slot.pending > 0) {
+		unsigned int head = *cq_head;
+		if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+			int n = syscall(__NR_io_uring_enter, ring_fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+			if (n < 0 && errno != EINTR) {
+				perror("io_uring_enter");
+				slot.failed = true;
+				return false;
+			}
+			continue;
+		}
+		struct io_uring_cqe *cqe = (struct io_uring_cqe *)cqes + (head & *cq_mask);
+		unsigned int done_slot = cqe->user_data / 2;
+		int plane = cqe->user_data % 2;
+		finish_read(done_slot, plane, cqe->res);
+		__atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+	}
+#endif
+	return !slot.failed;
+}
+
+bool IqAsyncReader::next(iq_view_t *view)
+{
+	// The chunk handed out last time is done with, so its buffer takes the next read
+	if (held) {
+		unsigned int s = (next_chunk - 1) % depth;
+		if (queued < num_chunks) {
+			queue_chunk(s, queued++);
+			submit();
+		}
+		held = false;
+	}
+	if (next_chunk >= num_chunks)
+		return false;
+
+	unsigned int s = next_chunk % depth;
+	if (!wait_slot(s)) {
+		printf("ERROR: Read of chunk %llu failed\n", next_chunk);
+		return false;
+	}
+
+	Slot &slot = slots[s];
+	size_t n = chunk_len(next_chunk);
+	view->first_sample = next_chunk * chunk_samples;
+	view->num_samples = n;
+	if (is_interleaved) {
+		const char *iq = slot.buf;
+		char *I = planes.data();
+		char *Q = planes.data() + chunk_samples;
+		for (size_t k = 0; k < n; k++) {
+			I[k] = iq[2*k];
+			Q[k] = iq[2*k + 1];
+		}
+		view->iq = iq;
+		view->I = I;
+		view->Q = Q;
+	} else {
+		view->iq = NULL;
+		view->I = slot.buf;
+		view->Q = slot.buf + chunk_samples;
+	}
+	next_chunk++;
+	held = true;
+	return true;
+}
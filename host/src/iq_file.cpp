@@ -0,0 +1,307 @@
+/******************************************************************************
+*  @file    iq_file.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Loads I or Q test vectors, caching the parsed samples in a binary
+*  .iq8 sidecar next to the text file, and streams binary I/Q captures.
+*
+*  @section DESCRIPTION
+*
+*  The text file is memory-mapped and cut into one chunk per thread, each
+*  chunk starting just after a newline, so every line is parsed by exactly
+*  one thread.  The chunks are joined in order afterwards.  Each line is
+*  parsed with std::from_chars, which neither allocates nor looks at the
+*  locale the way strtol does.
+*
+*******************************************************************************/
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <charconv>
+#include <string>
+#include <thread>
+#include "iq_file.h"
+
+#define PARSE_MIN_CHUNK  (1 << 20)  // bytes of text per thread worth starting a thread for
+
+
+typedef struct iq8_header_t {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t num_samples;
+	uint64_t source_size;
+	int64_t source_mtime_ns;
+	char pad[IQ8_HEADER_LEN - 32];
+} iq8_header_t;
+
+
+bool MappedFile::open(const char *filename)
+{
+	close();
+	int fd = ::open(filename, O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	if (fstat(fd, &st) < 0 || st.st_size == 0) {
+		::close(fd);
+		return false;
+	}
+	void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (p == MAP_FAILED)
+		return false;
+	base = p;
+	len = st.st_size;
+	return true;
+}
+
+void MappedFile::advise(size_t offset, size_t length, int advice)
+{
+	size_t page = sysconf(_SC_PAGESIZE);
+	size_t first = (offset + page - 1) / page * page;
+	size_t last = (offset + length) / page * page;
+	if (offset + length >= len)
+		last = len;
+	if (base && first < last)
+		madvise((char *)base + first, last - first, advice);
+}
+
+void MappedFile::close()
+{
+	if (base)
+		munmap(base, len);
+	base = NULL;
+	len = 0;
+}
+
+
+// One sample per line, as strtol(line) truncated to char
+static void parse_lines(const char *p, const char *end, std::vector<char> &samples)
+{
+	while (p < end) {
+		const char *eol = (const char *)memchr(p, '\n', end - p);
+		if (eol == NULL)
+			eol = end;
+		while (p < eol && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\v' || *p == '\f'))
+			p++;
+		if (p + 1 < eol && *p == '+' && p[1] >= '0' && p[1] <= '9')
+			p++;
+		int r = 0;
+		std::from_chars(p, eol, r);
+		samples.push_back((char)r);
+		p = eol + 1;
+	}
+}
+
+static const char *next_line(const char *p, const char *begin, const char *end)
+{
+	// p is already a line start if it is the start of the file or follows a newline
+	if (p == begin || p[-1] == '\n')
+		return p;
+	const char *eol = (const char *)memchr(p, '\n', end - p);
+	return eol ? eol + 1 : end;
+}
+
+int parse_text_vector(const char *filename, std::vector<char> &samples)
+{
+	samples.clear();
+	struct stat st;
+	if (stat(filename, &st) < 0) {
+		printf("File %s could not be opened\n", filename);
+		return -1;
+	}
+	if (st.st_size == 0)
+		return 0;
+
+	MappedFile text;
+	if (!text.open(filename)) {
+		printf("File %s could not be opened\n", filename);
+		return -1;
+	}
+	const char *begin = text.data();
+	const char *end = begin + text.size();
+
+	size_t num_threads = std::thread::hardware_concurrency();
+	if (num_threads == 0)
+		num_threads = 1;
+	if (num_threads > text.size() / PARSE_MIN_CHUNK + 1)
+		num_threads = text.size() / PARSE_MIN_CHUNK + 1;
+
+	if (num_threads == 1) {
+		// about 4 characters per line
+		samples.reserve(text.size() / 4);
+		parse_lines(begin, end, samples);
+		return 0;
+	}
+
+	std::vector<std::vector<char> > chunks(num_threads);
+	std::vector<std::thread> workers;
+	for (size_t t = 0; t < num_threads; t++) {
+		const char *first = next_line(begin + text.size() * t / num_threads, begin, end);
+		const char *last = next_line(begin + text.size() * (t+1) / num_threads, begin, end);
+		std::vector<char> *chunk = &chunks[t];
+		workers.push_back(std::thread([=] {
+			chunk->reserve((last - first) / 4);
+			parse_lines(first, last, *chunk);
+		}));
+	}
+	size_t total = 0;
+	for (size_t t = 0; t < num_threads; t++) {
+		workers[t].join();
+		total += chunks[t].size();
+	}
+
+	samples.reserve(total);
+	for (size_t t = 0; t < num_threads; t++)
+		samples.insert(samples.end(), chunks[t].begin(), chunks[t].end());
+	return 0;
+}
+
+
+static int64_t mtime_ns(const struct stat &st)
+{
+	return (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+}
+
+static void write_sidecar(const std::string &path, const struct stat &source, const std::vector<char> &samples)
+{
+	iq8_header_t header;
+	memset(&header, 0, sizeof(header));
+	header.magic = IQ8_MAGIC;
+	header.version = IQ8_VERSION;
+	header.num_samples = samples.size();
+	header.source_size = source.st_size;
+	header.source_mtime_ns = mtime_ns(source);
+
+	// Written under a temporary name and renamed, so a reader never maps half a sidecar
+	std::string tmp = path + ".tmp." + std::to_string(getpid());
+	FILE *file = fopen(tmp.c_str(), "wb");
+	if (file == NULL)
+		return;
+	bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		fwrite(samples.data(), 1, samples.size(), file) == samples.size();
+	ok = (fclose(file) == 0) && ok;
+	if (!ok || rename(tmp.c_str(), path.c_str()) != 0)
+		unlink(tmp.c_str());
+}
+
+int IqVectorFile::load(const char *filename)
+{
+	from_sidecar = false;
+	sidecar.close();
+	parsed.clear();
+
+	struct stat source;
+	if (stat(filename, &source) < 0) {
+		printf("File %s could not be opened\n", filename);
+		return -1;
+	}
+
+	std::string path = std::string(filename) + ".iq8";
+	if (sidecar.open(path.c_str()) && sidecar.size() >= IQ8_HEADER_LEN) {
+		const iq8_header_t *header = (const iq8_header_t *)sidecar.data();
+		if (header->magic == IQ8_MAGIC && header->version == IQ8_VERSION &&
+			header->num_samples == sidecar.size() - IQ8_HEADER_LEN &&
+			header->source_size == (uint64_t)source.st_size &&
+			header->source_mtime_ns == mtime_ns(source)) {
+			// Sequential read of the whole mapping follows
+			madvise((void *)sidecar.data(), sidecar.size(), MADV_SEQUENTIAL);
+			from_sidecar = true;
+			return 0;
+		}
+	}
+	sidecar.close();
+
+	if (parse_text_vector(filename, parsed) < 0)
+		return -1;
+	write_sidecar(path, source, parsed);
+	return 0;
+}
+
+
+//**********************************************
+// IqStreamReader
+//**********************************************
+bool IqStreamReader::map_samples(int i, const char *filename)
+{
+	if (!map[i].open(filename)) {
+		printf("File %s could not be opened\n", filename);
+		return false;
+	}
+	// .iq8 files are read past their header, anything else is raw int8
+	data_offset[i] = 0;
+	if (map[i].size() >= IQ8_HEADER_LEN) {
+		const iq8_header_t *header = (const iq8_header_t *)map[i].data();
+		if (header->magic == IQ8_MAGIC && header->version == IQ8_VERSION &&
+			header->num_samples == map[i].size() - IQ8_HEADER_LEN)
+			data_offset[i] = IQ8_HEADER_LEN;
+	}
+	samples[i] = map[i].data() + data_offset[i];
+	map[i].advise(0, map[i].size(), MADV_SEQUENTIAL);
+	return true;
+}
+
+bool IqStreamReader::open(const char *file_I, const char *file_Q)
+{
+	is_interleaved = false;
+	pos = 0;
+	if (!map_samples(0, file_I) || !map_samples(1, file_Q))
+		return false;
+	total = map[0].size() - data_offset[0];
+	if (total != map[1].size() - data_offset[1]) {
+		printf("%s and %s differ in length\n", file_I, file_Q);
+		return false;
+	}
+	return true;
+}
+
+bool IqStreamReader::open(const char *file_iq)
+{
+	is_interleaved = true;
+	pos = 0;
+	map[1].close();
+	if (!map_samples(0, file_iq))
+		return false;
+	total = (map[0].size() - data_offset[0]) / 2;
+	planes.resize(2 * chunk_samples);
+	return true;
+}
+
+bool IqStreamReader::next(iq_view_t *view)
+{
+	if (pos >= total)
+		return false;
+
+	// Everything before this chunk has been consumed
+	size_t width = is_interleaved ? 2 : 1;
+	for (int i = 0; i < (is_interleaved ? 1 : 2); i++)
+		map[i].advise(0, data_offset[i] + pos * width, MADV_DONTNEED);
+
+	size_t n = (total - pos < chunk_samples) ? (size_t)(total - pos) : chunk_samples;
+	view->first_sample = pos;
+	view->num_samples = n;
+	if (is_interleaved) {
+		const char *iq = samples[0] + pos * 2;
+		char *I = planes.data();
+		char *Q = planes.data() + chunk_samples;
+		for (size_t k = 0; k < n; k++) {
+			I[k] = iq[2*k];
+			Q[k] = iq[2*k + 1];
+		}
+		view->iq = iq;
+		view->I = I;
+		view->Q = Q;
+	} else {
+		view->iq = NULL;
+		view->I = samples[0] + pos;
+		view->Q = samples[1] + pos;
+	}
+	pos += n;
+	return true;
+}
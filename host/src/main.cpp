@@ -22,11 +22,26 @@
 #include <string.h>
 #include <iomanip>
 #include <map>
+#include <vector>
 #include <random>
 #include <cmath>
+#include <climits>
+#include <algorithm>
 #include "CL/opencl.h"
 #include "AOCLUtils/aocl_utils.h"
 #include <malloc.h>
+#include <unistd.h>
+#include "snr_engine.h"
+#include "snr_multi_engine.h"
+#include "snr_backend.h"
+#include "snr_daemon.h"
+#include "snr_opencl.h"
+#include "iq_file.h"
+#include "iq_async.h"
+#include "snr_agc.h"
+#include "cordic_batch.h"
+#include "snr_window_engine.h"
+#include "snr_decimated_engine.h"
 
 
 using namespace aocl_utils;
@@ -47,67 +62,50 @@ typedef char msg_t;
 typedef char msg2_t;
 
 
-#define SLOT_LEN         4096 // DVB-S2 slot length is 90 symbols
-//#define SLOT_LEN         1100 // DVB-S2 slot length is 90 symbols
-//#define SLOT_LEN         90 // DVB-S2 slot length is 90 symbols
-
-
-enum KERNELS {
-K_READER,
-K_SNR_EST_LUT_CORRECTION,
-K_WRITER,
-K_NUM_KERNELS
-};
-
-static const char* kernel_names[K_NUM_KERNELS] =
-{
-"data_in",
-"snr_est_LUT_correction",
-"data_out"
-};
-
-
 const char *device_kernel;
 
-// OpenCL runtime configuration
-cl_platform_id platform = NULL;
-unsigned num_devices = 0;
-cl_device_id device;
-cl_context context = NULL;
-cl_command_queue queue[K_NUM_KERNELS];
-cl_program program = NULL;
-cl_kernel kernel[K_NUM_KERNELS];
-cl_mem input_noisy_message_I_buf;
-cl_mem input_noisy_message_Q_buf;
-cl_mem output_buf;
-
-unsigned int slotLen = SLOT_LEN;
 unsigned int numFrames = 0;
 unsigned int SNR_in = 0;
 unsigned int SNR_expected = 0;
 unsigned int SOF_ind = 0;
-int input_file_size = 0;
-int num_output_frames = 1;
-//int num_output_frames = 4;
 
-void *noisyDataIn_I_array_ptr = alignedMalloc((slotLen)*sizeof(char));
-void *noisyDataIn_Q_array_ptr = alignedMalloc((slotLen)*sizeof(char));
-void *dout_snr_est_ptr = alignedMalloc(num_output_frames*sizeof(short));
 
+// One I/Q test vector and the estimates made from it.  The arrays come from
+// alignedMalloc so the OpenCL zero-copy mode can use them in place.
+class Capture {
+public:
+	Capture() : I(NULL), Q(NULL), snr_est(NULL), num_samples(0), num_output_frames(0) {}
+	~Capture() { release(); }
 
-char *noisyDataIn_I = (char *)noisyDataIn_I_array_ptr;
-char *noisyDataIn_Q = (char *)noisyDataIn_Q_array_ptr;
-// I pass the numerator and denominator out as unsigned longs
-short *dout_snr_est = (short *)dout_snr_est_ptr;
+	int load(const char *file_I, const char *file_Q);
+
+	char *I;
+	char *Q;
+	short *snr_est;          // num_output_frames estimates
+	int num_samples;
+	int num_output_frames;
+
+private:
+	Capture(const Capture &);
+	Capture &operator=(const Capture &);
+	void release();
+};
 
 
 // Function prototypes
-int read_test_vector_file_char(const char *filename, char *din_array);
+int append_test_vector_file_char(const char *filename, std::vector<char> &din);
 int read_test_vector_file_short(const char *filename, short *din_array);
-bool init_opencl();
-void run();
+int benchmark_transfer_modes(int num_reps, Capture &capture);
+int run_capture_list(SnrBackend *backend, const char *list_file);
+int run_daemon_job(const char *socket_path, Capture &capture);
+int run_stream(SnrBackend *backend, const char *stream_spec);
+SnrBackend *init_backend(const char *name);
+int run_backend_mode(int (*mode)(SnrBackend *, const char *), const char *arg);
 void cleanup();
-int verify_output();
+int verify_output(const Capture &capture);
+int verify_native_golden();
+bool verify_agc_golden();
+bool verify_multi_engine_golden();
 
 
 //test vector data files
@@ -118,6 +116,22 @@ const char *output_data_file;
 
 
 char ptype = EMULATION_PLAT;
+bool golden_mode = false;
+bool zero_copy = false;     // wrap the host arrays with CL_MEM_USE_HOST_PTR instead of copying
+int bench_reps = 0;         // > 0 compares copy and zero-copy modes
+const char *capture_list_file = NULL;
+const char *report_file = NULL;     // -o: per frame CSV or JSON lines for -c and -r
+const char *daemon_socket = NULL;   // -d: serve jobs on this socket
+const char *job_socket = NULL;      // -j: send the test vector to the daemon on this socket
+const char *stream_spec = NULL;     // -r: binary capture to stream, "iq_file" or "I_file,Q_file"
+bool uring_ingest = false;          // -u: read the -r capture with io_uring instead of mapping it
+float agc_target = 0;               // -a: > 0 runs the block AGC to this signal amplitude first
+unsigned int hop_length = 0;        // -H: > 0 streams -r through the native engine, an estimate every hop_length samples
+bool multi_window = false;          // -w: streams -r through the native multi window engine, every window's dwells
+int seq_precision = 0;              // -p: > 0 streams -r through the native engine in sequential mode, tenths of a dB
+unsigned int decimation = 1;        // -k: > 1 streams -r through the native decimated engine, one sample in decimation
+bool decimation_random = false;     // -k r<k>: a random sample of each group instead of the first
+const char *backend_name = "opencl";
 
 
 //****************************************
@@ -168,7 +182,7 @@ struct Arg : public option::Arg
 	}
 };
 
-enum  optionIndex { UNKNOWN, HELP, NFRAME, EMODE, HMODE, N_FRAMES, SNR };
+enum  optionIndex { UNKNOWN, HELP, NFRAME, EMODE, HMODE, N_FRAMES, SNR, GOLDEN, BACKEND, ZERO_COPY, XFER_BENCH, CAPTURES, REPORT, DAEMON, JOB, STREAM, URING, AGC, HOP, WINDOWS, SEQ, DECIM };
 const option::Descriptor usage[] = {
 	{ UNKNOWN, 0, "", "", Arg::Unknown, "USAGE: example_arg [options]\n\n"
 	"Options:" },
@@ -178,6 +192,23 @@ const option::Descriptor usage[] = {
 	{ HMODE, 0, "h", "run on hardware", Arg::None, "  -h\t\tRun on hardware" },
 	{ SNR, 0, "s", "SNR test input val ", Arg::Required, "  -s <arg>, \t--required=<arg>  \tSNR_in\n \t\t0 = 3 dB\n, \t\t1 = 6 dB,\n \t\t2 = 9 dB,\n"
 	"\t\t3 = 12 dB\n, \t\t4 = NA,\n \t\t5 = NA." },
+	{ BACKEND, 0, "b", "backend", Arg::Required, "  -b <arg>, \t--backend=<arg>  \tEstimator backend\n"
+	"\t\topencl = FPGA or Intel emulator (default),\n \t\tcpu = native engine on all cores,\n"
+	" \t\temu = .cl kernels as native threads,\n \t\tauto = opencl if a platform is found, otherwise cpu." },
+	{ ZERO_COPY, 0, "z", "zero-copy", Arg::None, "  -z, \t--zero-copy  \tUse the host arrays as the kernel buffers (CL_MEM_USE_HOST_PTR), for SoC boards where host and FPGA share DRAM." },
+	{ XFER_BENCH, 0, "t", "transfer benchmark", Arg::Required, "  -t <arg>, \t--required=<arg>  \tRun the copy and zero-copy modes <arg> times each and compare them." },
+	{ CAPTURES, 0, "c", "captures", Arg::Required, "  -c <arg>, \t--required=<arg>  \tManifest with one \"I_file Q_file [expected_snr_dB]\" capture per line.  All captures are estimated in one batch." },
+	{ REPORT, 0, "o", "report", Arg::Required, "  -o <arg>, \t--required=<arg>  \tWith -c or -r, write one line per frame to <arg>: JSON lines if it ends in .json, otherwise CSV." },
+	{ STREAM, 0, "r", "stream", Arg::Required, "  -r <arg>, \t--required=<arg>  \tStream a binary int8 capture of any length through the backend: <iq_file> of interleaved I/Q pairs, or <I_file>,<Q_file> planes (raw or .iq8)." },
+	{ HOP, 0, "H", "hop", Arg::Required, "  -H <arg>, \t--required=<arg>  \tWith -r, slide the estimator over the whole capture with the native engine and report an estimate of the last dwell every <arg> samples (the -DSNR_HOP_LENGTH kernel build)." },
+	{ WINDOWS, 0, "w", "windows", Arg::None, "  -w, \t--windows  \tWith -r, estimate 90, 512, 1024 and 4096 sample dwells side by side from one magnitude pass with the native engine (the -DSNR_MULTI_WINDOW kernel build)." },
+	{ SEQ, 0, "p", "precision", Arg::Required, "  -p <arg>, \t--required=<arg>  \tWith -r, estimate each dwell sequentially with the native engine and report it as soon as it is within <arg> dB, at the latest at the end of the dwell (the -DSNR_SEQ_PRECISION kernel build)." },
+	{ DECIM, 0, "k", "decimation", Arg::Required, "  -k <arg>, \t--required=<arg>  \tWith -r, estimate each dwell from one sample in <arg> (2, 4 or 8) with the native engine, for a noisier estimate at 1/<arg> of the cost.  r<arg> picks a random sample from each group of <arg> instead of the first." },
+	{ URING, 0, "u", "uring", Arg::None, "  -u, \t--uring  \tWith -r, read the capture with io_uring, several chunks ahead of the estimator (pread where io_uring is unavailable)." },
+	{ DAEMON, 0, "d", "daemon", Arg::Required, "  -d <arg>, \t--required=<arg>  \tInitialize the backend once and serve jobs on the Unix socket <arg> until SIGINT/SIGTERM." },
+	{ JOB, 0, "j", "job", Arg::Required, "  -j <arg>, \t--required=<arg>  \tSend the test vector to the daemon on the Unix socket <arg> instead of running a backend." },
+	{ AGC, 0, "a", "agc", Arg::Required, "  -a <arg>, \t--required=<arg>  \tWith -r, -c or the -s test vector, run the block AGC in front of the estimator, scaling each dwell to signal amplitude <arg> (21 for the bundled LUT)." },
+	{ GOLDEN, 0, "g", "golden", Arg::None, "  -g, \t--golden  \tRun the native engine on every test vector and check it against the golden estimates." },
 	{ 0, 0, 0, 0, 0, 0 } };
 
 
@@ -242,6 +273,59 @@ int main(int argc, char **argv) {
 		case HMODE:
 			ptype = HARDWARE_PLAT;
 			break;
+		case GOLDEN:
+			golden_mode = true;
+			break;
+		case BACKEND:
+			backend_name = opt.arg;
+			break;
+		case ZERO_COPY:
+			zero_copy = true;
+			break;
+		case XFER_BENCH:
+			bench_reps = atoi(opt.arg);
+			break;
+		case CAPTURES:
+			capture_list_file = opt.arg;
+			break;
+		case REPORT:
+			report_file = opt.arg;
+			break;
+		case DAEMON:
+			daemon_socket = opt.arg;
+			break;
+		case JOB:
+			job_socket = opt.arg;
+			break;
+		case STREAM:
+			stream_spec = opt.arg;
+			break;
+		case URING:
+			uring_ingest = true;
+			break;
+		case AGC:
+			agc_target = atof(opt.arg);
+			break;
+		case HOP:
+			hop_length = atoi(opt.arg);
+			break;
+		case WINDOWS:
+			multi_window = true;
+			break;
+		case SEQ:
+			seq_precision = (int)lround(atof(opt.arg) * 10);
+			break;
+		case DECIM: {
+			// Only the decimations there are LUTs for, anything else is an error
+			decimation_random = (opt.arg[0] == 'r');
+			char *end;
+			decimation = (unsigned int)strtoul(opt.arg + (decimation_random ? 1 : 0), &end, 10);
+			if (*end != 0 || decimation < 2 || !SnrDecimatedEngine::valid_decimation(decimation)) {
+				fprintf(stderr, "Option '-k' must be 2, 4, 8, r2, r4 or r8, not '%s'\n", opt.arg);
+				return 1;
+			}
+			break;
+		}
 		case UNKNOWN:
 			// not possible because Arg::Unknown returns ARG_ILLEGAL
 			// which aborts the parse with an error
@@ -252,6 +336,43 @@ int main(int argc, char **argv) {
 	for (int i = 0; i < parse.nonOptionsCount(); ++i)
 		fprintf(stdout, "Non-option argument #%d is %s\n", i, parse.nonOption(i));
 
+	// Every mode below that starts the opencl backend needs the kernel name
+	if (ptype == EMULATION_PLAT)
+		device_kernel = "SNR_estimator_LUT_correction_top";
+//		device_kernel = "snr_estimator_em";
+	else
+		device_kernel = "snr_estimator";
+
+	// The native engine options only act in some modes; refuse them in the
+	// others rather than run without them.  The modes are tried in the
+	// order below, so e.g. -r is not the run that happens under -c.
+	const char *run_mode = golden_mode ? "-g" : daemon_socket ? "-d" : capture_list_file ? "-c" :
+		stream_spec ? "-r" : NULL;
+	const struct { int index; const char *flag; } stream_only[] = {
+		{ HOP, "-H" }, { WINDOWS, "-w" }, { SEQ, "-p" }, { DECIM, "-k" }, { URING, "-u" } };
+	for (unsigned int i = 0; i < sizeof(stream_only)/sizeof(stream_only[0]); i++) {
+		if (options[stream_only[i].index] && (run_mode == NULL || strcmp(run_mode, "-r") != 0)) {
+			fprintf(stderr, "Option '%s' only applies with -r, not to a %s run\n", stream_only[i].flag,
+				run_mode ? run_mode : "-s test vector");
+			return 1;
+		}
+	}
+	if (options[AGC] && (golden_mode || daemon_socket)) {
+		fprintf(stderr, "Option '-a' only applies with -r, -c or the -s test vector, not to a %s run\n", run_mode);
+		return 1;
+	}
+
+	// The golden check only needs the native engine, not an OpenCL platform
+	if (golden_mode)
+		return verify_native_golden() == 0 ? 0 : 1;
+
+	if (daemon_socket)
+		return run_backend_mode(snr_daemon_serve, daemon_socket);
+	if (capture_list_file)
+		return run_backend_mode(run_capture_list, capture_list_file);
+	if (stream_spec)
+		return run_backend_mode(run_stream, stream_spec);
+
 // These are I/Q test input files at various SNR's and # of samples	
 	if (SNR_in == 0) {
 //	input_noisy_sym_file_I = "noisy_sym_IN_I_3dB.txt";
@@ -294,12 +415,6 @@ int main(int argc, char **argv) {
 	
 	output_data_file = "snr_est_OUT.txt";
 
-	if (ptype == EMULATION_PLAT)
-		device_kernel = "SNR_estimator_LUT_correction_top";
-//		device_kernel = "snr_estimator_em";
-	else
-		device_kernel = "snr_estimator";
-
 #ifdef VERBOSE
 	//************************************
 	// Display Frame Type and Code Rate
@@ -307,7 +422,7 @@ int main(int argc, char **argv) {
 	printf("\n\n****************************************************************************\n");
 	if (ptype == HARDWARE_PLAT) printf("Platform=Hardware\n");
 	else printf("Platform=Emulator\n");
-	printf("Number of symbols per slot=%d\n", slotLen);
+	printf("Number of symbols per slot=%d\n", SLOT_LEN);
 	printf("****************************************************************************\n\n");
 #endif
 		
@@ -321,35 +436,50 @@ int main(int argc, char **argv) {
 		return -1;
 	} */
 	// read I and Q in same file or separate?
-	if (read_test_vector_file_char(input_noisy_sym_file_I, noisyDataIn_I) < 0)
+	Capture capture;
+	if (capture.load(input_noisy_sym_file_I, input_noisy_sym_file_Q) < 0)
 	{
-		printf("Error opening input noisy data I vector file\n");
+		printf("Error opening input noisy data I/Q vector files\n");
 		return -1;
 	}
-	if (read_test_vector_file_char(input_noisy_sym_file_Q, noisyDataIn_Q) < 0)
-	{
-		printf("Error opening input noisy data Q vector file\n");
-		return -1;
+	if (agc_target > 0) {
+		SnrBlockAgc agc(agc_target);
+		agc.process(capture.I, capture.Q, capture.I, capture.Q, capture.num_samples);
+		printf("AGC: gain %0.3f, %llu values clipped\n", agc.last_gain(), agc.clipped());
 	}
-
-	num_output_frames = input_file_size/1024;
 	
-	//_***********************
-	// Initialize OpenCL.
-	//_***********************
-	if (!init_opencl()) {
-		return -1;
-	}
+	if (bench_reps > 0)
+		return benchmark_transfer_modes(bench_reps, capture);
+
+	if (job_socket) {
+		if (run_daemon_job(job_socket, capture) < 0)
+			return -1;
+	} else {
+		//_*******************************
+		// Initialize the backend.
+		//_*******************************
+		SnrBackend *backend = init_backend(backend_name);
+		if (backend == NULL) {
+			return -1;
+		}
 	
-	//_************
-	// Run Kernel
-	//_************
-	run();
+		//_************
+		// Run Kernel
+		//_************
+		if (!backend->run(capture.I, capture.Q, capture.num_samples, capture.snr_est)) {
+			printf("ERROR: Backend %s failed\n", backend->name());
+			delete backend;
+			return -1;
+		}
+		printf("Backend %s: %0.3f ms, %0.3f Msamples/s\n", backend->name(),
+			backend->run_seconds() * 1e3, backend->throughput() * 1e-6);
+		delete backend;
+	}
 
 	//_******************
 	// Verify Results
 	//_******************
-	if (verify_output() == 0)
+	if (verify_output(capture) == 0)
 	{
 		printf("Estimated SNR is within +/-1 of real value.... PASSED!\n");
 	}
@@ -358,11 +488,6 @@ int main(int argc, char **argv) {
 		printf("Estimated SNR not within +/-1 of real value.... FAILED!\n");
 	}
 	
-	//_*********************************
-	// Free the resources allocated
-	//_*********************************
-	//cleanup();
-
 	return 0;
 }
 
@@ -373,38 +498,73 @@ int main(int argc, char **argv) {
 
 /************************************************************************
 
-@brief The read_test_vector_file function reads a text file of input
-parameters intended to be used as inputs to an OpenCL module
+@brief The read_test_vector_file functions read a text file of input
+parameters intended to be used as inputs to an OpenCL module.  Char
+vectors go through IqVectorFile, so after the first run they come
+straight from the file's .iq8 sidecar.
 
 @param filename is a const char pointer containg the name of the
 file to be parsed
-@param din_array is a float array that holds the fields parsed data
+@param din is a vector the parsed samples are appended to
 @return int if a negative value is returned the function failed
 
 *************************************************************************/
 
 
-int read_test_vector_file_char(const char *filename, char *din_array)
+int append_test_vector_file_char(const char *filename, std::vector<char> &din)
 {
-	FILE* file = fopen(filename, "rt");
-	if (file == NULL) {
-		printf("File %s could not be opened\n", filename);
+	IqVectorFile file;
+	if (file.load(filename) < 0)
+		return -1;
+	din.insert(din.end(), file.data(), file.data() + file.size());
+	return 0;
+}
+
+
+/************************************************************************
+
+@brief Capture::load reads an I and a Q test vector file into new
+aligned arrays and makes room for their estimates
+
+@return int if a negative value is returned the function failed
+
+*************************************************************************/
+int Capture::load(const char *file_I, const char *file_Q)
+{
+	IqVectorFile din_I, din_Q;
+	if (din_I.load(file_I) < 0 || din_Q.load(file_Q) < 0)
+		return -1;
+	if (din_I.size() != din_Q.size()) {
+		printf("%s and %s differ in length\n", file_I, file_Q);
 		return -1;
-	}
-	char line[256];
-	input_file_size = 0;  // reset for each input such as I and Q
-	while (fgets(line, sizeof(line), file))
-	{
-		int r = strtol(line, nullptr, 10);
-		char tmp = (char)r;
-		*din_array++ = (char)r;
-		input_file_size += 1;
 	}
 
-	fclose(file);
+	release();
+	num_samples = din_I.size();
+	num_output_frames = num_samples/SNR_DWELL_LENGTH;
+	// never zero sized, alignedMalloc may return NULL for that
+	I = (char *)alignedMalloc(num_samples + 1);
+	Q = (char *)alignedMalloc(num_samples + 1);
+	snr_est = (short *)alignedMalloc((num_output_frames + 1)*sizeof(short));
+	memcpy(I, din_I.data(), num_samples);
+	memcpy(Q, din_Q.data(), num_samples);
+	memset(snr_est, 0, (num_output_frames + 1)*sizeof(short));
 	return 0;
 }
 
+void Capture::release()
+{
+	if (I)
+		alignedFree(I);
+	if (Q)
+		alignedFree(Q);
+	if (snr_est)
+		alignedFree(snr_est);
+	I = Q = NULL;
+	snr_est = NULL;
+	num_samples = num_output_frames = 0;
+}
+
 
 int read_test_vector_file_short(const char *filename, short *din_array)
 {
@@ -439,14 +599,15 @@ against a text file containg outptus generated in Matlab
 @return int if less than 0 an error has occurred
 
 **************************************************************/
-int verify_output()
+int verify_output(const Capture &capture)
 {
+	const short *dout_snr_est = capture.snr_est;
 
 //    printf("in verify_output:  The estimated SNR numerator is =%lu \n", dout_snr_est[0]);
 //	printf("in verify_output:  The estimated SNR denominator is =%lu \n", dout_snr_est[1]);
 	int bool_val = 1;
-	printf("in verify_output: The input_file_size is =%d\n", input_file_size);
-	for (int i = 0; i < num_output_frames; i++) {
+	printf("in verify_output: The input_file_size is =%d\n", capture.num_samples);
+	for (int i = 0; i < capture.num_output_frames; i++) {
 		printf("in verify_output: The estimated SNR is =%f\n", (double)dout_snr_est[i]/10);
 //	if (abs(((double)dout_snr_est[0]/(double)dout_snr_est[1]) - SNR_expected) < 1)
 		if (abs(((double)dout_snr_est[i]/10) - SNR_expected) > 1)
@@ -455,254 +616,1033 @@ int verify_output()
 	return bool_val;
 }
 
-/*************************************************************************
+/**************************************************************
 
-@brief The init_opencl function intializes the OpenCL objects.
-Essentially it looks for an Altera OpenCl device, creates a
-context for that device.  The AOC compiled kernel is pointed to
-using the global variable "device_kernel".  Provided a valid .aocx
-compiled kernel is found, the FPGA is programmed and command and data
-queues are generated.
+@brief Golden estimates for every test vector in bin/, as produced
+by snr_est_LUT_correction.  The 100 sample vectors are shorter
+than one dwell and must not produce an estimate.
 
-@return bool True if successful, otherwise false
+**************************************************************/
+#define GOLDEN_MAX_EST  4
+
+typedef struct golden_vector_t {
+	const char *file_I;
+	const char *file_Q;
+	int num_estimates;
+	short snr_est[GOLDEN_MAX_EST];
+	unsigned long numerator[GOLDEN_MAX_EST];
+	unsigned long noiseVarSum_final[GOLDEN_MAX_EST];
+} golden_vector_t;
+
+static const golden_vector_t golden_vectors[] = {
+	{ "noisy_sym_IN_I_3dB.txt", "noisy_sym_IN_Q_3dB.txt", 0, { 0 }, { 0 }, { 0 } },
+	{ "noisy_sym_IN_I_6dB.txt", "noisy_sym_IN_Q_6dB.txt", 0, { 0 }, { 0 }, { 0 } },
+	{ "noisy_sym_IN_I_9dB.txt", "noisy_sym_IN_Q_9dB.txt", 0, { 0 }, { 0 }, { 0 } },
+	{ "noisy_sym_IN_I_3dB_1100Samp.txt", "noisy_sym_IN_Q_3dB_1100Samp.txt",
+	  1, { -7 }, { 5237249024UL }, { 44837798229UL } },
+	{ "noisy_sym_IN_I_6dB_1100Samp.txt", "noisy_sym_IN_Q_6dB_1100Samp.txt",
+	  1, { 35 }, { 5017149440UL }, { 20823535067UL } },
+	{ "noisy_sym_IN_I_9dB_1100Samp.txt", "noisy_sym_IN_Q_9dB_1100Samp.txt",
+	  1, { 63 }, { 5053574144UL }, { 11558182530UL } },
+	{ "noisy_sym_IN_I_highSNR_freqOffset_1100Samp_pilots.txt", "noisy_sym_IN_Q_highSNR_freqOffset_1100Samp_pilots.txt",
+	  1, { 309 }, { 2819863552UL }, { 32653480UL } },
+	{ "noisy_sym_IN_I_highSNR_freqOffset_4096Samp_pilots.txt", "noisy_sym_IN_Q_highSNR_freqOffset_4096Samp_pilots.txt",
+	  4, { 309, 303, 313, 294 },
+	  { 2819863552UL, 2810897408UL, 2783976448UL, 2776775680UL },
+	  { 32653480UL, 37986906UL, 29344008UL, 46097454UL } },
+	{ "noisy_sym_IN_I_minus10dB_1100Samp_21Mag.txt", "noisy_sym_IN_Q_minus10dB_1100Samp_21Mag.txt",
+	  1, { -98 }, { 6164776960UL }, { 147500755450UL } },
+	{ "noisy_sym_IN_I_minus10dB_1100Samp_pilots.txt", "noisy_sym_IN_Q_minus10dB_1100Samp_pilots.txt",
+	  1, { -100 }, { 10371758080UL }, { 403769275069UL } },
+	{ "noisy_sym_IN_I_minus3dB_1100Samp_21Mag.txt", "noisy_sym_IN_Q_minus3dB_1100Samp_21Mag.txt",
+	  1, { -27 }, { 3607247872UL }, { 40316158224UL } },
+	{ "noisy_sym_IN_I_minus6dB_1100Samp_21Mag.txt", "noisy_sym_IN_Q_minus6dB_1100Samp_21Mag.txt",
+	  1, { -59 }, { 4453013504UL }, { 71213961792UL } },
+};
 
-**************************************************************************/
-bool init_opencl() {
-	cl_int status;
 
-	//printf("Initializing OpenCL\n");
+/**************************************************************
+
+@brief The golden_matches_at_width function pushes a test vector
+through the native engine as samples of type T, each int8 sample
+times scale, and checks every dwell against its golden estimates.
+With scale 256 for sc16 and 1/128 for fc32 the CORDIC sees the
+same inputs as for int8, so the results must be identical.
 
-	if (!setCwdToExeDir()) {
-		return false;
+**************************************************************/
+template <typename T>
+static bool golden_matches_at_width(const Capture &capture, double scale, const golden_vector_t *g)
+{
+	std::vector<T> I(capture.num_samples), Q(capture.num_samples);
+	for (int i = 0; i < capture.num_samples; i++) {
+		I[i] = (T)(capture.I[i] * scale);
+		Q[i] = (T)(capture.Q[i] * scale);
 	}
 
+	SnrEngine engine;
+	snr_estimate_t est[GOLDEN_MAX_EST+1];
+	engine.push(I.data(), Q.data(), I.size());
+	int num_est = (int)engine.poll(est, GOLDEN_MAX_EST+1);
+
+	bool match = (num_est == g->num_estimates);
+	for (int i = 0; match && i < num_est; i++) {
+		if (est[i].snr_est != g->snr_est[i] ||
+			est[i].numerator != g->numerator[i] ||
+			est[i].noiseVarSum_final != g->noiseVarSum_final[i])
+			match = false;
+	}
+	return match;
+}
 
-	//****************************
-	// Get the OpenCL platform.
-	//****************************
-/*	platform = findPlatform("Intel(R) FPGA SDK for OpenCL(TM)");
-	
-	if (platform == NULL) {
-		printf("ERROR: Unable to find Intel(R) FPGA OpenCL platform.\n");
-		return false;
-	} */
-    if (ptype == EMULATION_PLAT) {
-             // new 'fast' emulator
-        platform = findPlatform("Intel(R) FPGA Emulation Platform for OpenCL(TM)");
-        if (platform == NULL) {
-            printf("ERROR: Unable to find Intel(R) FPGA Emulation Platform for OpenCL(TM).\n");
-         // For legacy emulator
-            platform = findPlatform("Intel(R) FPGA SDK for OpenCL(TM)");
-            if (platform == NULL) {
-                printf("ERROR: Unable to find Intel(R) FPGA Legacy Emulation Platform for OpenCL(TM).\n");
-                return false;
-            }
-        }
-    }else{    //use for hardware and simulation
-        platform = findPlatform("Intel(R) FPGA SDK for OpenCL(TM)");
-        if (platform == NULL) {
-            printf("ERROR: Unable to find Intel(R) FPGA SDK for OpenCL(TM).\n");
-            return false;
-        }
-    }
-
-
-
-	//*************************************
-	// Query the available OpenCL devices.
-	//*************************************
-	scoped_array<cl_device_id> devices;
-	devices.reset(getDevices(platform, CL_DEVICE_TYPE_ALL, &num_devices));
-	device = devices[0];
-#ifdef VERBOSE
-	printf("Platform: %s\n", getPlatformName(platform).c_str());
-	printf("Using %d device(s)\n", num_devices);
-	for (unsigned i = 0; i < num_devices; ++i) {
-		printf("  %s\n", getDeviceName(device).c_str());
+
+/**************************************************************
+
+@brief The verify_native_golden function runs every test vector
+through the native engine and compares the numerator, denominator
+and LUT corrected estimate of each dwell against golden_vectors,
+with int8 samples and again as sc16 and fc32.  The integer
+lookup_index of each dwell is also checked against the float one,
+and the hop mode engine, the sequential mode engine, the decimated
+engine and the 1024 sample window of the multi window engine against
+the dwell estimates.  The batch kernels, the multi channel engine
+(verify_multi_engine_golden) and the AGC (verify_agc_golden) are
+checked last.
+
+@return int 0 if every vector matched, otherwise -1
+
+**************************************************************/
+int verify_native_golden()
+{
+	int num_failed = 0;
+	int num_vectors = sizeof(golden_vectors)/sizeof(golden_vectors[0]);
+
+	for (int v = 0; v < num_vectors; v++) {
+		const golden_vector_t *g = &golden_vectors[v];
+		Capture capture;
+		if (capture.load(g->file_I, g->file_Q) < 0) {
+			num_failed += 1;
+			continue;
+		}
+
+		SnrEngine engine;
+		snr_estimate_t est[GOLDEN_MAX_EST+1];
+		engine.push(capture.I, capture.Q, capture.num_samples);
+		int num_est = (int)engine.poll(est, GOLDEN_MAX_EST+1);
+
+		bool match = (num_est == g->num_estimates);
+		for (int i = 0; match && i < num_est; i++) {
+			if (est[i].snr_est != g->snr_est[i] ||
+				est[i].numerator != g->numerator[i] ||
+				est[i].noiseVarSum_final != g->noiseVarSum_final[i])
+				match = false;
+			// The integer lookup_index must agree with the float one it replaced
+			if (snr_lut_index(est[i].numerator, est[i].noiseVarSum_final) !=
+				snr_lookup_index(est[i].numerator, est[i].noiseVarSum_final))
+				match = false;
+		}
+		// A hop that divides the dwell lands on every dwell end, where the
+		// sliding estimate must be the dwell's own
+		SnrEngine hop_engine(SNR_DWELL_LENGTH/8);
+		hop_engine.push(capture.I, capture.Q, capture.num_samples);
+		int num_dwell_ends = 0;
+		snr_estimate_t h;
+		while (hop_engine.poll(&h, 1)) {
+			if ((h.sample_ind + 1) % SNR_DWELL_LENGTH != 0)
+				continue;
+			int k = num_dwell_ends++;
+			if (k >= num_est || h.sample_ind != est[k].sample_ind || h.snr_est != est[k].snr_est ||
+				h.numerator != est[k].numerator || h.noiseVarSum_final != est[k].noiseVarSum_final)
+				match = false;
+		}
+		if (num_dwell_ends != num_est)
+			match = false;
+		// Sequential mode still gives one estimate per dwell, and those that
+		// waited for the end of the dwell are the dwell's own
+		SnrEngine seq_engine(0, 10);
+		seq_engine.push(capture.I, capture.Q, capture.num_samples);
+		if ((int)seq_engine.pending() != num_est)
+			match = false;
+		for (int i = 0; seq_engine.poll(&h, 1); i++) {
+			if (i >= num_est || h.sample_ind / SNR_DWELL_LENGTH != est[i].sample_ind / SNR_DWELL_LENGTH)
+				match = false;
+			else if (h.sample_ind == est[i].sample_ind && (h.snr_est != est[i].snr_est ||
+				h.numerator != est[i].numerator || h.noiseVarSum_final != est[i].noiseVarSum_final))
+				match = false;
+		}
+		// The decimated engine with every sample is the dwell; with fewer it
+		// must stay within the accuracy bound it documents
+		for (unsigned int k = 1; k <= SNR_DECIM_MAX; k *= 2) {
+			for (unsigned int seed = 0; seed <= (k > 1 ? SNR_DECIM_SEEDS : 0); seed++) {
+				SnrDecimatedEngine decim_engine(k, seed > 0, seed);
+				decim_engine.push(capture.I, capture.Q, capture.num_samples);
+				if ((int)decim_engine.pending() != num_est)
+					match = false;
+				for (int i = 0; decim_engine.poll(&h, 1); i++) {
+					if (i >= num_est || h.sample_ind / SNR_DWELL_LENGTH != est[i].sample_ind / SNR_DWELL_LENGTH ||
+						abs(h.snr_est - est[i].snr_est) > SnrDecimatedEngine::accuracy_bound(k))
+						match = false;
+					else if (k == 1 && (h.sample_ind != est[i].sample_ind || h.numerator != est[i].numerator ||
+						h.noiseVarSum_final != est[i].noiseVarSum_final))
+						match = false;
+				}
+			}
+		}
+		// The 1024 sample window of the multi window engine is the dwell
+		SnrWindowEngine window_engine;
+		window_engine.push(capture.I, capture.Q, capture.num_samples);
+		if ((int)window_engine.pending(2) != num_est)
+			match = false;
+		for (int i = 0; window_engine.poll(2, &h, 1); i++) {
+			if (i >= num_est || h.sample_ind != est[i].sample_ind || h.snr_est != est[i].snr_est ||
+				h.numerator != est[i].numerator || h.noiseVarSum_final != est[i].noiseVarSum_final)
+				match = false;
+		}
+		if (!golden_matches_at_width<short>(capture, 256.0, g) ||
+			!golden_matches_at_width<float>(capture, 1.0/128, g))
+			match = false;
+		printf("%s %s\n", match ? "PASSED" : "FAILED", g->file_I);
+		if (!match)
+			num_failed += 1;
 	}
-#endif
 
-	//*********************
-	// Create the context.
-	//*********************
-	context = clCreateContext(NULL, num_devices, &device, &oclContextCallback, NULL, &status);
-	checkError(status, "Failed to create context");
+	printf("Native golden check: %d of %d vectors matched\n", num_vectors - num_failed, num_vectors);
+
+	//************************************************
+	// All vectors again as one batch through the
+	// data_in_batch/data_out_batch kernels
+	//************************************************
+	std::vector<char> batch_I, batch_Q;
+	std::vector<unsigned int> capture_offsets(1, 0);
+	for (int v = 0; v < num_vectors; v++) {
+		if (append_test_vector_file_char(golden_vectors[v].file_I, batch_I) < 0 ||
+			append_test_vector_file_char(golden_vectors[v].file_Q, batch_Q) < 0)
+			return -1;
+		capture_offsets.push_back(batch_I.size());
+	}
+	std::vector<unsigned int> est_offsets(num_vectors+1);
+	std::vector<short> batch_est(snr_batch_est_offsets(capture_offsets.data(), num_vectors, est_offsets.data()) + 1);
+
+	SnrBackend *emu = create_native_backend("emu");
+	bool batch_match = emu->init() &&
+		emu->run_batch(batch_I.data(), batch_Q.data(), capture_offsets.data(), num_vectors, batch_est.data());
+	for (int v = 0; batch_match && v < num_vectors; v++) {
+		const golden_vector_t *g = &golden_vectors[v];
+		if ((int)(est_offsets[v+1] - est_offsets[v]) != g->num_estimates)
+			batch_match = false;
+		for (int i = 0; batch_match && i < g->num_estimates; i++) {
+			if (batch_est[est_offsets[v] + i] != g->snr_est[i])
+				batch_match = false;
+		}
+	}
+	delete emu;
+	printf("Batched kernel golden check: %s\n", batch_match ? "PASSED" : "FAILED");
 
-	//************************************
-	// Create the program for all device. 
-	//************************************
-	std::string binary_file = getBoardBinaryFile(device_kernel, device);
-#ifdef VERBOSE
-	printf("Using AOCX: %s\n", binary_file.c_str());
-#endif
-	program = createProgramFromBinary(context, binary_file.c_str(), &device, num_devices);
-
-	//*******************************************
-	// Build the program that was just created.
-	//*******************************************
-	status = clBuildProgram(program, 0, NULL, "", NULL, NULL);
-	checkError(status, "Failed to build program");
-
-	//**********************
-	// Create Command queue.
-	//**********************
-	for (int i = 0; i < K_NUM_KERNELS; ++i)
-	{
-		queue[i] = clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, &status);
-		checkError(status, "Failed to create command queue %d", i);
+	bool multi_match = verify_multi_engine_golden();
+	bool agc_match = verify_agc_golden();
+
+	return (num_failed == 0 && batch_match && multi_match && agc_match) ? 0 : -1;
+}
+
+
+/**************************************************************
+
+@brief The verify_multi_engine_golden function runs
+GOLDEN_MULTI_CHANNELS channels of GOLDEN_MULTI_SAMPLES samples
+through SnrMultiEngine and checks every dwell of every channel
+against SnrEngine on that channel alone.  Channel c is test vector
+c % num_vectors, repeated from offset 97*c, so neighbouring lanes
+see different levels and the channel count is not a whole number
+of SIMD vectors.  The samples go in as two pushes that split a
+dwell.  Every ISA the CPU supports is forced in turn.
+
+@return bool true if every channel matched with every ISA
+
+**************************************************************/
+#define GOLDEN_MULTI_CHANNELS  37
+#define GOLDEN_MULTI_SAMPLES   5000
+#define GOLDEN_MULTI_SPLIT     1234
+
+bool verify_multi_engine_golden()
+{
+	const cordic_isa_t default_isa = cordic_batch_isa();
+	const cordic_isa_t isas[] = { CORDIC_ISA_SCALAR, CORDIC_ISA_AVX2, CORDIC_ISA_AVX512 };
+	int num_vectors = sizeof(golden_vectors)/sizeof(golden_vectors[0]);
+	const unsigned int nch = GOLDEN_MULTI_CHANNELS;
+	const size_t T = GOLDEN_MULTI_SAMPLES;
+
+	// [time][channel] interleaved I/Q, and each channel's own planes
+	std::vector<char> iq(T*nch*2);
+	std::vector<std::vector<char> > I(nch, std::vector<char>(T)), Q(nch, std::vector<char>(T));
+	for (unsigned int c = 0; c < nch; c++) {
+		Capture capture;
+		const golden_vector_t *g = &golden_vectors[c % num_vectors];
+		if (capture.load(g->file_I, g->file_Q) < 0)
+			return false;
+		for (size_t t = 0; t < T; t++) {
+			size_t k = (97*c + t) % capture.num_samples;
+			I[c][t] = iq[(t*nch + c)*2] = capture.I[k];
+			Q[c][t] = iq[(t*nch + c)*2 + 1] = capture.Q[k];
+		}
 	}
 
-	//*****************
-	// Create Kernel.
-	//*****************
-	for (int i = 0; i < K_NUM_KERNELS; ++i)
-	{
-		kernel[i] = clCreateKernel(program, kernel_names[i], &status);
-		checkError(status, "Failed to create kernel %s", kernel_names[i]);
-	}
-
-	//**********************
-	// Create Input buffers.
-	//**********************
-	//message buffer - holds encoded message 
-	// CAC - Need one for each of two complex input messages?
-	input_noisy_message_I_buf = clCreateBuffer(context, CL_MEM_READ_ONLY,
-		(SLOT_LEN) * sizeof(char), NULL, &status);
-	input_noisy_message_Q_buf = clCreateBuffer(context, CL_MEM_READ_ONLY,
-		(SLOT_LEN) * sizeof(char), NULL, &status);
-	
-	//**********************  
-	// Create Output buffer.
-	//**********************
-	output_buf = clCreateBuffer(context, CL_MEM_WRITE_ONLY,
-		num_output_frames*sizeof(short), NULL, &status);
-	checkError(status, "Failed to create buffer for output");
+	std::vector<std::vector<snr_estimate_t> > ref(nch);
+	for (unsigned int c = 0; c < nch; c++) {
+		SnrEngine engine;
+		engine.push(I[c].data(), Q[c].data(), T);
+		ref[c].resize(engine.pending());
+		engine.poll(ref[c].data(), ref[c].size());
+	}
 
+	bool all_match = true;
+	for (unsigned int k = 0; k < sizeof(isas)/sizeof(isas[0]); k++) {
+		if (!cordic_batch_force_isa(isas[k]))
+			continue;
+		SnrMultiEngine multi_engine(nch);
+		multi_engine.push(iq.data(), GOLDEN_MULTI_SPLIT);
+		multi_engine.push(iq.data() + GOLDEN_MULTI_SPLIT*nch*2, T - GOLDEN_MULTI_SPLIT);
+
+		bool match = (multi_engine.pending() == ref[0].size());
+		std::vector<snr_estimate_t> est(nch);
+		for (size_t d = 0; match && multi_engine.poll(est.data()); d++) {
+			for (unsigned int c = 0; c < nch; c++) {
+				const snr_estimate_t &r = ref[c][d];
+				if (est[c].sample_ind != r.sample_ind || est[c].snr_est != r.snr_est ||
+					est[c].numerator != r.numerator || est[c].noiseVarSum_final != r.noiseVarSum_final)
+					match = false;
+			}
+		}
+		printf("Multi channel engine %s: %u channels, %s\n", cordic_batch_isa_name(isas[k]), nch,
+			match ? "PASSED" : "FAILED");
+		if (!match)
+			all_match = false;
+	}
+	cordic_batch_force_isa(default_isa);
 
-	return true;
+	return all_match;
 }
 
 
-/*************************************************************************
+/**************************************************************
 
-@brief The run function sets kernel arguments and then launches
-the kernels.  Data is then read from the kernels write buffer.
+@brief The agc_captures function levels every capture of a batch
+in place with its own run of agc: it is reset at each capture, so
+a capture's gain never depends on the captures before it.
 
-@return void
+**************************************************************/
+static void agc_captures(SnrBlockAgc &agc, char *I, char *Q, const unsigned int *capture_offsets,
+	unsigned int num_captures)
+{
+	for (unsigned int c = 0; c < num_captures; c++) {
+		unsigned int first = capture_offsets[c];
+		unsigned int len = capture_offsets[c+1] - first;
+		agc.reset();
+		agc.process(I + first, Q + first, I + first, Q + first, len);
+	}
+}
 
-**************************************************************************/
-void run() {
-	cl_int status;
-	cl_event kernel_event;
-	cl_event finish_event;
-	cl_event events[8];
-
-	const double start_time = getCurrentTimestamp();
-
-	// Copy data from host to device
-	status = clEnqueueWriteBuffer(queue[K_READER], input_noisy_message_I_buf, CL_TRUE,
-		0, (SLOT_LEN)* sizeof(char), noisyDataIn_I, 0, NULL, &events[0]);
-	checkError(status, "Failed to transfer input noisy I data");
-	// Try putting Q data in same buffer, but moved over 90 bytes
-	status = clEnqueueWriteBuffer(queue[K_READER], input_noisy_message_Q_buf, CL_TRUE,
-		0, (SLOT_LEN)* sizeof(char), noisyDataIn_Q, 0, NULL, &events[0]);
-	checkError(status, "Failed to transfer input  noisy Q data");
-	
 
-	//***********************************
-	// Set kernel arguments.
-	//***********************************
-	//SNR Estimation Reader Kernel
-	status = clSetKernelArg(kernel[K_READER], 0, sizeof(cl_mem), &input_noisy_message_I_buf);
-	checkError(status, "Failed to set input reader arg 0");
-	status = clSetKernelArg(kernel[K_READER], 1, sizeof(cl_mem), &input_noisy_message_Q_buf);
-	checkError(status, "Failed to set input reader arg 1");
-	status = clSetKernelArg(kernel[K_READER], 2, sizeof(int), &input_file_size);
-	checkError(status, "Failed to set K_READER arg 2");
-
-	//SNR Estimation
-	status = clSetKernelArg(kernel[K_SNR_EST_LUT_CORRECTION], 0, sizeof(unsigned int), &slotLen);
-	checkError(status, "Failed to set K_SNR_EST_LUT_CORRECTION arg 0");	
-
-	//SNR Estimation Writer Kernel
-	status = clSetKernelArg(kernel[K_WRITER], 0, sizeof(cl_mem), &output_buf);  //store final SNR estimate here
-	checkError(status, "Failed to set K_WRITER arg 0");
-	status = clSetKernelArg(kernel[K_WRITER], 1, sizeof(int), &num_output_frames);
-	checkError(status, "Failed to set K_WRITER arg 1");
-	
-	
-	//***********************************
-	// Enqueue kernel.
-	//*********************************** 
-	status = clEnqueueTask(queue[K_READER], kernel[K_READER], 0, NULL, NULL);
-	checkError(status, "Failed to launch K_READER");
-
-	//Filter
-	status = clEnqueueTask(queue[K_SNR_EST_LUT_CORRECTION], kernel[K_SNR_EST_LUT_CORRECTION], 0, NULL, NULL);
-	checkError(status, "Failed to launch K_SNR_EST_LUT_CORRECTION");
-	
-	// Write
-	status = clEnqueueTask(queue[K_WRITER], kernel[K_WRITER], 0, NULL, &kernel_event);
-	checkError(status, "Failed to launch K_WRITER");
+// The estimates of n samples after a fresh SnrBlockAgc
+template <typename T>
+static std::vector<short> agc_estimates(const T *I, const T *Q, size_t n)
+{
+	std::vector<char> out_I(n), out_Q(n);
+	SnrBlockAgc agc;
+	agc.process(I, Q, out_I.data(), out_Q.data(), n);
+	SnrEngine engine;
+	engine.push(out_I.data(), out_Q.data(), n);
+	std::vector<snr_estimate_t> est(engine.pending());
+	engine.poll(est.data(), est.size());
+	std::vector<short> snr_est;
+	for (size_t i = 0; i < est.size(); i++)
+		snr_est.push_back(est[i].snr_est);
+	return snr_est;
+}
 
-	printf("Before clFinish\n");
 
-	//***************************************************
-	// Wait for command queue to complete pending events
-	//***************************************************
-	status = clFinish(queue[K_WRITER]);
-	checkError(status, "Failed to finish (%d: %s)", K_WRITER, kernel_names[K_WRITER]);
-	
-	printf("Before clEnqueueReadBuffer\n");
-	//********************************************
-	// Read the result. This the final operation.
-	//********************************************
-	status = clEnqueueReadBuffer(queue[K_WRITER], output_buf, CL_TRUE,
-		0, num_output_frames*sizeof(short), dout_snr_est, 0, NULL, NULL);
-
-
-	// Get kernel times using the OpenCL event profiling API.
-	cl_ulong time_ns = getStartEndTime(kernel_event);
-	#ifdef VERBOSE
-		printf("Kernel time: %0.3f ms\n", double(time_ns) * 1e-6);
-	#else
-		printf("%f\t", (numFrames*slotLen)/(double(time_ns)* 1e-9));
-	#endif
+/**************************************************************
+
+@brief The verify_agc_golden function checks SnrBlockAgc three ways.
+
+  - The *_21Mag test vectors, already at the LUT's signal
+    amplitude, go through as int8 and as sc16 and must stay within
+    +/-1 dB of their golden estimates without the AGC.  Every ISA
+    the CPU supports is forced in turn and must give the same AGC
+    output, byte for byte.
+  - Vectors with enough SNR for the AGC to measure their level (0 dB
+    and up on one dwell) go through as sc16 at 1/4 to 4 times their
+    recorded level, where there is headroom.  Each estimate must come
+    back within GOLDEN_AGC_LEVEL_BOUND of the one at the recorded
+    level.
+  - A loud and a quiet capture levelled as one batch (agc_captures,
+    as -c does) must give the quiet one the same output as levelling
+    it alone.
+
+@return bool true if every check passed
+
+**************************************************************/
+#define GOLDEN_AGC_LEVEL_BOUND  5  // tenths of a dB
+
+static const char *const golden_agc_level_vectors[][2] = {
+	{ "noisy_sym_IN_I_3dB_1100Samp.txt", "noisy_sym_IN_Q_3dB_1100Samp.txt" },
+	{ "noisy_sym_IN_I_6dB_1100Samp.txt", "noisy_sym_IN_Q_6dB_1100Samp.txt" },
+	{ "noisy_sym_IN_I_9dB_1100Samp.txt", "noisy_sym_IN_Q_9dB_1100Samp.txt" },
+	{ "noisy_sym_IN_I_highSNR_freqOffset_4096Samp_pilots.txt", "noisy_sym_IN_Q_highSNR_freqOffset_4096Samp_pilots.txt" },
+};
+
+bool verify_agc_golden()
+{
+	const cordic_isa_t default_isa = cordic_batch_isa();
+	const cordic_isa_t isas[] = { CORDIC_ISA_SCALAR, CORDIC_ISA_AVX2, CORDIC_ISA_AVX512 };
+	int num_vectors = sizeof(golden_vectors)/sizeof(golden_vectors[0]);
+	bool all_match = true;
+
+	for (int v = 0; v < num_vectors; v++) {
+		const golden_vector_t *g = &golden_vectors[v];
+		if (strstr(g->file_I, "_21Mag") == NULL)
+			continue;
+		Capture capture;
+		if (capture.load(g->file_I, g->file_Q) < 0) {
+			all_match = false;
+			continue;
+		}
+		int n = capture.num_samples;
+		std::vector<short> I16(n), Q16(n);
+		for (int i = 0; i < n; i++) {
+			I16[i] = (short)(capture.I[i] * 256);
+			Q16[i] = (short)(capture.Q[i] * 256);
+		}
+
+		bool match = true;
+		std::vector<char> first_out;  // the first ISA's output, I then Q, int8 then sc16
+		for (unsigned int k = 0; k < sizeof(isas)/sizeof(isas[0]); k++) {
+			if (!cordic_batch_force_isa(isas[k]))
+				continue;
+			std::vector<char> out(4*n);
+			SnrBlockAgc agc8, agc16;
+			agc8.process(capture.I, capture.Q, &out[0], &out[n], n);
+			agc16.process(I16.data(), Q16.data(), &out[2*n], &out[3*n], n);
+			if (first_out.empty())
+				first_out = out;
+			else if (out != first_out)
+				match = false;
+		}
+
+		for (int w = 0; w < 2; w++) {
+			SnrEngine engine;
+			snr_estimate_t est[GOLDEN_MAX_EST+1];
+			engine.push(&first_out[2*w*n], &first_out[(2*w+1)*n], n);
+			int num_est = (int)engine.poll(est, GOLDEN_MAX_EST+1);
+			if (num_est != g->num_estimates)
+				match = false;
+			for (int i = 0; match && i < num_est; i++) {
+				if (abs(est[i].snr_est - g->snr_est[i]) > 10)
+					match = false;
+			}
+		}
+		printf("AGC %s %s\n", match ? "PASSED" : "FAILED", g->file_I);
+		if (!match)
+			all_match = false;
+	}
+	cordic_batch_force_isa(default_isa);
+
+	const double level_scales[] = { 0.25, 0.5, 2, 4 };
+	int num_level_vectors = sizeof(golden_agc_level_vectors)/sizeof(golden_agc_level_vectors[0]);
+	for (int v = 0; v < num_level_vectors; v++) {
+		Capture capture;
+		if (capture.load(golden_agc_level_vectors[v][0], golden_agc_level_vectors[v][1]) < 0) {
+			all_match = false;
+			continue;
+		}
+		int n = capture.num_samples;
+		int peak = 0;
+		for (int i = 0; i < n; i++)
+			peak = std::max(peak, std::max(abs(capture.I[i]), abs(capture.Q[i])));
+
+		std::vector<short> I16(n), Q16(n);
+		for (int i = 0; i < n; i++) {
+			I16[i] = (short)(capture.I[i] * 256);
+			Q16[i] = (short)(capture.Q[i] * 256);
+		}
+		std::vector<short> ref = agc_estimates(I16.data(), Q16.data(), n);
+
+		bool match = !ref.empty();
+		for (unsigned int k = 0; k < sizeof(level_scales)/sizeof(level_scales[0]); k++) {
+			double scale = 256 * level_scales[k];
+			if (peak * scale > SHRT_MAX)
+				continue;  // no headroom in sc16
+			for (int i = 0; i < n; i++) {
+				I16[i] = (short)lround(capture.I[i] * scale);
+				Q16[i] = (short)lround(capture.Q[i] * scale);
+			}
+			std::vector<short> est = agc_estimates(I16.data(), Q16.data(), n);
+			if (est.size() != ref.size())
+				match = false;
+			for (size_t i = 0; match && i < est.size(); i++) {
+				if (abs(est[i] - ref[i]) > GOLDEN_AGC_LEVEL_BOUND)
+					match = false;
+			}
+		}
+		printf("AGC levelling %s %s\n", match ? "PASSED" : "FAILED", golden_agc_level_vectors[v][0]);
+		if (!match)
+			all_match = false;
+	}
+
+	// A quiet capture after a loud one in the same batch
+	Capture loud, quiet;
+	bool batch_match = loud.load(golden_agc_level_vectors[2][0], golden_agc_level_vectors[2][1]) == 0 &&
+		quiet.load("noisy_sym_IN_I_minus10dB_1100Samp_21Mag.txt", "noisy_sym_IN_Q_minus10dB_1100Samp_21Mag.txt") == 0;
+	if (batch_match) {
+		unsigned int capture_offsets[3] = { 0, (unsigned int)loud.num_samples,
+			(unsigned int)(loud.num_samples + quiet.num_samples) };
+		std::vector<char> batch_I(loud.I, loud.I + loud.num_samples), batch_Q(loud.Q, loud.Q + loud.num_samples);
+		batch_I.insert(batch_I.end(), quiet.I, quiet.I + quiet.num_samples);
+		batch_Q.insert(batch_Q.end(), quiet.Q, quiet.Q + quiet.num_samples);
+		SnrBlockAgc agc;
+		agc_captures(agc, batch_I.data(), batch_Q.data(), capture_offsets, 2);
+
+		std::vector<char> alone_I(quiet.num_samples), alone_Q(quiet.num_samples);
+		SnrBlockAgc alone;
+		alone.process(quiet.I, quiet.Q, alone_I.data(), alone_Q.data(), quiet.num_samples);
+		batch_match = std::equal(alone_I.begin(), alone_I.end(), batch_I.begin() + capture_offsets[1]) &&
+			std::equal(alone_Q.begin(), alone_Q.end(), batch_Q.begin() + capture_offsets[1]);
+	}
+	printf("AGC batch %s\n", batch_match ? "PASSED" : "FAILED");
+	if (!batch_match)
+		all_match = false;
+
+	printf("AGC golden check: %s\n", all_match ? "PASSED" : "FAILED");
+	return all_match;
 }
 
+/**************************************************************
 
-/*********************************************************
+@brief The run_daemon_job function sends the loaded test vector
+to a daemon started with -d as a one capture job, puts the
+estimates in capture.snr_est and prints the round trip time.  The
+job is sent twice on the same connection: the first round trip
+includes the daemon allocating its job buffers, the second is the
+steady state dispatch latency.
 
-@brief Free the resources allocated during initialization
+@param socket_path the daemon's Unix socket
+@return int the number of estimates, or -1 on error
 
-@return void
-*********************************************************/
-void cleanup() {
+**************************************************************/
+int run_daemon_job(const char *socket_path, Capture &capture)
+{
+	int fd = snr_daemon_connect(socket_path);
+	if (fd < 0) {
+		printf("ERROR: No daemon on %s\n", socket_path);
+		return -1;
+	}
 
-	for (int i = 0; i<K_NUM_KERNELS; ++i) {
-		if (kernel[i])
-			clReleaseKernel(kernel[i]);
+	unsigned int capture_offsets[2] = { 0, (unsigned int)capture.num_samples };
+	int num_est = -1;
+	double seconds = 0;
+	for (int rep = 0; rep < 2; rep++) {
+		const double start_time = getCurrentTimestamp();
+		num_est = snr_daemon_request(fd, capture.I, capture.Q, capture_offsets, 1, capture.snr_est);
+		seconds = getCurrentTimestamp() - start_time;
+		if (num_est < 0)
+			break;
 	}
-	for (int i = 0; i<K_NUM_KERNELS; ++i) {
-		if (queue[i])
-			clReleaseCommandQueue(queue[i]);
+	close(fd);
+
+	if (num_est < 0) {
+		printf("ERROR: Daemon job failed\n");
+		return -1;
 	}
-	
-	if (input_noisy_message_I_buf && input_noisy_message_I_buf) {
-		clReleaseMemObject(input_noisy_message_I_buf);
+	printf("Daemon on %s: %d estimates, %0.3f ms round trip\n", socket_path, num_est, seconds * 1e3);
+	return num_est;
+}
+
+
+/**************************************************************
+
+@brief The report_name function turns a manifest file name into
+a report field: a JSON string body with quotes, backslashes and
+control characters escaped, or a CSV field in double quotes with
+embedded quotes doubled.
+
+@param name the file name as listed in the manifest
+@param json true for a JSON line, false for a CSV row
+@return std::string the field, ready to print
+
+**************************************************************/
+static std::string report_name(const std::string &name, bool json)
+{
+	std::string field = json ? "" : "\"";
+	for (size_t i = 0; i < name.size(); i++) {
+		unsigned char ch = name[i];
+		if (!json) {
+			if (ch == '"')
+				field += '"';
+			field += ch;
+		} else if (ch == '"' || ch == '\\') {
+			field += '\\';
+			field += ch;
+		} else if (ch < 0x20) {
+			char esc[8];
+			snprintf(esc, sizeof(esc), "\\u%04x", ch);
+			field += esc;
+		} else {
+			field += ch;
+		}
 	}
-	
-	if (input_noisy_message_Q_buf && input_noisy_message_Q_buf) {
-		clReleaseMemObject(input_noisy_message_Q_buf);
+	if (!json)
+		field += '"';
+	return field;
+}
+
+
+/**************************************************************
+
+@brief The run_capture_list function packs every capture listed
+in the manifest list_file into one batch, estimates it with a
+single run_batch call and reports each frame.  Each manifest line
+is
+
+    I_file Q_file [expected_snr_dB]
+
+and blank lines and lines starting with # are skipped.  With -o
+every frame is also written to report_file as a CSV row, or as a
+JSON line if the name ends in .json.
+
+@param backend the initialized backend
+@param list_file the manifest
+@return int 0 on success, otherwise -1
+
+**************************************************************/
+int run_capture_list(SnrBackend *backend, const char *list_file)
+{
+	FILE* file = fopen(list_file, "rt");
+	if (file == NULL) {
+		printf("File %s could not be opened\n", list_file);
+		return -1;
 	}
-	
-	if (output_buf && output_buf) {
-		clReleaseMemObject(output_buf);
+
+	std::vector<std::string> names;
+	std::vector<double> expected_snr;
+	std::vector<char> batch_I, batch_Q;
+	std::vector<unsigned int> capture_offsets(1, 0);
+	char line[1024], file_I[256], file_Q[256];
+	while (fgets(line, sizeof(line), file)) {
+		double expected = NAN;
+		int num_fields = sscanf(line, "%255s %255s %lf", file_I, file_Q, &expected);
+		if (num_fields <= 0 || file_I[0] == '#')
+			continue;
+		if (num_fields < 2 ||
+			append_test_vector_file_char(file_I, batch_I) < 0 ||
+			append_test_vector_file_char(file_Q, batch_Q) < 0 ||
+			batch_I.size() != batch_Q.size()) {
+			printf("ERROR: Bad capture line: %s", line);
+			fclose(file);
+			return -1;
+		}
+		// Empty captures have nothing to estimate
+		if (batch_I.size() > capture_offsets.back()) {
+			names.push_back(file_I);
+			expected_snr.push_back(expected);
+			capture_offsets.push_back(batch_I.size());
+		}
+	}
+	fclose(file);
+
+	unsigned int num_captures = names.size();
+	if (num_captures == 0) {
+		printf("ERROR: No captures in %s\n", list_file);
+		return -1;
+	}
+
+	// Aligned copies so the OpenCL runtime can DMA straight from them
+	unsigned int num_samples = capture_offsets[num_captures];
+	char *dataIn_I = (char *)alignedMalloc(num_samples);
+	char *dataIn_Q = (char *)alignedMalloc(num_samples);
+	memcpy(dataIn_I, batch_I.data(), num_samples);
+	memcpy(dataIn_Q, batch_Q.data(), num_samples);
+	if (agc_target > 0) {
+		// Per capture, so each starts its first block on its first dwell and
+		// from unity gain, as a -r run of the same file would
+		SnrBlockAgc agc(agc_target);
+		agc_captures(agc, dataIn_I, dataIn_Q, capture_offsets.data(), num_captures);
+	}
+	std::vector<unsigned int> est_offsets(num_captures+1);
+	unsigned int num_estimates = snr_batch_est_offsets(capture_offsets.data(), num_captures, est_offsets.data());
+	short *snr_est = (short *)alignedMalloc((num_estimates+1)*sizeof(short));
+
+	bool ok = backend->run_batch(dataIn_I, dataIn_Q, capture_offsets.data(), num_captures, snr_est);
+	if (ok) {
+		for (unsigned int c = 0; c < num_captures; c++) {
+			printf("%s: %u samples,", names[c].c_str(), capture_offsets[c+1] - capture_offsets[c]);
+			for (unsigned int i = est_offsets[c]; i < est_offsets[c+1]; i++)
+				printf(" %0.1f", (double)snr_est[i]/10);
+			printf("\n");
+		}
+		printf("Backend %s: %u captures in %0.3f ms, %0.3f Msamples/s\n", backend->name(), num_captures,
+			backend->run_seconds() * 1e3, backend->throughput() * 1e-6);
+	} else {
+		printf("ERROR: Backend %s failed\n", backend->name());
+	}
+
+	if (ok && report_file) {
+		FILE* report = fopen(report_file, "wt");
+		if (report == NULL) {
+			printf("File %s could not be opened\n", report_file);
+			ok = false;
+		} else {
+			size_t len = strlen(report_file);
+			bool json = len >= 5 && strcmp(report_file + len - 5, ".json") == 0;
+			if (!json)
+				fprintf(report, "capture,file_I,frame,snr_est_dB,expected_dB,error_dB,backend,Msamples_per_s\n");
+			for (unsigned int c = 0; c < num_captures; c++) {
+				std::string name = report_name(names[c], json);
+				for (unsigned int i = est_offsets[c]; i < est_offsets[c+1]; i++) {
+					double est = (double)snr_est[i]/10;
+					double error = est - expected_snr[c];
+					// JSON has no NaN, so a capture without an expected SNR gets nulls
+					if (json && std::isnan(expected_snr[c]))
+						fprintf(report, "{\"capture\":%u,\"file_I\":\"%s\",\"frame\":%u,\"snr_est_dB\":%0.1f,"
+							"\"expected_dB\":null,\"error_dB\":null,\"backend\":\"%s\",\"Msamples_per_s\":%0.3f}\n",
+							c, name.c_str(), i - est_offsets[c], est, backend->name(), backend->throughput() * 1e-6);
+					else if (json)
+						fprintf(report, "{\"capture\":%u,\"file_I\":\"%s\",\"frame\":%u,\"snr_est_dB\":%0.1f,"
+							"\"expected_dB\":%g,\"error_dB\":%0.1f,\"backend\":\"%s\",\"Msamples_per_s\":%0.3f}\n",
+							c, name.c_str(), i - est_offsets[c], est, expected_snr[c], error,
+							backend->name(), backend->throughput() * 1e-6);
+					else
+						fprintf(report, "%u,%s,%u,%0.1f,%g,%0.1f,%s,%0.3f\n", c, name.c_str(), i - est_offsets[c],
+							est, expected_snr[c], error, backend->name(), backend->throughput() * 1e-6);
+				}
+			}
+			fclose(report);
+			printf("Wrote %u frames to %s\n", num_estimates, report_file);
+		}
+	}
+
+	alignedFree(dataIn_I);
+	alignedFree(dataIn_Q);
+	alignedFree(snr_est);
+	return ok ? 0 : -1;
+}
+
+
+/*************************************************************************
+
+@brief The run_stream function estimates a binary capture of any length
+with constant memory.  The capture is memory-mapped (IqStreamReader), or
+with -u read ahead through io_uring (IqAsyncReader), and handed to the
+backend one IQ_STREAM_CHUNK at a time; the chunks are whole dwells, so
+the estimates are the same as for one run over the whole capture.  With
+-o each chunk's estimates are written out as they come, otherwise only
+a summary is printed.  With -H the chunks go through one native engine
+in hop mode instead, which carries its sliding sums across chunk
+boundaries and reports every hop_length samples.  With -w they go
+through the native multi window engine, and each frame of the report
+also gives its dwell length.  With -p the native engine runs in
+sequential mode and skips what is left of each dwell once its estimate
+is out.  With -k the native decimated engine estimates each dwell from
+one sample in decimation.
+
+@param backend initialized backend
+@param stream_spec "iq_file" (interleaved) or "I_file,Q_file" (planar)
+@return int 0 on success, -1 on error
+
+**************************************************************************/
+template <class Reader>
+static int stream_capture(SnrBackend *backend, const char *stream_spec, Reader &reader)
+{
+	std::string spec(stream_spec);
+	size_t comma = spec.find(',');
+	bool opened = (comma == std::string::npos) ? reader.open(stream_spec) :
+		reader.open(spec.substr(0, comma).c_str(), spec.substr(comma+1).c_str());
+	if (!opened) {
+		printf("ERROR: Could not open capture %s\n", stream_spec);
+		return -1;
+	}
+
+	FILE *report = NULL;
+	bool json = false;
+	if (report_file) {
+		report = fopen(report_file, "wt");
+		if (report == NULL) {
+			printf("File %s could not be opened\n", report_file);
+			return -1;
+		}
+		size_t len = strlen(report_file);
+		json = len >= 5 && strcmp(report_file + len - 5, ".json") == 0;
+		if (!json)
+			fprintf(report, multi_window ? "frame,first_sample,dwell_length,snr_est_dB\n" :
+				"frame,first_sample,snr_est_dB\n");
+	}
+
+	short *snr_est = (short *)alignedMalloc((IQ_STREAM_CHUNK/SNR_DWELL_LENGTH + 1)*sizeof(short));
+	SnrBlockAgc agc(agc_target);
+	char *agc_I = NULL, *agc_Q = NULL;
+	if (agc_target > 0) {
+		agc_I = (char *)alignedMalloc(IQ_STREAM_CHUNK);
+		agc_Q = (char *)alignedMalloc(IQ_STREAM_CHUNK);
+	}
+	unsigned long long num_frames = 0;
+	double seconds = 0;
+	// Summary per window of the -w engine, only [0] otherwise
+	unsigned long long window_frames[SNR_NUM_WINDOWS] = {0};
+	double sum[SNR_NUM_WINDOWS] = {0};
+	short min_est[SNR_NUM_WINDOWS], max_est[SNR_NUM_WINDOWS];
+	std::fill(min_est, min_est + SNR_NUM_WINDOWS, SHRT_MAX);
+	std::fill(max_est, max_est + SNR_NUM_WINDOWS, SHRT_MIN);
+	bool ok = true;
+
+	// One line of the report per estimate
+	auto add_frame = [&](unsigned long long first_sample, short est, int window) {
+		window_frames[window]++;
+		sum[window] += est;
+		min_est[window] = std::min(min_est[window], est);
+		max_est[window] = std::max(max_est[window], est);
+		if (report && json && multi_window)
+			fprintf(report, "{\"frame\":%llu,\"first_sample\":%llu,\"dwell_length\":%u,\"snr_est_dB\":%0.1f}\n",
+				num_frames, first_sample, SnrWindowEngine::dwell_length(window), (double)est/10);
+		else if (report && json)
+			fprintf(report, "{\"frame\":%llu,\"first_sample\":%llu,\"snr_est_dB\":%0.1f}\n",
+				num_frames, first_sample, (double)est/10);
+		else if (report && multi_window)
+			fprintf(report, "%llu,%llu,%u,%0.1f\n", num_frames, first_sample,
+				SnrWindowEngine::dwell_length(window), (double)est/10);
+		else if (report)
+			fprintf(report, "%llu,%llu,%0.1f\n", num_frames, first_sample, (double)est/10);
+		num_frames++;
+	};
+
+	// With -H, -p or -w one engine runs on across chunk boundaries
+	SnrEngine native_engine(hop_length, seq_precision);
+	bool native = hop_length || seq_precision > 0;
+	unsigned long long latency_sum = 0;
+	SnrWindowEngine window_engine;
+	SnrDecimatedEngine decim_engine(decimation, decimation_random);
+	snr_estimate_t engine_est[64];
+
+	iq_view_t view;
+	while (ok && reader.next(&view)) {
+		unsigned int n = view.num_samples / SNR_DWELL_LENGTH;
+		size_t num_samples = (native || multi_window || decimation > 1) ? view.num_samples : n * SNR_DWELL_LENGTH;
+		if (num_samples == 0)
+			break;  // a trailing partial dwell has no estimate
+		if (agc_I) {
+			agc.process(view.I, view.Q, agc_I, agc_Q, num_samples);
+			view.I = agc_I;
+			view.Q = agc_Q;
+		}
+		if (native) {
+			const double start_time = getCurrentTimestamp();
+			native_engine.push(view.I, view.Q, num_samples);
+			seconds += getCurrentTimestamp() - start_time;
+			for (size_t k = native_engine.poll(engine_est, 64); k > 0; k = native_engine.poll(engine_est, 64)) {
+				for (size_t i = 0; i < k; i++) {
+					// a sequential estimate belongs to the dwell it came out in
+					unsigned long long first_sample = hop_length ? engine_est[i].sample_ind + 1 - SNR_DWELL_LENGTH :
+						engine_est[i].sample_ind - engine_est[i].sample_ind % SNR_DWELL_LENGTH;
+					latency_sum += engine_est[i].sample_ind + 1 - first_sample;
+					add_frame(first_sample, engine_est[i].snr_est, 0);
+				}
+			}
+			continue;
+		}
+		if (decimation > 1) {
+			const double start_time = getCurrentTimestamp();
+			decim_engine.push(view.I, view.Q, num_samples);
+			seconds += getCurrentTimestamp() - start_time;
+			for (size_t k = decim_engine.poll(engine_est, 64); k > 0; k = decim_engine.poll(engine_est, 64)) {
+				for (size_t i = 0; i < k; i++)
+					add_frame(engine_est[i].sample_ind - engine_est[i].sample_ind % SNR_DWELL_LENGTH, engine_est[i].snr_est, 0);
+			}
+			continue;
+		}
+		if (multi_window) {
+			const double start_time = getCurrentTimestamp();
+			window_engine.push(view.I, view.Q, num_samples);
+			seconds += getCurrentTimestamp() - start_time;
+			for (int w = 0; w < SNR_NUM_WINDOWS; w++) {
+				for (size_t k = window_engine.poll(w, engine_est, 64); k > 0; k = window_engine.poll(w, engine_est, 64)) {
+					for (size_t i = 0; i < k; i++)
+						add_frame(engine_est[i].sample_ind + 1 - SnrWindowEngine::dwell_length(w), engine_est[i].snr_est, w);
+				}
+			}
+			continue;
+		}
+		ok = backend->run(view.I, view.Q, num_samples, snr_est);
+		seconds += backend->run_seconds();
+		for (unsigned int i = 0; ok && i < n; i++)
+			add_frame(num_frames * SNR_DWELL_LENGTH, snr_est[i], 0);
+	}
+	alignedFree(snr_est);
+	if (agc_I) {
+		alignedFree(agc_I);
+		alignedFree(agc_Q);
+	}
+	if (report)
+		fclose(report);
+
+	if (!ok) {
+		printf("ERROR: Backend %s failed\n", backend->name());
+		return -1;
+	}
+	printf("%s: %llu samples (%s), %llu frames", stream_spec, reader.num_samples(),
+		reader.interleaved() ? "interleaved" : "planar", num_frames);
+	if (hop_length)
+		printf(" every %u samples", hop_length);
+	if (num_frames > 0 && !multi_window)
+		printf(", SNR est %0.1f/%0.1f/%0.1f dB min/mean/max", (double)min_est[0]/10, sum[0]/num_frames/10, (double)max_est[0]/10);
+	printf("\n");
+	for (int w = 0; multi_window && w < SNR_NUM_WINDOWS; w++) {
+		printf("  %4u sample dwells: %llu frames", SnrWindowEngine::dwell_length(w), window_frames[w]);
+		if (window_frames[w] > 0)
+			printf(", SNR est %0.1f/%0.1f/%0.1f dB min/mean/max", (double)min_est[w]/10,
+				sum[w]/window_frames[w]/10, (double)max_est[w]/10);
+		printf("\n");
+	}
+	if (native)
+		printf("Native engine: %0.3f ms, %0.3f Msamples/s\n", seconds * 1e3,
+			seconds > 0 ? native_engine.samples_pushed() / seconds * 1e-6 : 0);
+	else if (decimation > 1)
+		printf("Native decimated engine: %0.3f ms, %0.3f Msamples/s, %llu of %llu samples used (within %0.1f dB of the full dwell on the test vectors)\n",
+			seconds * 1e3, seconds > 0 ? decim_engine.samples_pushed() / seconds * 1e-6 : 0,
+			decim_engine.samples_used(), decim_engine.samples_pushed(), SnrDecimatedEngine::accuracy_bound(decimation) / 10.0);
+	else if (multi_window)
+		printf("Native multi window engine: %0.3f ms, %0.3f Msamples/s\n", seconds * 1e3,
+			seconds > 0 ? window_engine.samples_pushed() / seconds * 1e-6 : 0);
+	else
+		printf("Backend %s: %0.3f ms, %0.3f Msamples/s\n", backend->name(), seconds * 1e3,
+			seconds > 0 ? num_frames * SNR_DWELL_LENGTH / seconds * 1e-6 : 0);
+	if (seq_precision > 0 && !hop_length && num_frames > 0)
+		printf("Sequential: %0.1f samples per estimate, %llu of %llu samples skipped\n",
+			(double)latency_sum/num_frames, native_engine.samples_skipped(), native_engine.samples_pushed());
+	if (agc_I)
+		printf("AGC: %llu values clipped\n", agc.clipped());
+	if (report)
+		printf("Wrote %llu frames to %s\n", num_frames, report_file);
+	return 0;
+}
+
+int run_stream(SnrBackend *backend, const char *stream_spec)
+{
+	if (uring_ingest) {
+		IqAsyncReader reader;
+		if (!reader.uring())
+			printf("io_uring unavailable, reading with pread\n");
+		return stream_capture(backend, stream_spec, reader);
+	}
+	IqStreamReader reader;
+	return stream_capture(backend, stream_spec, reader);
+}
+
+
+/*************************************************************************
+
+@brief The benchmark_transfer_modes function runs the loaded test
+vector through OpenCL num_reps times with copies (run) and num_reps
+times in place (run_zero_copy), checks both give the same estimates
+and prints the mean time of each.  On the emulator this measures the
+host side cost of the copies; on a SoC board it is the real saving.
+
+@param num_reps runs per mode
+@return int 0 if both modes ran and agreed
+
+**************************************************************************/
+int benchmark_transfer_modes(int num_reps, Capture &capture)
+{
+	OpenClSession session(device_kernel, ptype == EMULATION_PLAT);
+	if (!session.init())
+		return -1;
+
+	short *copy_est = (short *)alignedMalloc((capture.num_output_frames+1)*sizeof(short));
+	double seconds[2] = { 0, 0 };
+
+	for (int r = 0; r < num_reps; r++) {
+		seconds[0] += session.run(capture.I, capture.Q, capture.num_samples, copy_est);
+		seconds[1] += session.run_zero_copy(capture.I, capture.Q, capture.num_samples, capture.snr_est);
 	}
-	if (program) {
-		clReleaseProgram(program);
+	printf("\n");
+
+	bool match = memcmp(copy_est, capture.snr_est, capture.num_output_frames*sizeof(short)) == 0;
+	alignedFree(copy_est);
+
+	const char *mode_names[2] = { "copy", "zero-copy" };
+	for (int m = 0; m < 2; m++) {
+		double mean = seconds[m] / num_reps;
+		printf("%-10s %d runs: %0.3f ms mean, %0.3f Msamples/s\n", mode_names[m], num_reps,
+			mean * 1e3, capture.num_samples / mean * 1e-6);
 	}
-	if (context) {
-		clReleaseContext(context);
+	printf("Estimates %s\n", match ? "match" : "DIFFER");
+
+	return match ? 0 : -1;
+}
+
+
+/*************************************************************************
+
+@brief The init_backend function makes and initializes the backend
+selected with -b.  "auto" uses OpenCL when a platform can be
+initialized and the native engine on all cores otherwise.
+
+@param name the backend name
+@return SnrBackend* NULL if the name is unknown or it failed to initialize
+
+**************************************************************************/
+SnrBackend *init_backend(const char *name)
+{
+	bool fallback = strcmp(name, "auto") == 0;
+	SnrBackend *backend;
+
+	if (fallback || strcmp(name, "opencl") == 0)
+		backend = create_opencl_backend(device_kernel, ptype == EMULATION_PLAT, zero_copy);
+	else
+		backend = create_native_backend(name);
+	if (backend == NULL) {
+		printf("ERROR: Unknown backend %s\n", name);
+		return NULL;
+	}
+
+	if (!backend->init()) {
+		delete backend;
+		if (!fallback)
+			return NULL;
+		printf("No OpenCL platform, falling back to the cpu backend\n");
+		backend = create_native_backend("cpu");
+		backend->init();
 	}
+	return backend;
+}
+
+
+
+/*************************************************************************
+
+@brief The run_backend_mode function runs one of the modes that own the
+whole run (-d, -c, -r) on the backend selected with -b, and releases the
+backend when it returns.  device_kernel must already be set.
+
+@param mode the mode, called with the backend and arg
+@param arg the mode's option argument
+@return int the exit status: 0 if the mode succeeded, 1 if it failed,
+-1 if the backend did not initialize
+
+**************************************************************************/
+int run_backend_mode(int (*mode)(SnrBackend *, const char *), const char *arg)
+{
+	SnrBackend *backend = init_backend(backend_name);
+	if (backend == NULL)
+		return -1;
+	int status = mode(backend, arg);
+	delete backend;
+	return status == 0 ? 0 : 1;
+}
+
+/*********************************************************
+
+@brief checkError calls cleanup before it exits.  Every
+OpenCL object belongs to an OpenClSession, which releases
+it in its destructor, and the runtime frees whatever is
+still held when the process exits.
+
+@return void
+*********************************************************/
+void cleanup() {
 }
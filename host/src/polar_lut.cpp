@@ -0,0 +1,12 @@
+/******************************************************************************
+*  @file    polar_lut.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Host copy of the generated char I/Q magnitude and phase tables.
+*
+*******************************************************************************/
+
+#include "cl_compat.h"
+#include "polar_lut_host.h"   // declares the tables extern so they link from here
+#include "../../device/polar_tables_int8.h"
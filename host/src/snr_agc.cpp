@@ -0,0 +1,303 @@
+/******************************************************************************
+*  @file    snr_agc.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Block AGC that brings any input level to the operating point of
+*  SNR_estimator_LUT_coefficients_AGC_at_21.h.
+*
+*  @section DESCRIPTION
+*
+*  Two passes over each block while it is in L1:
+*
+*    power   sum of I^2+Q^2, squares in 32 bit lanes (at most 2^31 for
+*            sc16) summed into 64 bit lanes, so the sum is exact in any order
+*    apply   (x*gain_q + 2^(shift-1)) >> shift, then clamp to int8.  gain_q
+*            is at most 2^15 and |x| at most 2^15, so this fits in 32 bits.
+*
+*  fc32 is first rounded to the sc16 range with snr_sample<float>, a block
+*  at a time.
+*
+*  The gain is set from moments smoothed over SNR_AGC_SPAN blocks: the
+*  signal part of a single dwell is too noisy to level low SNR input by.
+*
+*******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "cordic_batch.h"
+#include "snr_agc.h"
+
+#define AGC_GAIN_BITS  15
+#define AGC_MAX_SHIFT  30  // keeps x*gain_q + rounding below 2^31
+#define AGC_MIN_SIGNIFICANCE 4.0  // standard errors the signal power must clear to set the gain
+
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+#define LANES_INLINE static inline __attribute__((always_inline))
+
+
+// Vector types for W samples at a time.  The int8 lanes are signed char,
+// a vector of plain char is converted a byte at a time.  VUH and VUL hold
+// half the lanes, so 64 bit sums stay within one register.
+#define DEFINE_LANES(name, W) \
+	struct name { \
+		enum { width = W }; \
+		typedef int VI __attribute__((vector_size(W*4))); \
+		typedef unsigned int VU __attribute__((vector_size(W*4))); \
+		typedef unsigned int VUH __attribute__((vector_size(W*2))); \
+		typedef unsigned long long VUL __attribute__((vector_size(W*4))); \
+		typedef signed char VC __attribute__((vector_size(W))); \
+		typedef short VS __attribute__((vector_size(W*2))); \
+	};
+
+DEFINE_LANES(lanes4, 4)
+DEFINE_LANES(lanes8, 8)
+DEFINE_LANES(lanes16, 16)
+
+template<typename L, typename T> struct input_vec;
+template<typename L> struct input_vec<L, char>  { typedef typename L::VC V; };
+template<typename L> struct input_vec<L, short> { typedef typename L::VS V; };
+
+// int8 is widened through 16 bits: GCC 12 takes bytes straight to 32 bit
+// lanes one at a time, but 8->16 and 16->32 each map to pmovsx
+template<typename L, typename T> LANES_INLINE typename L::VI load_lanes(const T *p)
+{
+	typename input_vec<L, T>::V v;
+	memcpy(&v, p, sizeof(v));
+	return __builtin_convertvector(__builtin_convertvector(v, typename L::VS), typename L::VI);
+}
+
+
+//**********************************************
+// Lane-width independent passes
+//**********************************************
+// Sums of |r|^2 and (|r|^2 >> moment_shift)^2
+typedef struct agc_moments_t {
+	unsigned long long m2;
+	unsigned long long m4;
+} agc_moments_t;
+
+template<typename T> struct moment_shift;
+template<> struct moment_shift<char>  { enum { bits = 0 }; };  // |r|^4 <= 2^30
+template<> struct moment_shift<short> { enum { bits = 8 }; };  // (|r|^2>>8)^2 <= 2^46
+
+template<typename T> LANES_INLINE void moments_scalar(const T *I, const T *Q, size_t n, agc_moments_t *m)
+{
+	for (size_t i = 0; i < n; i++) {
+		unsigned int sq = (unsigned int)(I[i]*I[i]) + (unsigned int)(Q[i]*Q[i]);
+		unsigned long long sqs = sq >> moment_shift<T>::bits;
+		m->m2 += sq;
+		m->m4 += sqs*sqs;
+	}
+}
+
+template<typename L, typename T> LANES_INLINE agc_moments_t moments_lanes(const T *I, const T *Q, size_t n)
+{
+	typedef typename L::VI VI;
+	typedef typename L::VU VU;
+	typedef typename L::VUH VUH;
+	typedef typename L::VUL VUL;
+
+	VUL m2 = VUL{};
+	VUL m4 = VUL{};
+	size_t i = 0;
+	for (; i + L::width <= n; i += L::width) {
+		VI x = load_lanes<L>(I + i);
+		VI y = load_lanes<L>(Q + i);
+		VU sq = (VU)(x*x) + (VU)(y*y);
+		VU sqs = sq >> (unsigned int)moment_shift<T>::bits;
+		for (int h = 0; h < 2; h++) {
+			VUH half, halfs;
+			memcpy(&half, (const char *)&sq + h*sizeof(half), sizeof(half));
+			memcpy(&halfs, (const char *)&sqs + h*sizeof(halfs), sizeof(halfs));
+			VUL wide = __builtin_convertvector(halfs, VUL);
+			m2 += __builtin_convertvector(half, VUL);
+			m4 += wide*wide;
+		}
+	}
+	agc_moments_t m = { 0, 0 };
+	moments_scalar(I + i, Q + i, n - i, &m);
+	for (int k = 0; k < L::width/2; k++) {
+		m.m2 += m2[k];
+		m.m4 += m4[k];
+	}
+	return m;
+}
+
+template<typename T> LANES_INLINE unsigned long long apply_scalar(const T *in, char *out, size_t n, int gain_q, int shift)
+{
+	unsigned long long clipped = 0;
+	for (size_t i = 0; i < n; i++) {
+		int v = (in[i]*gain_q + (1 << (shift-1))) >> shift;
+		if (v > 127) { v = 127; clipped++; }
+		if (v < -128) { v = -128; clipped++; }
+		out[i] = (char)v;
+	}
+	return clipped;
+}
+
+template<typename L, typename T> LANES_INLINE unsigned long long apply_lanes(const T *in, char *out, size_t n, int gain_q, int shift)
+{
+	typedef typename L::VI VI;
+	typedef typename L::VC VC;
+
+	VI clipped = VI{};
+	size_t i = 0;
+	for (; i + L::width <= n; i += L::width) {
+		VI v = (load_lanes<L>(in + i) * gain_q + (1 << (shift-1))) >> shift;
+		VI hi = (127 - v) >> 31;   // sign masks, like cordic_batch.cpp: vector
+		VI lo = (v + 128) >> 31;   // compares here would be lowered per lane
+		v = (v & ~(hi | lo)) | (hi & 127) | (lo & -128);
+		clipped -= hi | lo;
+		VC c = __builtin_convertvector(__builtin_convertvector(v, typename L::VS), VC);
+		memcpy(out + i, &c, sizeof(c));
+	}
+	unsigned long long total = apply_scalar(in + i, out + i, n - i, gain_q, shift);
+	for (int k = 0; k < L::width; k++)
+		total += clipped[k];
+	return total;
+}
+
+
+#define DEFINE_PASSES(suffix, target_attr, L) \
+	template<typename T> target_attr \
+	static agc_moments_t moments_##suffix(const T *I, const T *Q, size_t n) \
+	{ \
+		return moments_lanes<L>(I, Q, n); \
+	} \
+	template<typename T> target_attr \
+	static unsigned long long apply_##suffix(const T *in, char *out, size_t n, int gain_q, int shift) \
+	{ \
+		return apply_lanes<L>(in, out, n, gain_q, shift); \
+	}
+
+// 4 lanes is SSE2 on x86, and whatever vectors GCC finds elsewhere
+#ifdef CORDIC_BATCH_X86
+DEFINE_PASSES(base, __attribute__((target("sse2"))), lanes4)
+DEFINE_PASSES(avx2, __attribute__((target("avx2"))), lanes8)
+DEFINE_PASSES(avx512, __attribute__((target("avx512f,avx512bw"))), lanes16)
+#else
+DEFINE_PASSES(base, , lanes4)
+#endif
+
+template<typename T> static agc_moments_t block_moments(const T *I, const T *Q, size_t n)
+{
+	switch (cordic_batch_isa()) {
+#ifdef CORDIC_BATCH_X86
+	case CORDIC_ISA_AVX512: return moments_avx512(I, Q, n);
+	case CORDIC_ISA_AVX2:   return moments_avx2(I, Q, n);
+#endif
+	default:                return moments_base(I, Q, n);
+	}
+}
+
+template<typename T> static unsigned long long block_apply(const T *in, char *out, size_t n, int gain_q, int shift)
+{
+	switch (cordic_batch_isa()) {
+#ifdef CORDIC_BATCH_X86
+	case CORDIC_ISA_AVX512: return apply_avx512(in, out, n, gain_q, shift);
+	case CORDIC_ISA_AVX2:   return apply_avx2(in, out, n, gain_q, shift);
+#endif
+	default:                return apply_base(in, out, n, gain_q, shift);
+	}
+}
+
+
+//**********************************************
+// SnrBlockAgc
+//**********************************************
+// Gain that leaves a sample at its int8 value: sc16 (and fc32, which comes
+// in as sc16) is int8 times 256, see snr_sample.h
+template<typename T> struct unity_gain;
+template<> struct unity_gain<char>  { static double value() { return 1; } };
+template<> struct unity_gain<short> { static double value() { return 1.0/256; } };
+
+SnrBlockAgc::SnrBlockAgc(float target_rms)
+	: target_rms(target_rms)
+{
+	reset();
+}
+
+void SnrBlockAgc::reset()
+{
+	gain = 1;
+	measured = false;
+	sum_m2 = 0;
+	sum_m4 = 0;
+	sum_n = 0;
+	num_clipped = 0;
+}
+
+template <typename T> void SnrBlockAgc::process_blocks(const T *I, const T *Q, char *out_I, char *out_Q, size_t n)
+{
+	const double decay = 1.0 - 1.0/SNR_AGC_SPAN;
+	if (!measured)
+		gain = unity_gain<T>::value();
+
+	for (size_t i = 0; i < n; i += SNR_AGC_BLOCK) {
+		size_t m = (n - i < SNR_AGC_BLOCK) ? n - i : SNR_AGC_BLOCK;
+		agc_moments_t moments = block_moments(I + i, Q + i, m);
+
+		// The moments of the last SNR_AGC_SPAN or so blocks, exponentially
+		// weighted.  sum_n is the sum of the weights.
+		sum_m2 = sum_m2*decay + (double)moments.m2;
+		sum_m4 = sum_m4*decay + (double)moments.m4 * (double)(1 << moment_shift<T>::bits) * (1 << moment_shift<T>::bits);
+		sum_n = sum_n*decay + (double)m;
+
+		// Signal power from M2 = S+N and M4 = S^2+4SN+2N^2 (constant modulus
+		// symbols in complex AWGN): S^2 = 2*M2^2 - M4.  With noise alone its
+		// standard error over n samples is 2*M2^2/sqrt(n), less with signal.
+		// Until S^2 clears AGC_MIN_SIGNIFICANCE of those the gain is held:
+		// at unity before the first measurement, so input that is already at
+		// the LUT's level is left alone rather than scaled on a guess.  An
+		// all zero block leaves it held as well.
+		double m2 = sum_m2 / sum_n;
+		double m4 = sum_m4 / sum_n;
+		double signal2 = 2*m2*m2 - m4;
+		if (m2 > 0 && signal2 >= AGC_MIN_SIGNIFICANCE * 2*m2*m2 / sqrt(sum_n)) {
+			gain = target_rms / sqrt(sqrt(signal2));
+			measured = true;
+		}
+
+		// gain = gain_q * 2^-shift with gain_q in [2^14, 2^15]
+		int exponent;
+		double mantissa = frexp(gain, &exponent);
+		int gain_q = (int)lround(mantissa * (1 << AGC_GAIN_BITS));
+		int shift = AGC_GAIN_BITS - exponent;
+		if (shift < 1) {
+			gain_q = 1 << AGC_GAIN_BITS;  // more than 2^14, nothing is that quiet
+			shift = 1;
+		}
+		if (shift > AGC_MAX_SHIFT) {
+			gain_q >>= shift - AGC_MAX_SHIFT;
+			shift = AGC_MAX_SHIFT;
+		}
+
+		num_clipped += block_apply(I + i, out_I + i, m, gain_q, shift);
+		num_clipped += block_apply(Q + i, out_Q + i, m, gain_q, shift);
+	}
+}
+
+void SnrBlockAgc::process(const char *I, const char *Q, char *out_I, char *out_Q, size_t n)
+{
+	process_blocks(I, Q, out_I, out_Q, n);
+}
+
+void SnrBlockAgc::process(const short *I, const short *Q, char *out_I, char *out_Q, size_t n)
+{
+	process_blocks(I, Q, out_I, out_Q, n);
+}
+
+void SnrBlockAgc::process(const float *I, const float *Q, char *out_I, char *out_Q, size_t n)
+{
+	short I16[SNR_AGC_BLOCK], Q16[SNR_AGC_BLOCK];
+	for (size_t i = 0; i < n; i += SNR_AGC_BLOCK) {
+		size_t m = (n - i < SNR_AGC_BLOCK) ? n - i : SNR_AGC_BLOCK;
+		for (size_t k = 0; k < m; k++) {
+			I16[k] = (short)snr_sample<float>::cordic_in(I[i+k]);
+			Q16[k] = (short)snr_sample<float>::cordic_in(Q[i+k]);
+		}
+		process_blocks(I16, Q16, out_I + i, out_Q + i, m);
+	}
+}
@@ -0,0 +1,167 @@
+/******************************************************************************
+*  @file    snr_backend_native.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief The backends that run without an OpenCL platform.
+*
+*  @section DESCRIPTION
+*
+*  sof resets the estimator at the start of every dwell, so each dwell's
+*  estimate only depends on that dwell's samples.  The cpu backend uses that
+*  to give each thread its own SnrEngine and a contiguous run of dwells.
+*
+*******************************************************************************/
+
+#include <string.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "snr_backend.h"
+#include "snr_engine.h"
+#include "snr_kernels_emu.h"
+
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+class CpuBackend : public SnrBackend {
+public:
+	const char *name() const { return "cpu"; }
+
+	bool init()
+	{
+		num_threads = std::thread::hardware_concurrency();
+		if (num_threads == 0)
+			num_threads = 1;
+		return true;
+	}
+
+	bool run(const char *dataIn_I, const char *dataIn_Q, int num_samples, short *snr_est_out)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		int num_frames = num_samples / SNR_DWELL_LENGTH;
+		int threads = num_frames < (int)num_threads ? num_frames : (int)num_threads;
+
+		std::vector<std::thread> workers;
+		for (int t = 0; t < threads; t++) {
+			int first = (int)((long long)num_frames * t / threads);
+			int last = (int)((long long)num_frames * (t+1) / threads);
+			workers.push_back(std::thread(estimate_frames, dataIn_I, dataIn_Q, first, last, snr_est_out));
+		}
+		for (size_t t = 0; t < workers.size(); t++)
+			workers[t].join();
+
+		last_samples = num_samples;
+		last_seconds = seconds_since(start);
+		return true;
+	}
+
+	// Every dwell of every capture is independent, so split them all across the threads
+	bool run_batch(const char *dataIn_I, const char *dataIn_Q,
+		const unsigned int *capture_offsets, unsigned int num_captures, short *snr_est_out)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::vector<unsigned int> dwell_start;
+		for (unsigned int c = 0; c < num_captures; c++) {
+			for (unsigned int i = capture_offsets[c]; i + SNR_DWELL_LENGTH <= capture_offsets[c+1]; i += SNR_DWELL_LENGTH)
+				dwell_start.push_back(i);
+		}
+		int num_frames = dwell_start.size();
+		int threads = num_frames < (int)num_threads ? num_frames : (int)num_threads;
+
+		std::vector<std::thread> workers;
+		for (int t = 0; t < threads; t++) {
+			int first = (int)((long long)num_frames * t / threads);
+			int last = (int)((long long)num_frames * (t+1) / threads);
+			workers.push_back(std::thread(estimate_dwells, dataIn_I, dataIn_Q, dwell_start.data(), first, last, snr_est_out));
+		}
+		for (size_t t = 0; t < workers.size(); t++)
+			workers[t].join();
+
+		last_samples = capture_offsets[num_captures];
+		last_seconds = seconds_since(start);
+		return true;
+	}
+
+private:
+	static void estimate_dwells(const char *dataIn_I, const char *dataIn_Q, const unsigned int *dwell_start,
+		int first, int last, short *snr_est_out)
+	{
+		SnrEngine engine;
+		snr_estimate_t est;
+		for (int i = first; i < last; i++) {
+			engine.reset();
+			engine.push(dataIn_I + dwell_start[i], dataIn_Q + dwell_start[i], SNR_DWELL_LENGTH);
+			if (engine.poll(&est, 1))
+				snr_est_out[i] = est.snr_est;
+		}
+	}
+
+	static void estimate_frames(const char *dataIn_I, const char *dataIn_Q, int first, int last, short *snr_est_out)
+	{
+		SnrEngine engine;
+		size_t offset = (size_t)first * SNR_DWELL_LENGTH;
+		engine.push(dataIn_I + offset, dataIn_Q + offset, (size_t)(last - first) * SNR_DWELL_LENGTH);
+
+		snr_estimate_t est;
+		for (int i = first; i < last && engine.poll(&est, 1); i++)
+			snr_est_out[i] = est.snr_est;
+	}
+
+	unsigned int num_threads;
+};
+
+
+// The emulated channels are process wide, like the FPGA's, so only one
+// emu backend can be running the kernels at a time
+static std::mutex emu_channels_mutex;
+
+class EmuBackend : public SnrBackend {
+public:
+	const char *name() const { return "emu"; }
+
+	bool init() { return true; }
+
+	bool run(const char *dataIn_I, const char *dataIn_Q, int num_samples, short *snr_est_out)
+	{
+		std::lock_guard<std::mutex> lock(emu_channels_mutex);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		unsigned int slotLen = num_samples;
+		int status = run_snr_kernels_emulated(dataIn_I, dataIn_Q, num_samples, slotLen,
+			snr_est_out, num_samples / SNR_DWELL_LENGTH);
+		last_samples = num_samples;
+		last_seconds = seconds_since(start);
+		return status == 0;
+	}
+
+	// One pass of data_in_batch and data_out_batch over the whole batch
+	bool run_batch(const char *dataIn_I, const char *dataIn_Q,
+		const unsigned int *capture_offsets, unsigned int num_captures, short *snr_est_out)
+	{
+		std::lock_guard<std::mutex> lock(emu_channels_mutex);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::vector<unsigned int> est_offsets(num_captures+1);
+		snr_batch_est_offsets(capture_offsets, num_captures, est_offsets.data());
+		unsigned int slotLen = capture_offsets[num_captures];
+		int status = run_snr_kernels_batch_emulated(dataIn_I, dataIn_Q, capture_offsets,
+			est_offsets.data(), num_captures, slotLen, snr_est_out);
+		last_samples = capture_offsets[num_captures];
+		last_seconds = seconds_since(start);
+		return status == 0;
+	}
+};
+
+
+SnrBackend *create_native_backend(const char *name)
+{
+	if (strcmp(name, "cpu") == 0)
+		return new CpuBackend();
+	if (strcmp(name, "emu") == 0)
+		return new EmuBackend();
+	return NULL;
+}
@@ -0,0 +1,257 @@
+/******************************************************************************
+*  @file    snr_daemon.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Keeps a backend initialized and serves estimation jobs over a
+*  Unix domain socket.
+*
+*  @section DESCRIPTION
+*
+*  The job buffers only ever grow, so once the daemon has seen its largest
+*  job there is no allocation on the dispatch path: a job is two reads into
+*  ready buffers, one run_batch and one write.  They are aligned like the
+*  host's alignedMalloc arrays so the OpenCL backend's zero-copy mode can
+*  use them in place.
+*
+*******************************************************************************/
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <vector>
+#include "snr_daemon.h"
+
+#define SNR_DAEMON_ALIGNMENT  64  // AOCL_ALIGNMENT
+
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void on_stop_signal(int)
+{
+	stop_requested = 1;
+}
+
+
+// Read or write exactly len bytes.  false on error or end of stream.
+static bool read_all(int fd, void *buf, size_t len)
+{
+	char *p = (char *)buf;
+	while (len > 0) {
+		ssize_t n = read(fd, p, len);
+		if (n < 0 && errno == EINTR && !stop_requested)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		len -= n;
+	}
+	return true;
+}
+
+static bool write_all(int fd, const void *buf, size_t len)
+{
+	const char *p = (const char *)buf;
+	while (len > 0) {
+		ssize_t n = write(fd, p, len);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		len -= n;
+	}
+	return true;
+}
+
+static bool make_address(const char *socket_path, struct sockaddr_un *addr)
+{
+	if (strlen(socket_path) >= sizeof(addr->sun_path)) {
+		printf("ERROR: Socket path %s is too long\n", socket_path);
+		return false;
+	}
+	memset(addr, 0, sizeof(*addr));
+	addr->sun_family = AF_UNIX;
+	strcpy(addr->sun_path, socket_path);
+	return true;
+}
+
+
+// Job buffers that grow to the largest job seen and are then reused
+class JobBuffers {
+public:
+	JobBuffers() : I(NULL), Q(NULL), est(NULL), sample_cap(0), est_cap(0) {}
+	~JobBuffers() { free(I); free(Q); free(est); }
+
+	bool reserve(size_t num_samples, size_t num_estimates)
+	{
+		if (num_samples > sample_cap) {
+			free(I);
+			free(Q);
+			I = Q = NULL;
+			sample_cap = 0;
+			if (posix_memalign((void **)&I, SNR_DAEMON_ALIGNMENT, num_samples) != 0 ||
+				posix_memalign((void **)&Q, SNR_DAEMON_ALIGNMENT, num_samples) != 0)
+				return false;
+			sample_cap = num_samples;
+		}
+		// at least one, so the buffer exists for jobs without estimates
+		if (num_estimates + 1 > est_cap) {
+			free(est);
+			est = NULL;
+			est_cap = 0;
+			if (posix_memalign((void **)&est, SNR_DAEMON_ALIGNMENT, (num_estimates+1)*sizeof(short)) != 0)
+				return false;
+			est_cap = num_estimates + 1;
+		}
+		return true;
+	}
+
+	char *I;
+	char *Q;
+	short *est;
+	std::vector<unsigned int> capture_offsets;
+	std::vector<unsigned int> est_offsets;
+
+private:
+	size_t sample_cap;
+	size_t est_cap;
+};
+
+
+// Run every job sent on one connection.  false if the connection has to be dropped.
+static bool serve_job(SnrBackend *backend, int fd, JobBuffers &jb)
+{
+	unsigned int header[2];
+	if (!read_all(fd, header, sizeof(header)))
+		return false;
+	unsigned int num_captures = header[1];
+	if (header[0] != SNR_DAEMON_JOB_MAGIC || num_captures == 0 || num_captures > SNR_DAEMON_MAX_CAPTURES) {
+		printf("Dropping client: bad job header\n");
+		return false;
+	}
+
+	jb.capture_offsets.resize(num_captures+1);
+	if (!read_all(fd, jb.capture_offsets.data(), (num_captures+1)*sizeof(unsigned int)))
+		return false;
+	bool valid = jb.capture_offsets[0] == 0 && jb.capture_offsets[num_captures] <= SNR_DAEMON_MAX_SAMPLES;
+	for (unsigned int c = 0; valid && c < num_captures; c++)
+		valid = jb.capture_offsets[c] <= jb.capture_offsets[c+1];
+	if (!valid) {
+		printf("Dropping client: bad capture offsets\n");
+		return false;
+	}
+
+	unsigned int num_samples = jb.capture_offsets[num_captures];
+	jb.est_offsets.resize(num_captures+1);
+	unsigned int num_estimates = snr_batch_est_offsets(jb.capture_offsets.data(), num_captures, jb.est_offsets.data());
+	if (!jb.reserve(num_samples, num_estimates)) {
+		printf("Dropping client: out of memory for %u samples\n", num_samples);
+		return false;
+	}
+	if (!read_all(fd, jb.I, num_samples) || !read_all(fd, jb.Q, num_samples))
+		return false;
+
+	int status = 0;
+	if (num_samples > 0)
+		status = backend->run_batch(jb.I, jb.Q, jb.capture_offsets.data(), num_captures, jb.est) ? 0 : -1;
+	if (status != 0)
+		num_estimates = 0;
+#ifdef VERBOSE
+	printf("Job: %u captures, %u samples, %0.3f ms\n", num_captures, num_samples, backend->run_seconds() * 1e3);
+#endif
+
+	unsigned int reply[3] = { SNR_DAEMON_REPLY_MAGIC, (unsigned int)status, num_estimates };
+	return write_all(fd, reply, sizeof(reply)) && write_all(fd, jb.est, num_estimates*sizeof(short));
+}
+
+
+int snr_daemon_serve(SnrBackend *backend, const char *socket_path)
+{
+	struct sockaddr_un addr;
+	if (!make_address(socket_path, &addr))
+		return -1;
+
+	// No SA_RESTART, so a signal wakes accept() and read() to check stop_requested
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = on_stop_signal;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	signal(SIGPIPE, SIG_IGN);  // a client that hangs up only drops its connection
+
+	int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listen_fd < 0) {
+		perror("socket");
+		return -1;
+	}
+	unlink(socket_path);
+	if (bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listen_fd, 16) < 0) {
+		perror(socket_path);
+		close(listen_fd);
+		return -1;
+	}
+	printf("Backend %s serving on %s\n", backend->name(), socket_path);
+	fflush(stdout);
+
+	JobBuffers jb;
+	while (!stop_requested) {
+		int fd = accept(listen_fd, NULL, NULL);
+		if (fd < 0) {
+			if (errno == EINTR)
+				continue;
+			perror("accept");
+			break;
+		}
+		while (!stop_requested && serve_job(backend, fd, jb))
+			;
+		close(fd);
+	}
+
+	close(listen_fd);
+	unlink(socket_path);
+	printf("Daemon on %s stopped\n", socket_path);
+	return stop_requested ? 0 : -1;
+}
+
+
+int snr_daemon_connect(const char *socket_path)
+{
+	struct sockaddr_un addr;
+	if (!make_address(socket_path, &addr))
+		return -1;
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0)
+		return -1;
+	if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		perror(socket_path);
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+int snr_daemon_request(int fd, const char *dataIn_I, const char *dataIn_Q,
+	const unsigned int *capture_offsets, unsigned int num_captures, short *snr_est_out)
+{
+	unsigned int num_samples = capture_offsets[num_captures];
+	unsigned int header[2] = { SNR_DAEMON_JOB_MAGIC, num_captures };
+	if (!write_all(fd, header, sizeof(header)) ||
+		!write_all(fd, capture_offsets, (num_captures+1)*sizeof(unsigned int)) ||
+		!write_all(fd, dataIn_I, num_samples) ||
+		!write_all(fd, dataIn_Q, num_samples))
+		return -1;
+
+	unsigned int reply[3];
+	if (!read_all(fd, reply, sizeof(reply)) || reply[0] != SNR_DAEMON_REPLY_MAGIC)
+		return -1;
+	if (!read_all(fd, snr_est_out, reply[2]*sizeof(short)))
+		return -1;
+	return reply[1] == 0 ? (int)reply[2] : -1;
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+*  @file    snr_decimated_engine.cpp
+*  @date    10/16/2026
+*  @version 1.0
+*
+*  @brief Native SNR estimator that only looks at one sample in k.
+*
+*  @section DESCRIPTION
+*
+*  The estimator loop in push_mags is snr_window_step from
+*  device/SNR_estimator_multi_window.cl, run on the picked samples.
+*
+*******************************************************************************/
+
+#include <assert.h>
+#include <algorithm>
+#include "cl_compat.h"
+#include "snr_decimated_engine.h"
+#include "../../device/SNR_estimator_LUT_coefficients_AGC_at_21.h"
+#include "../../device/SNR_estimator_LUT_coefficients_512_AGC_at_21.h"
+#include "../../device/SNR_estimator_LUT_coefficients_256_AGC_at_21.h"
+#include "../../device/SNR_estimator_LUT_coefficients_128_AGC_at_21.h"
+
+
+SnrDecimatedEngine::SnrDecimatedEngine(unsigned int decimation, bool random, unsigned int seed)
+	: k(decimation), random(random), seed(seed ? seed : 1)
+{
+	assert(valid_decimation(k));
+	switch (k) {
+	case 2: lut = SNR_estimator_LUT_coefficients_512; break;
+	case 4: lut = SNR_estimator_LUT_coefficients_256; break;
+	case 8: lut = SNR_estimator_LUT_coefficients_128; break;
+	default: lut = SNR_estimator_LUT_coefficients; break;
+	}
+	num_samp_to_average = SNR_NUM_SAMP_TO_AVG / k;
+	delay_line.resize(num_samp_to_average + 1);
+	reset();
+}
+
+void SnrDecimatedEngine::reset()
+{
+	rng = seed;
+	sample_cnt = 0;
+	used_cnt = 0;
+	group = 0;
+	pick = 0;
+	if (random)
+		pick = rng & (k-1);
+	std::fill(delay_line.begin(), delay_line.end(), 0);
+	head = 0;
+	while_loop_cntr = 0;
+	abs_energy_sum = 0;
+	noiseVarSum = 0;
+	out.clear();
+	out_rd = 0;
+}
+
+bool SnrDecimatedEngine::valid_decimation(unsigned int decimation)
+{
+	return decimation == 1 || decimation == 2 || decimation == 4 || decimation == 8;
+}
+
+int SnrDecimatedEngine::accuracy_bound(unsigned int decimation)
+{
+	switch (decimation) {
+	case 2: return SNR_DECIM_BOUND_2;
+	case 4: return SNR_DECIM_BOUND_4;
+	case 8: return SNR_DECIM_BOUND_8;
+	default: return 0;
+	}
+}
+
+size_t SnrDecimatedEngine::poll(snr_estimate_t *estimates, size_t max_estimates)
+{
+	size_t n = 0;
+	while (n < max_estimates && out_rd < out.size())
+		estimates[n++] = out[out_rd++];
+	if (out_rd == out.size()) {
+		out.clear();
+		out_rd = 0;
+	}
+	return n;
+}
+
+void SnrDecimatedEngine::next_pick()
+{
+	group += k;
+	if (random) {
+		rng ^= rng << 13;
+		rng ^= rng >> 17;
+		rng ^= rng << 5;
+		pick = group + (rng & (k-1));
+	} else {
+		pick = group;
+	}
+}
+
+// Every dwell has SNR_DWELL_LENGTH/k groups and so as many picks, which
+// is 2*num_samp_to_average: the estimator's dwells line up with the input's
+void SnrDecimatedEngine::push_mags(const unsigned int *mag, const unsigned long long *sample_ind, size_t n)
+{
+	const int num_samp_to_average = this->num_samp_to_average;
+	unsigned short *delay_line = this->delay_line.data();
+	unsigned int head = this->head;
+	int while_loop_cntr = this->while_loop_cntr;
+	unsigned long abs_energy_sum = this->abs_energy_sum;
+	unsigned long noiseVarSum = this->noiseVarSum;
+
+	for (size_t i = 0; i < n; i++) {
+		int cordic_abs = mag[i];
+
+		if (while_loop_cntr == 2*num_samp_to_average) {
+			while_loop_cntr = 0;
+			noiseVarSum = 0;
+			abs_energy_sum = 0;
+		}
+		while_loop_cntr += 1;
+
+		if (while_loop_cntr > num_samp_to_average+1)
+			abs_energy_sum -= delay_line[head];
+		abs_energy_sum += cordic_abs;
+
+		delay_line[head] = (unsigned short)cordic_abs;
+		head = (head == (unsigned int)num_samp_to_average) ? 0 : head+1;
+
+		if (while_loop_cntr > num_samp_to_average)
+			noiseVarSum += ((cordic_abs*num_samp_to_average) - abs_energy_sum)*((cordic_abs*num_samp_to_average) - abs_energy_sum);
+
+		if (while_loop_cntr == 2*num_samp_to_average) {
+			int carry = (1&(noiseVarSum>>(15-1)));
+			snr_estimate_t est;
+			est.sample_ind = sample_ind[i];
+			est.noiseVarSum_final = (noiseVarSum>>15) + carry;
+			est.numerator = (abs_energy_sum*num_samp_to_average*num_samp_to_average)>>(8);
+			est.snr_est = lut[snr_lut_index(est.numerator, est.noiseVarSum_final)];
+			out.push_back(est);
+		}
+	}
+
+	this->head = head;
+	this->while_loop_cntr = while_loop_cntr;
+	this->abs_energy_sum = abs_energy_sum;
+	this->noiseVarSum = noiseVarSum;
+	used_cnt += n;
+}
@@ -0,0 +1,281 @@
+/******************************************************************************
+*  @file    snr_engine.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Native C++ model of the SNR estimator kernels.
+*
+*  @section DESCRIPTION
+*
+*  Every step below follows snr_est_LUT_correction line for line, including
+*  the unsigned wrap-around in the noise variance sum, the carry rounding and
+*  the integer lookup_index.  Do not "clean up" the arithmetic here without
+*  making the same change in the kernel.  The magnitudes come in from
+*  SnrEngine::push, which computes them per sample format (snr_sample.h).
+*
+*******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "cl_compat.h"
+#include "snr_engine.h"
+#include "../../device/SNR_estimator_LUT_coefficients_AGC_at_21.h"
+#include "../../device/snr_index.h"  // defines snr_lut_index for the host
+#include "../../device/snr_sequential.h"
+
+
+int snr_lookup_index(unsigned long numerator, unsigned long noiseVarSum_final)
+{
+	float temp_snr_est = (10*log10f((float)(numerator)/((float)(noiseVarSum_final))));
+	int lookup_index = (int)(roundf((float)temp_snr_est*100) + SNR_LUT_OFFSET);
+	if (lookup_index > SNR_LUT_LEN-1) lookup_index = SNR_LUT_LEN-1;
+	if (lookup_index < 0) lookup_index = 0;
+	return lookup_index;
+}
+
+short snr_lut_lookup(int lookup_index)
+{
+	return SNR_estimator_LUT_coefficients[lookup_index];
+}
+
+snr_estimate_t snr_make_estimate(unsigned long abs_energy_sum, unsigned long noiseVarSum,
+	unsigned long long sample_ind)
+{
+	const int bits_to_shift = SNR_BITS_TO_SHIFT;
+	int carry = (1&(noiseVarSum>>(15-1)));
+	snr_estimate_t est;
+	est.sample_ind = sample_ind;
+	est.noiseVarSum_final = (noiseVarSum>>15) + carry;
+	est.numerator = ((abs_energy_sum)<<(2*bits_to_shift))>>(8);
+	est.snr_est = snr_lut_lookup(snr_lut_index(est.numerator, est.noiseVarSum_final));
+	return est;
+}
+
+
+SnrEngine::SnrEngine(unsigned int hop_length, int seq_precision)
+	: hop_length(hop_length), seq_precision(hop_length ? 0 : seq_precision)
+{
+	reset();
+}
+
+void SnrEngine::reset()
+{
+	sample_cnt = 0;
+	memset(delay_line, 0, sizeof(delay_line));
+	head = 0;
+	noiseVarSum = 0;
+	abs_energy_sum = 0;
+	while_loop_cntr = 0;
+	hop_cnt = 0;
+	memset(noise_line, 0, sizeof(noise_line));
+	noise_head = 0;
+	seq_done = false;
+	noise_shifted_sum = 0;
+	noise_shifted_sq_sum = 0;
+	skipped_cnt = 0;
+	out.clear();
+	out_rd = 0;
+}
+
+size_t SnrEngine::poll(snr_estimate_t *estimates, size_t max_estimates)
+{
+	size_t n = 0;
+	while (n < max_estimates && out_rd < out.size())
+		estimates[n++] = out[out_rd++];
+	if (out_rd == out.size()) {
+		out.clear();
+		out_rd = 0;
+	}
+	return n;
+}
+
+void SnrEngine::push_mags(const unsigned int *mag, size_t n)
+{
+	const int num_samp_to_average = SNR_NUM_SAMP_TO_AVG;
+	const int bits_to_shift = SNR_BITS_TO_SHIFT;
+
+	if (hop_length) {
+		push_mags_hop(mag, n);
+		return;
+	}
+	if (seq_precision > 0) {
+		push_mags_seq(mag, n);
+		return;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		int cordic_abs = mag[i];
+
+		// data_in
+		bool sof = (sample_cnt % SNR_DWELL_LENGTH) == 0;
+		sample_cnt++;
+
+		// snr_est_LUT_correction
+		if (sof) {
+			while_loop_cntr = 0;
+			noiseVarSum = 0;
+			abs_energy_sum = 0;
+		}
+		while_loop_cntr += 1;
+
+		// Remove last sample and add newest.  The oldest entry is a zero sample
+		// until the delay line has refilled after sof.
+		if (while_loop_cntr > SNR_SYMBOL_LENGTH+1)
+			abs_energy_sum -= delay_line[head];
+		abs_energy_sum += cordic_abs;
+
+		delay_line[head] = (unsigned short)cordic_abs;
+		head = (head == SNR_SYMBOL_LENGTH) ? 0 : head+1;
+
+		if (while_loop_cntr > num_samp_to_average)
+		{
+			noiseVarSum += ((cordic_abs<<bits_to_shift) - abs_energy_sum)*((cordic_abs<<bits_to_shift) - abs_energy_sum);
+		}
+
+		if (while_loop_cntr == (2*num_samp_to_average))
+			out.push_back(snr_make_estimate(abs_energy_sum, noiseVarSum, sample_cnt - 1));
+	}
+}
+
+// The -DSNR_HOP_LENGTH build of the kernel.  sof only comes with the first
+// sample and while_loop_cntr stops at 2*num_samp_to_average+1, where the
+// window is full.  From then on every sample also retires the noise term
+// of the sample num_samp_to_average ago, so noiseVarSum always covers the
+// same samples as in the dwell that would end here.
+void SnrEngine::push_mags_hop(const unsigned int *mag, size_t n)
+{
+	const int num_samp_to_average = SNR_NUM_SAMP_TO_AVG;
+	const int bits_to_shift = SNR_BITS_TO_SHIFT;
+
+	for (size_t i = 0; i < n; i++) {
+		int cordic_abs = mag[i];
+
+		// data_in
+		bool sof = sample_cnt == 0;
+		sample_cnt++;
+
+		// snr_est_LUT_correction
+		if (sof) {
+			while_loop_cntr = 0;
+			noiseVarSum = 0;
+			abs_energy_sum = 0;
+			hop_cnt = 0;
+		}
+		if (while_loop_cntr <= 2*num_samp_to_average)
+			while_loop_cntr += 1;
+
+		if (while_loop_cntr > SNR_SYMBOL_LENGTH+1)
+			abs_energy_sum -= delay_line[head];
+		abs_energy_sum += cordic_abs;
+
+		delay_line[head] = (unsigned short)cordic_abs;
+		head = (head == SNR_SYMBOL_LENGTH) ? 0 : head+1;
+
+		if (while_loop_cntr > num_samp_to_average)
+		{
+			unsigned long noise_term = ((cordic_abs<<bits_to_shift) - abs_energy_sum)*((cordic_abs<<bits_to_shift) - abs_energy_sum);
+			if (while_loop_cntr > 2*num_samp_to_average)
+				noiseVarSum -= noise_line[noise_head];
+			noiseVarSum += noise_term;
+			noise_line[noise_head] = noise_term;
+			noise_head = (noise_head == num_samp_to_average-1) ? 0 : noise_head+1;
+		}
+
+		bool emit = false;
+		if (while_loop_cntr == (2*num_samp_to_average))
+			emit = true;
+		else if (while_loop_cntr > (2*num_samp_to_average) && ++hop_cnt == hop_length)
+			emit = true;
+		if (emit) {
+			hop_cnt = 0;
+			out.push_back(snr_make_estimate(abs_energy_sum, noiseVarSum, sample_cnt - 1));
+		}
+	}
+}
+
+// The -DSNR_SEQ_PRECISION build of the kernel.  Once a dwell's estimate is
+// out the kernel still runs the rest of the dwell through the accumulators,
+// but sof clears them before anything reads them again, so here those
+// samples are only counted.
+void SnrEngine::push_mags_seq(const unsigned int *mag, size_t n)
+{
+	const int num_samp_to_average = SNR_NUM_SAMP_TO_AVG;
+	const int bits_to_shift = SNR_BITS_TO_SHIFT;
+
+	for (size_t i = 0; i < n; i++) {
+		int cordic_abs = mag[i];
+
+		// data_in
+		bool sof = (sample_cnt % SNR_DWELL_LENGTH) == 0;
+		sample_cnt++;
+
+		// snr_est_LUT_correction
+		if (sof) {
+			while_loop_cntr = 0;
+			noiseVarSum = 0;
+			abs_energy_sum = 0;
+			noise_shifted_sum = 0;
+			noise_shifted_sq_sum = 0;
+			seq_done = false;
+		}
+		if (seq_done)
+			continue;  // the rest of the dwell is not needed
+		while_loop_cntr += 1;
+
+		if (while_loop_cntr > SNR_SYMBOL_LENGTH+1)
+			abs_energy_sum -= delay_line[head];
+		abs_energy_sum += cordic_abs;
+
+		delay_line[head] = (unsigned short)cordic_abs;
+		head = (head == SNR_SYMBOL_LENGTH) ? 0 : head+1;
+
+		if (while_loop_cntr > num_samp_to_average)
+		{
+			unsigned long noise_term = ((cordic_abs<<bits_to_shift) - abs_energy_sum)*((cordic_abs<<bits_to_shift) - abs_energy_sum);
+			noiseVarSum += noise_term;
+			noise_shifted_sum += noise_term>>SNR_SEQ_TERM_SHIFT;
+			noise_shifted_sq_sum += (noise_term>>SNR_SEQ_TERM_SHIFT)*(noise_term>>SNR_SEQ_TERM_SHIFT);
+		}
+
+		int seq_terms = while_loop_cntr - num_samp_to_average;
+		if (seq_terms == num_samp_to_average) {
+			seq_done = true;
+			out.push_back(snr_make_estimate(abs_energy_sum, noiseVarSum, sample_cnt - 1));
+		} else if (seq_terms >= SNR_SEQ_MIN_TERMS && seq_terms < num_samp_to_average &&
+			(seq_terms & (SNR_SEQ_CHECK-1)) == 0) {
+			snr_estimate_t est = snr_make_estimate(abs_energy_sum, noiseVarSum, sample_cnt - 1);
+			est.noiseVarSum_final = snr_seq_scale_noise(est.noiseVarSum_final, seq_terms);
+			int lookup_index = snr_lut_index(est.numerator, est.noiseVarSum_final);
+			if (snr_seq_converged(noise_shifted_sum, noise_shifted_sq_sum, seq_terms, lookup_index,
+				SNR_estimator_LUT_coefficients, seq_precision)) {
+				est.snr_est = snr_lut_lookup(lookup_index);
+				seq_done = true;
+				out.push_back(est);
+			}
+		}
+	}
+}
+
+// Counts off up to n samples of the dwell whose estimate is already out.
+// Returns the number skipped, which stops at the next sof.
+size_t SnrEngine::skip_seq(size_t n)
+{
+	unsigned long long to_sof = SNR_DWELL_LENGTH - sample_cnt % SNR_DWELL_LENGTH;
+	if (to_sof == SNR_DWELL_LENGTH)
+		return 0;  // the next sample is a sof
+	size_t k = (n < to_sof) ? n : (size_t)to_sof;
+	sample_cnt += k;
+	skipped_cnt += k;
+	return k;
+}
+
+// Blocks stop at each convergence test, so an early estimate wastes no
+// magnitudes on the rest of its dwell
+size_t SnrEngine::seq_block(size_t m) const
+{
+	size_t pos = sample_cnt % SNR_DWELL_LENGTH;
+	size_t next = (pos/SNR_SEQ_CHECK + 1)*SNR_SEQ_CHECK;
+	if (next < SNR_NUM_SAMP_TO_AVG + SNR_SEQ_MIN_TERMS)
+		next = SNR_NUM_SAMP_TO_AVG + SNR_SEQ_MIN_TERMS;
+	return (next - pos < m) ? next - pos : m;
+}
@@ -0,0 +1,104 @@
+/******************************************************************************
+*  @file    snr_kernels_emu.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Runs the SNR estimator .cl kernels natively, one thread per kernel.
+*
+*  @section DESCRIPTION
+*
+*  device/SNR_estimator_LUT_correction_top.cl is compiled here as C++ through
+*  cl_channel_emu.h.  It is wrapped in a namespace so its copy of cordic.h
+*  does not collide with the host one in cordic.cpp.  This is the only file
+*  that should include cl_channel_emu.h, since its macros (channel, __kernel,
+*  ...) would leak into anything that follows.
+*
+*******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include "snr_kernels_emu.h"
+#include "cl_channel_emu.h"
+
+// The device code is compiled as is: register is an FPGA attribute
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wparentheses"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wformat"
+
+namespace snr_kernels {
+// OpenCL built-ins: the single precision overloads, as on the device
+using std::log10;
+using std::round;
+using std::max;
+using std::min;
+#include "../../device/SNR_estimator_LUT_correction_top.cl"
+}
+
+#pragma GCC diagnostic pop
+
+
+void cl_emu::pin_thread(std::thread &t, unsigned int index)
+{
+	unsigned int num_cpus = std::thread::hardware_concurrency();
+	if (num_cpus == 0)
+		return;
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	CPU_SET(index % num_cpus, &cpus);
+	pthread_setaffinity_np(t.native_handle(), sizeof(cpus), &cpus);
+}
+
+
+// Run a reader and a writer kernel with snr_est_LUT_correction between them
+template<typename Reader, typename Writer> static int run_pipeline(unsigned int slotLen,
+	Reader read_kernel, Writer write_kernel)
+{
+	cl_emu::SpscQueue<snr_kernels::__freqDetIn> &din = cl_emu_channel(snr_kernels::SNR_DET_DIN_LUT);
+	cl_emu::SpscQueue<int> &dout = cl_emu_channel(snr_kernels::SNR_DOUT);
+	din.reset();
+	dout.reset();
+
+	// snr_est_LUT_correction never returns; it ends when its input channel is closed
+	std::thread reader(read_kernel);
+	std::thread estimator([&] {
+		try {
+			snr_kernels::snr_est_LUT_correction(slotLen);
+		} catch (cl_emu::channel_closed &) {
+		}
+	});
+	std::thread writer(write_kernel);
+	cl_emu::pin_thread(reader, 0);
+	cl_emu::pin_thread(estimator, 1);
+	cl_emu::pin_thread(writer, 2);
+
+	reader.join();
+	writer.join();
+	din.close();
+	dout.close();
+	estimator.join();
+	return 0;
+}
+
+
+int run_snr_kernels_emulated(const char *dataIn_I, const char *dataIn_Q, unsigned int dataInLen,
+	unsigned int slotLen, short *snr_est_out, int num_output_frames)
+{
+	return run_pipeline(slotLen,
+		[&] { snr_kernels::data_in((char *)dataIn_I, (char *)dataIn_Q, dataInLen); },
+		[&] { snr_kernels::data_out(snr_est_out, num_output_frames); });
+}
+
+
+int run_snr_kernels_batch_emulated(const char *dataIn_I, const char *dataIn_Q,
+	const unsigned int *capture_offsets, const unsigned int *est_offsets, unsigned int num_captures,
+	unsigned int slotLen, short *snr_est_out)
+{
+	return run_pipeline(slotLen,
+		[&] { snr_kernels::data_in_batch((char *)dataIn_I, (char *)dataIn_Q, capture_offsets, num_captures); },
+		[&] { snr_kernels::data_out_batch(snr_est_out, est_offsets, num_captures); });
+}
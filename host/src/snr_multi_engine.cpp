@@ -0,0 +1,179 @@
+/******************************************************************************
+*  @file    snr_multi_engine.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Many channel version of SnrEngine with structure-of-arrays state.
+*
+*  @section DESCRIPTION
+*
+*  Each time step first computes every channel's magnitude (the polar
+*  table for int8, the batch CORDIC otherwise), then updates the
+*  accumulators of all channels with one SIMD lane per channel.  The
+*  update is the same as SnrEngine::push_mags, with two
+*  narrowings that do not change any result:
+*
+*    - abs_energy_sum is a sum of at most 513 magnitudes <= 46341, so it
+*      never wraps and fits in 32 bits.
+*    - (cordic_abs<<9) - abs_energy_sum is within +/-2^25.  The kernel
+*      squares it as a wrapped unsigned long, which is the same as squaring
+*      the signed 32 bit difference into 64 bits.
+*
+*  The lane width follows cordic_batch_isa(): 16 lanes with AVX-512, 8 with
+*  AVX2, otherwise 4 with the SSE2 every x86-64 has (or, off x86, with
+*  whatever vectors GCC finds for the target).
+*
+*******************************************************************************/
+
+#include <string.h>
+#include "cordic_batch.h"
+#include "snr_multi_engine.h"
+
+#define MULTI_MAX_LANES  16
+
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+#define LANES_INLINE static inline __attribute__((always_inline))
+
+
+// Vector types for W channels at a time
+#define DEFINE_LANES(name, W) \
+	struct name { \
+		enum { width = W }; \
+		typedef unsigned int VU __attribute__((vector_size(W*4))); \
+		typedef int VI __attribute__((vector_size(W*4))); \
+		typedef unsigned short VH __attribute__((vector_size(W*2))); \
+		typedef long long VL __attribute__((vector_size(W*8))); \
+	};
+
+DEFINE_LANES(lanes4, 4)
+DEFINE_LANES(lanes8, 8)
+DEFINE_LANES(lanes16, 16)
+
+
+// Update one vector of channels' accumulators and delay line entries with this step's magnitudes
+template<typename L> LANES_INLINE void update_lanes(unsigned short *line, unsigned int *abs_sum,
+	unsigned long long *noise, const unsigned int *mag, bool remove_oldest, bool accumulate)
+{
+	typedef typename L::VU VU;
+	typedef typename L::VI VI;
+	typedef typename L::VH VH;
+	typedef typename L::VL VL;
+
+	VU m, a;
+	memcpy(&m, mag, sizeof(m));
+	memcpy(&a, abs_sum, sizeof(a));
+
+	if (remove_oldest) {
+		VH old;
+		memcpy(&old, line, sizeof(old));
+		a -= __builtin_convertvector(old, VU);
+	}
+	a += m;
+	memcpy(abs_sum, &a, sizeof(a));
+
+	VH m16 = __builtin_convertvector(m, VH);
+	memcpy(line, &m16, sizeof(m16));
+
+	if (accumulate) {
+		VL n;
+		VL d = __builtin_convertvector((VI)((m << SNR_BITS_TO_SHIFT) - a), VL);
+		memcpy(&n, noise, sizeof(n));
+		n += d*d;
+		memcpy(noise, &n, sizeof(n));
+	}
+}
+
+#define DEFINE_UPDATE(name, target_attr, L) \
+	target_attr \
+	static void name(unsigned short *line, unsigned int *abs_sum, unsigned long long *noise, \
+		const unsigned int *mag, unsigned int num_lanes, bool remove_oldest, bool accumulate) \
+	{ \
+		for (unsigned int i = 0; i < num_lanes; i += L::width) \
+			update_lanes<L>(line+i, abs_sum+i, noise+i, mag+i, remove_oldest, accumulate); \
+	}
+
+#ifdef CORDIC_BATCH_X86
+DEFINE_UPDATE(update_base, __attribute__((target("sse2"))), lanes4)
+DEFINE_UPDATE(update_avx2, __attribute__((target("avx2"))), lanes8)
+DEFINE_UPDATE(update_avx512, __attribute__((target("avx512f,avx512bw"))), lanes16)
+#else
+DEFINE_UPDATE(update_base, , lanes4)
+#endif
+
+
+SnrMultiEngine::SnrMultiEngine(unsigned int num_channels)
+	: num_channels(num_channels)
+{
+	num_lanes = (num_channels + MULTI_MAX_LANES-1) / MULTI_MAX_LANES * MULTI_MAX_LANES;
+	delay_line.resize((size_t)(SNR_SYMBOL_LENGTH+1) * num_lanes);
+	abs_energy_sum.resize(num_lanes);
+	noiseVarSum.resize(num_lanes);
+	mag.resize(num_lanes);
+	reset();
+}
+
+void SnrMultiEngine::reset()
+{
+	sample_cnt = 0;
+	head = 0;
+	while_loop_cntr = 0;
+	memset(delay_line.data(), 0, delay_line.size()*sizeof(delay_line[0]));
+	memset(abs_energy_sum.data(), 0, abs_energy_sum.size()*sizeof(abs_energy_sum[0]));
+	memset(noiseVarSum.data(), 0, noiseVarSum.size()*sizeof(noiseVarSum[0]));
+	memset(mag.data(), 0, mag.size()*sizeof(mag[0]));
+	out.clear();
+	out_rd = 0;
+}
+
+bool SnrMultiEngine::poll(snr_estimate_t *estimates)
+{
+	if (out_rd == out.size())
+		return false;
+	memcpy(estimates, &out[out_rd], num_channels*sizeof(snr_estimate_t));
+	out_rd += num_channels;
+	if (out_rd == out.size()) {
+		out.clear();
+		out_rd = 0;
+	}
+	return true;
+}
+
+void SnrMultiEngine::push_step()
+{
+	// data_in
+	bool sof = (sample_cnt % SNR_DWELL_LENGTH) == 0;
+	sample_cnt++;
+
+	if (sof) {
+		while_loop_cntr = 0;
+		memset(abs_energy_sum.data(), 0, num_lanes*sizeof(abs_energy_sum[0]));
+		memset(noiseVarSum.data(), 0, num_lanes*sizeof(noiseVarSum[0]));
+	}
+	while_loop_cntr += 1;
+
+	// Same sof/refill rules as SnrEngine::push_mags
+	bool remove_oldest = while_loop_cntr > SNR_SYMBOL_LENGTH+1;
+	bool accumulate = while_loop_cntr > SNR_NUM_SAMP_TO_AVG;
+	unsigned short *line = &delay_line[(size_t)head * num_lanes];
+
+	switch (cordic_batch_isa()) {
+#ifdef CORDIC_BATCH_X86
+	case CORDIC_ISA_AVX512:
+		update_avx512(line, abs_energy_sum.data(), noiseVarSum.data(), mag.data(), num_lanes, remove_oldest, accumulate);
+		break;
+	case CORDIC_ISA_AVX2:
+		update_avx2(line, abs_energy_sum.data(), noiseVarSum.data(), mag.data(), num_lanes, remove_oldest, accumulate);
+		break;
+#endif
+	default:
+		update_base(line, abs_energy_sum.data(), noiseVarSum.data(), mag.data(), num_lanes, remove_oldest, accumulate);
+		break;
+	}
+	head = (head == SNR_SYMBOL_LENGTH) ? 0 : head+1;
+
+	if (while_loop_cntr == 2*SNR_NUM_SAMP_TO_AVG) {
+		for (unsigned int ch = 0; ch < num_channels; ch++)
+			out.push_back(snr_make_estimate(abs_energy_sum[ch], noiseVarSum[ch], sample_cnt - 1));
+	}
+}
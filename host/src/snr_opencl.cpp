@@ -0,0 +1,620 @@
+/******************************************************************************
+*  @file    snr_opencl.cpp
+*  @author  Chad Cole
+*  @date    6/3/2021
+*  @version 1.0
+*
+*  @brief OpenCL session for the SNR estimator kernels.
+*
+*  @section DESCRIPTION
+*
+*  Sets up the Intel FPGA OpenCL runtime for the SNR estimator and runs
+*  the data_in -> snr_est_LUT_correction -> data_out kernels.  All of the
+*  runtime objects live in an OpenClSession rather than in globals, see
+*  snr_opencl.h.
+*
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "CL/opencl.h"
+#include "AOCLUtils/aocl_utils.h"
+#include "snr_opencl.h"
+
+
+using namespace aocl_utils;
+
+#define AOCL_ALIGNMENT  64
+//#define VERBOSE
+
+
+static const char* kernel_names[K_NUM_KERNELS] =
+{
+"data_in",
+"snr_est_LUT_correction",
+"data_out",
+"data_in_batch",
+"data_out_batch"
+};
+
+
+OpenClSession::OpenClSession(const char *device_kernel, bool emulation)
+	: device_kernel(device_kernel), emulation(emulation), slotLen(SLOT_LEN),
+	  platform(NULL), num_devices(0), device(NULL), context(NULL), xfer_queue(NULL),
+	  program(NULL), estimator_launched(false)
+{
+	for (int i = 0; i < K_NUM_KERNELS; ++i) {
+		queue[i] = NULL;
+		kernel[i] = NULL;
+	}
+	for (int i = 0; i < XFER_NUM_BUFS; ++i) {
+		input_noisy_message_I_buf[i] = NULL;
+		input_noisy_message_Q_buf[i] = NULL;
+		output_buf[i] = NULL;
+	}
+}
+
+
+/*********************************************************
+
+@brief Free the resources allocated during initialization
+
+*********************************************************/
+OpenClSession::~OpenClSession() {
+
+	for (int i = 0; i<K_NUM_KERNELS; ++i) {
+		if (kernel[i])
+			clReleaseKernel(kernel[i]);
+	}
+	for (int i = 0; i<K_NUM_KERNELS; ++i) {
+		if (queue[i])
+			clReleaseCommandQueue(queue[i]);
+	}
+	
+	if (xfer_queue)
+		clReleaseCommandQueue(xfer_queue);
+	
+	for (int i = 0; i < XFER_NUM_BUFS; ++i) {
+		if (input_noisy_message_I_buf[i])
+			clReleaseMemObject(input_noisy_message_I_buf[i]);
+		if (input_noisy_message_Q_buf[i])
+			clReleaseMemObject(input_noisy_message_Q_buf[i]);
+		if (output_buf[i])
+			clReleaseMemObject(output_buf[i]);
+	}
+	if (program) {
+		clReleaseProgram(program);
+	}
+	if (context) {
+		clReleaseContext(context);
+	}
+}
+
+
+/*************************************************************************
+
+@brief The exe_dir function returns the directory of the running
+executable, where the .aocx files are installed next to it.  Unlike
+setCwdToExeDir it leaves the working directory alone, which every
+session and thread of the process shares and which the user's
+relative paths (-c, -o, -r, -d) are resolved against.
+
+@return std::string the directory, or "." if it cannot be found
+
+**************************************************************************/
+static std::string exe_dir()
+{
+	char path[PATH_MAX];
+	ssize_t len = readlink("/proc/self/exe", path, sizeof(path) - 1);
+	if (len <= 0)
+		return ".";
+	path[len] = 0;
+	char *slash = strrchr(path, '/');
+	if (slash == NULL)
+		return ".";
+	return std::string(path, slash - path);
+}
+
+
+/*************************************************************************
+
+@brief The init function intializes the OpenCL objects.
+Essentially it looks for an Altera OpenCl device, creates a
+context for that device.  The AOC compiled kernel is pointed to
+using device_kernel, in the executable's directory.  Provided a valid .aocx
+compiled kernel is found, the FPGA is programmed and command and data
+queues are generated.
+
+@return bool True if successful, otherwise false
+
+**************************************************************************/
+bool OpenClSession::init() {
+	cl_int status;
+
+	//printf("Initializing OpenCL\n");
+
+
+
+	//****************************
+	// Get the OpenCL platform.
+	//****************************
+/*	platform = findPlatform("Intel(R) FPGA SDK for OpenCL(TM)");
+	
+	if (platform == NULL) {
+		printf("ERROR: Unable to find Intel(R) FPGA OpenCL platform.\n");
+		return false;
+	} */
+    if (emulation) {
+             // new 'fast' emulator
+        platform = findPlatform("Intel(R) FPGA Emulation Platform for OpenCL(TM)");
+        if (platform == NULL) {
+            printf("ERROR: Unable to find Intel(R) FPGA Emulation Platform for OpenCL(TM).\n");
+         // For legacy emulator
+            platform = findPlatform("Intel(R) FPGA SDK for OpenCL(TM)");
+            if (platform == NULL) {
+                printf("ERROR: Unable to find Intel(R) FPGA Legacy Emulation Platform for OpenCL(TM).\n");
+                return false;
+            }
+        }
+    }else{    //use for hardware and simulation
+        platform = findPlatform("Intel(R) FPGA SDK for OpenCL(TM)");
+        if (platform == NULL) {
+            printf("ERROR: Unable to find Intel(R) FPGA SDK for OpenCL(TM).\n");
+            return false;
+        }
+    }
+
+
+
+	//*************************************
+	// Query the available OpenCL devices.
+	//*************************************
+	scoped_array<cl_device_id> devices;
+	devices.reset(getDevices(platform, CL_DEVICE_TYPE_ALL, &num_devices));
+	device = devices[0];
+#ifdef VERBOSE
+	printf("Platform: %s\n", getPlatformName(platform).c_str());
+	printf("Using %d device(s)\n", num_devices);
+	for (unsigned i = 0; i < num_devices; ++i) {
+		printf("  %s\n", getDeviceName(device).c_str());
+	}
+#endif
+
+	//*********************
+	// Create the context.
+	//*********************
+	context = clCreateContext(NULL, num_devices, &device, &oclContextCallback, NULL, &status);
+	checkError(status, "Failed to create context");
+
+	//************************************
+	// Create the program for all device. 
+	//************************************
+	std::string binary_file = getBoardBinaryFile((exe_dir() + "/" + device_kernel).c_str(), device);
+#ifdef VERBOSE
+	printf("Using AOCX: %s\n", binary_file.c_str());
+#endif
+	program = createProgramFromBinary(context, binary_file.c_str(), &device, num_devices);
+
+	//*******************************************
+	// Build the program that was just created.
+	//*******************************************
+	status = clBuildProgram(program, 0, NULL, "", NULL, NULL);
+	checkError(status, "Failed to build program");
+
+	//**********************
+	// Create Command queue.
+	//**********************
+	for (int i = 0; i < K_NUM_KERNELS; ++i)
+	{
+		queue[i] = clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, &status);
+		checkError(status, "Failed to create command queue %d", i);
+	}
+	xfer_queue = clCreateCommandQueue(context, device, CL_QUEUE_PROFILING_ENABLE, &status);
+	checkError(status, "Failed to create transfer command queue");
+
+	//*****************
+	// Create Kernel.
+	//*****************
+	for (int i = 0; i < K_NUM_KERNELS; ++i)
+	{
+		kernel[i] = clCreateKernel(program, kernel_names[i], &status);
+		checkError(status, "Failed to create kernel %s", kernel_names[i]);
+	}
+
+	//**********************
+	// Create Input buffers.
+	//**********************
+	// One I and one Q buffer per slot of the transfer ring, each holding one chunk
+	for (int i = 0; i < XFER_NUM_BUFS; ++i)
+	{
+		input_noisy_message_I_buf[i] = clCreateBuffer(context, CL_MEM_READ_ONLY,
+			XFER_CHUNK_LEN * sizeof(char), NULL, &status);
+		checkError(status, "Failed to create buffer for input I %d", i);
+		input_noisy_message_Q_buf[i] = clCreateBuffer(context, CL_MEM_READ_ONLY,
+			XFER_CHUNK_LEN * sizeof(char), NULL, &status);
+		checkError(status, "Failed to create buffer for input Q %d", i);
+	}
+	
+	//**********************  
+	// Create Output buffer.
+	//**********************
+	for (int i = 0; i < XFER_NUM_BUFS; ++i)
+	{
+		output_buf[i] = clCreateBuffer(context, CL_MEM_WRITE_ONLY,
+			(XFER_CHUNK_LEN/SNR_DWELL_LENGTH) * sizeof(short), NULL, &status);
+		checkError(status, "Failed to create buffer for output %d", i);
+	}
+
+
+	return true;
+}
+
+
+/*************************************************************************
+
+@brief snr_est_LUT_correction never returns, so it is only launched
+by the first run of a session and then serves every later one.
+
+**************************************************************************/
+void OpenClSession::launch_estimator() {
+	cl_int status;
+
+	if (estimator_launched)
+		return;
+	status = clSetKernelArg(kernel[K_SNR_EST_LUT_CORRECTION], 0, sizeof(unsigned int), &slotLen);
+	checkError(status, "Failed to set K_SNR_EST_LUT_CORRECTION arg 0");	
+	status = clEnqueueTask(queue[K_SNR_EST_LUT_CORRECTION], kernel[K_SNR_EST_LUT_CORRECTION], 0, NULL, NULL);
+	checkError(status, "Failed to launch K_SNR_EST_LUT_CORRECTION");
+	estimator_launched = true;
+}
+
+
+/*************************************************************************
+
+@brief The run function streams the input to the kernels in chunks
+of XFER_CHUNK_LEN samples through a ring of XFER_NUM_BUFS device
+buffers.  Nothing blocks until the end: for each chunk the I/Q writes
+go on xfer_queue and wait for the data_in that last used the same
+buffers, data_in waits for the writes, and data_out plus a non-blocking
+read of its estimates follow on the writer queue, whose in-order
+execution keeps each output buffer from being reused before it has been
+read.  So the write of chunk N+1 overlaps with data_in and
+snr_est_LUT_correction working on chunk N.
+
+@param dataIn_I, dataIn_Q the I/Q samples
+@param dataInLen number of samples
+@param snr_est_out receives dataInLen/SNR_DWELL_LENGTH estimates
+@return double the time from the first write to the last estimate, in seconds
+
+**************************************************************************/
+double OpenClSession::run(const char *dataIn_I, const char *dataIn_Q, int dataInLen, short *snr_est_out) {
+	cl_int status;
+	cl_event write_event[XFER_NUM_BUFS][2];
+	cl_event reader_event[XFER_NUM_BUFS];
+
+	for (int b = 0; b < XFER_NUM_BUFS; ++b)
+		reader_event[b] = NULL;
+
+	const double start_time = getCurrentTimestamp();
+
+	//SNR Estimation
+	launch_estimator();
+
+	int num_chunks = (dataInLen + XFER_CHUNK_LEN - 1) / XFER_CHUNK_LEN;
+	for (int c = 0; c < num_chunks; ++c)
+	{
+		int b = c % XFER_NUM_BUFS;
+		int offset = c * XFER_CHUNK_LEN;
+		int chunk_len = (dataInLen - offset < XFER_CHUNK_LEN) ? dataInLen - offset : XFER_CHUNK_LEN;
+		int chunk_frames = chunk_len / SNR_DWELL_LENGTH;
+
+		//***********************************
+		// Copy chunk from host to device, once data_in is done with the buffers
+		//***********************************
+		cl_uint num_wait = reader_event[b] ? 1 : 0;
+		status = clEnqueueWriteBuffer(xfer_queue, input_noisy_message_I_buf[b], CL_FALSE,
+			0, chunk_len * sizeof(char), dataIn_I + offset, num_wait, &reader_event[b], &write_event[b][0]);
+		checkError(status, "Failed to transfer input noisy I data");
+		status = clEnqueueWriteBuffer(xfer_queue, input_noisy_message_Q_buf[b], CL_FALSE,
+			0, chunk_len * sizeof(char), dataIn_Q + offset, num_wait, &reader_event[b], &write_event[b][1]);
+		checkError(status, "Failed to transfer input  noisy Q data");
+		if (reader_event[b])
+			clReleaseEvent(reader_event[b]);
+
+		//***********************************
+		// SNR Estimation Reader Kernel
+		//***********************************
+		status = clSetKernelArg(kernel[K_READER], 0, sizeof(cl_mem), &input_noisy_message_I_buf[b]);
+		checkError(status, "Failed to set input reader arg 0");
+		status = clSetKernelArg(kernel[K_READER], 1, sizeof(cl_mem), &input_noisy_message_Q_buf[b]);
+		checkError(status, "Failed to set input reader arg 1");
+		status = clSetKernelArg(kernel[K_READER], 2, sizeof(int), &chunk_len);
+		checkError(status, "Failed to set K_READER arg 2");
+		status = clEnqueueTask(queue[K_READER], kernel[K_READER], 2, write_event[b], &reader_event[b]);
+		checkError(status, "Failed to launch K_READER");
+		clReleaseEvent(write_event[b][0]);
+		clReleaseEvent(write_event[b][1]);
+
+		//***********************************
+		// SNR Estimation Writer Kernel and non-blocking read of its estimates
+		//***********************************
+		if (chunk_frames > 0) {
+			status = clSetKernelArg(kernel[K_WRITER], 0, sizeof(cl_mem), &output_buf[b]);  //store final SNR estimate here
+			checkError(status, "Failed to set K_WRITER arg 0");
+			status = clSetKernelArg(kernel[K_WRITER], 1, sizeof(int), &chunk_frames);
+			checkError(status, "Failed to set K_WRITER arg 1");
+			status = clEnqueueTask(queue[K_WRITER], kernel[K_WRITER], 0, NULL, NULL);
+			checkError(status, "Failed to launch K_WRITER");
+			status = clEnqueueReadBuffer(queue[K_WRITER], output_buf[b], CL_FALSE,
+				0, chunk_frames*sizeof(short), snr_est_out + offset/SNR_DWELL_LENGTH, 0, NULL, NULL);
+			checkError(status, "Failed to read output %d", c);
+		}
+
+		clFlush(xfer_queue);
+		clFlush(queue[K_READER]);
+		clFlush(queue[K_WRITER]);
+	}
+
+	//***************************************************
+	// Wait for command queue to complete pending events
+	//***************************************************
+	status = clFinish(queue[K_READER]);
+	checkError(status, "Failed to finish (%d: %s)", K_READER, kernel_names[K_READER]);
+	status = clFinish(queue[K_WRITER]);
+	checkError(status, "Failed to finish (%d: %s)", K_WRITER, kernel_names[K_WRITER]);
+	for (int b = 0; b < XFER_NUM_BUFS; ++b) {
+		if (reader_event[b])
+			clReleaseEvent(reader_event[b]);
+	}
+
+	const double elapsed = getCurrentTimestamp() - start_time;
+	#ifdef VERBOSE
+		printf("Kernel time: %0.3f ms, %d chunks\n", elapsed * 1e3, num_chunks);
+	#else
+		printf("%f\t", dataInLen/elapsed);
+	#endif
+	return elapsed;
+}
+
+
+/*************************************************************************
+
+@brief The run_zero_copy function runs the kernels directly on the
+host arrays.  On SoC boards the host and FPGA share DRAM, so wrapping
+the arrays with CL_MEM_USE_HOST_PTR lets data_in and data_out access
+them in place and there is nothing to copy.  Mapping the output buffer
+makes the estimates visible to the host; on a shared memory board that
+is only a cache sync.
+
+The arrays must be allocated with alignedMalloc, i.e. at AOCL_ALIGNMENT,
+or the runtime falls back to a hidden copy.  The buffers are made for
+every call because they belong to the caller's arrays.
+
+@param dataIn_I, dataIn_Q the I/Q samples
+@param dataInLen number of samples
+@param snr_est_out receives dataInLen/SNR_DWELL_LENGTH estimates
+@return double the time from launching data_in to the mapped estimates, in seconds
+
+**************************************************************************/
+double OpenClSession::run_zero_copy(char *dataIn_I, char *dataIn_Q, int dataInLen, short *snr_est_out) {
+	cl_int status;
+	int num_frames = dataInLen / SNR_DWELL_LENGTH;
+
+	if (((size_t)dataIn_I | (size_t)dataIn_Q | (size_t)snr_est_out) % AOCL_ALIGNMENT != 0)
+		printf("WARNING: zero-copy arrays are not %d byte aligned\n", AOCL_ALIGNMENT);
+
+	const double start_time = getCurrentTimestamp();
+
+	cl_mem in_I = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_USE_HOST_PTR,
+		dataInLen * sizeof(char), dataIn_I, &status);
+	checkError(status, "Failed to wrap input I");
+	cl_mem in_Q = clCreateBuffer(context, CL_MEM_READ_ONLY | CL_MEM_USE_HOST_PTR,
+		dataInLen * sizeof(char), dataIn_Q, &status);
+	checkError(status, "Failed to wrap input Q");
+	cl_mem out = NULL;
+	if (num_frames > 0) {
+		out = clCreateBuffer(context, CL_MEM_WRITE_ONLY | CL_MEM_USE_HOST_PTR,
+			num_frames * sizeof(short), snr_est_out, &status);
+		checkError(status, "Failed to wrap output");
+	}
+
+	//SNR Estimation
+	launch_estimator();
+
+	status = clSetKernelArg(kernel[K_READER], 0, sizeof(cl_mem), &in_I);
+	checkError(status, "Failed to set input reader arg 0");
+	status = clSetKernelArg(kernel[K_READER], 1, sizeof(cl_mem), &in_Q);
+	checkError(status, "Failed to set input reader arg 1");
+	status = clSetKernelArg(kernel[K_READER], 2, sizeof(int), &dataInLen);
+	checkError(status, "Failed to set K_READER arg 2");
+	status = clEnqueueTask(queue[K_READER], kernel[K_READER], 0, NULL, NULL);
+	checkError(status, "Failed to launch K_READER");
+	clFlush(queue[K_READER]);
+
+	if (num_frames > 0) {
+		status = clSetKernelArg(kernel[K_WRITER], 0, sizeof(cl_mem), &out);
+		checkError(status, "Failed to set K_WRITER arg 0");
+		status = clSetKernelArg(kernel[K_WRITER], 1, sizeof(int), &num_frames);
+		checkError(status, "Failed to set K_WRITER arg 1");
+		status = clEnqueueTask(queue[K_WRITER], kernel[K_WRITER], 0, NULL, NULL);
+		checkError(status, "Failed to launch K_WRITER");
+
+		// Blocking map after data_out in the same queue, so the estimates are in snr_est_out
+		void *mapped = clEnqueueMapBuffer(queue[K_WRITER], out, CL_TRUE, CL_MAP_READ,
+			0, num_frames * sizeof(short), 0, NULL, NULL, &status);
+		checkError(status, "Failed to map output");
+		status = clEnqueueUnmapMemObject(queue[K_WRITER], out, mapped, 0, NULL, NULL);
+		checkError(status, "Failed to unmap output");
+	}
+
+	status = clFinish(queue[K_READER]);
+	checkError(status, "Failed to finish (%d: %s)", K_READER, kernel_names[K_READER]);
+	status = clFinish(queue[K_WRITER]);
+	checkError(status, "Failed to finish (%d: %s)", K_WRITER, kernel_names[K_WRITER]);
+
+	const double elapsed = getCurrentTimestamp() - start_time;
+
+	clReleaseMemObject(in_I);
+	clReleaseMemObject(in_Q);
+	if (out)
+		clReleaseMemObject(out);
+
+	#ifdef VERBOSE
+		printf("Zero-copy kernel time: %0.3f ms\n", elapsed * 1e3);
+	#endif
+	return elapsed;
+}
+
+
+/*************************************************************************
+
+@brief The run_batch function estimates many captures with a single
+launch of data_in_batch and data_out_batch.  The captures are packed
+back to back in one transfer, with a table of capture offsets for
+data_in_batch to raise sof at each capture boundary and a table of
+estimate offsets for data_out_batch to put each capture's estimates
+in its own slots of snr_est_out.  The buffers are sized to the batch,
+so they are made for every call.
+
+@param dataIn_I, dataIn_Q the packed I/Q samples
+@param capture_offsets num_captures+1 sample offsets, see SnrBackend::run_batch
+@param num_captures number of captures
+@param snr_est_out receives the estimates of every capture
+@return double the time from the first write to the last estimate, in seconds
+
+**************************************************************************/
+double OpenClSession::run_batch(const char *dataIn_I, const char *dataIn_Q, const unsigned int *capture_offsets,
+	unsigned int num_captures, short *snr_est_out) {
+	cl_int status;
+	unsigned int dataInLen = capture_offsets[num_captures];
+	std::vector<unsigned int> est_offsets(num_captures+1);
+	unsigned int num_estimates = snr_batch_est_offsets(capture_offsets, num_captures, est_offsets.data());
+
+	const double start_time = getCurrentTimestamp();
+
+	cl_mem in_I = clCreateBuffer(context, CL_MEM_READ_ONLY, dataInLen * sizeof(char), NULL, &status);
+	checkError(status, "Failed to create batch buffer for input I");
+	cl_mem in_Q = clCreateBuffer(context, CL_MEM_READ_ONLY, dataInLen * sizeof(char), NULL, &status);
+	checkError(status, "Failed to create batch buffer for input Q");
+	cl_mem capture_offsets_buf = clCreateBuffer(context, CL_MEM_READ_ONLY,
+		(num_captures+1) * sizeof(unsigned int), NULL, &status);
+	checkError(status, "Failed to create batch capture offsets buffer");
+	cl_mem est_offsets_buf = clCreateBuffer(context, CL_MEM_READ_ONLY,
+		(num_captures+1) * sizeof(unsigned int), NULL, &status);
+	checkError(status, "Failed to create batch estimate offsets buffer");
+	// at least one entry, a zero sized buffer is invalid
+	cl_mem out = clCreateBuffer(context, CL_MEM_WRITE_ONLY, (num_estimates+1) * sizeof(short), NULL, &status);
+	checkError(status, "Failed to create batch output buffer");
+
+	//***********************************
+	// One transfer for the whole batch
+	//***********************************
+	cl_event write_event[3];
+	status = clEnqueueWriteBuffer(queue[K_READER_BATCH], in_I, CL_FALSE, 0, dataInLen * sizeof(char), dataIn_I, 0, NULL, &write_event[0]);
+	checkError(status, "Failed to transfer batch input I");
+	status = clEnqueueWriteBuffer(queue[K_READER_BATCH], in_Q, CL_FALSE, 0, dataInLen * sizeof(char), dataIn_Q, 0, NULL, &write_event[1]);
+	checkError(status, "Failed to transfer batch input Q");
+	status = clEnqueueWriteBuffer(queue[K_READER_BATCH], capture_offsets_buf, CL_FALSE, 0,
+		(num_captures+1) * sizeof(unsigned int), capture_offsets, 0, NULL, &write_event[2]);
+	checkError(status, "Failed to transfer batch capture offsets");
+	status = clEnqueueWriteBuffer(queue[K_WRITER_BATCH], est_offsets_buf, CL_FALSE, 0,
+		(num_captures+1) * sizeof(unsigned int), est_offsets.data(), 0, NULL, NULL);
+	checkError(status, "Failed to transfer batch estimate offsets");
+
+	//SNR Estimation
+	launch_estimator();
+
+	status = clSetKernelArg(kernel[K_READER_BATCH], 0, sizeof(cl_mem), &in_I);
+	checkError(status, "Failed to set K_READER_BATCH arg 0");
+	status = clSetKernelArg(kernel[K_READER_BATCH], 1, sizeof(cl_mem), &in_Q);
+	checkError(status, "Failed to set K_READER_BATCH arg 1");
+	status = clSetKernelArg(kernel[K_READER_BATCH], 2, sizeof(cl_mem), &capture_offsets_buf);
+	checkError(status, "Failed to set K_READER_BATCH arg 2");
+	status = clSetKernelArg(kernel[K_READER_BATCH], 3, sizeof(unsigned int), &num_captures);
+	checkError(status, "Failed to set K_READER_BATCH arg 3");
+	status = clEnqueueTask(queue[K_READER_BATCH], kernel[K_READER_BATCH], 3, write_event, NULL);
+	checkError(status, "Failed to launch K_READER_BATCH");
+
+	status = clSetKernelArg(kernel[K_WRITER_BATCH], 0, sizeof(cl_mem), &out);
+	checkError(status, "Failed to set K_WRITER_BATCH arg 0");
+	status = clSetKernelArg(kernel[K_WRITER_BATCH], 1, sizeof(cl_mem), &est_offsets_buf);
+	checkError(status, "Failed to set K_WRITER_BATCH arg 1");
+	status = clSetKernelArg(kernel[K_WRITER_BATCH], 2, sizeof(unsigned int), &num_captures);
+	checkError(status, "Failed to set K_WRITER_BATCH arg 2");
+	status = clEnqueueTask(queue[K_WRITER_BATCH], kernel[K_WRITER_BATCH], 0, NULL, NULL);
+	checkError(status, "Failed to launch K_WRITER_BATCH");
+	clFlush(queue[K_READER_BATCH]);
+
+	status = clEnqueueReadBuffer(queue[K_WRITER_BATCH], out, CL_TRUE, 0, num_estimates * sizeof(short),
+		snr_est_out, 0, NULL, NULL);
+	checkError(status, "Failed to read batch output");
+	status = clFinish(queue[K_READER_BATCH]);
+	checkError(status, "Failed to finish (%d: %s)", K_READER_BATCH, kernel_names[K_READER_BATCH]);
+
+	const double elapsed = getCurrentTimestamp() - start_time;
+
+	for (int i = 0; i < 3; i++)
+		clReleaseEvent(write_event[i]);
+	clReleaseMemObject(in_I);
+	clReleaseMemObject(in_Q);
+	clReleaseMemObject(capture_offsets_buf);
+	clReleaseMemObject(est_offsets_buf);
+	clReleaseMemObject(out);
+
+	#ifdef VERBOSE
+		printf("Batch kernel time: %0.3f ms, %u captures\n", elapsed * 1e3, num_captures);
+	#endif
+	return elapsed;
+}
+
+
+/*************************************************************************
+
+@brief The OpenClBackend runs the kernels on its own OpenClSession
+through run(), or run_zero_copy() when made with zero_copy.  The
+throughput it reports is the wall time of the whole run, transfers
+included.
+
+**************************************************************************/
+class OpenClBackend : public SnrBackend {
+public:
+	OpenClBackend(const char *device_kernel, bool emulation, bool zero_copy)
+		: session(device_kernel, emulation), zero_copy(zero_copy) {}
+
+	const char *name() const { return "opencl"; }
+
+	bool init() { return session.init(); }
+
+	bool run(const char *dataIn_I, const char *dataIn_Q, int num_samples, short *snr_est_out)
+	{
+		// run_zero_copy needs the caller's arrays to be the alignedMalloc ones it wraps
+		if (zero_copy)
+			last_seconds = session.run_zero_copy((char *)dataIn_I, (char *)dataIn_Q, num_samples, snr_est_out);
+		else
+			last_seconds = session.run(dataIn_I, dataIn_Q, num_samples, snr_est_out);
+		last_samples = num_samples;
+		return true;
+	}
+
+	bool run_batch(const char *dataIn_I, const char *dataIn_Q,
+		const unsigned int *capture_offsets, unsigned int num_captures, short *snr_est_out)
+	{
+		last_seconds = session.run_batch(dataIn_I, dataIn_Q, capture_offsets, num_captures, snr_est_out);
+		last_samples = capture_offsets[num_captures];
+		return true;
+	}
+
+private:
+	OpenClSession session;
+	bool zero_copy;
+};
+
+
+SnrBackend *create_opencl_backend(const char *device_kernel, bool emulation, bool zero_copy)
+{
+	return new OpenClBackend(device_kernel, emulation, zero_copy);
+}
@@ -0,0 +1,131 @@
+/******************************************************************************
+*  @file    snr_window_engine.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Native C++ model of the fused multi window estimator.
+*
+*  @section DESCRIPTION
+*
+*  The loop in push_mags follows snr_window_step in
+*  device/SNR_estimator_multi_window.cl line for line.  As in snr_engine.cpp,
+*  do not change the arithmetic here without making the same change in the
+*  kernel.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include "cl_compat.h"
+#include "snr_window_engine.h"
+#include "../../device/SNR_estimator_LUT_coefficients_90_AGC_at_21.h"
+#include "../../device/SNR_estimator_LUT_coefficients_512_AGC_at_21.h"
+#include "../../device/SNR_estimator_LUT_coefficients_AGC_at_21.h"
+#include "../../device/SNR_estimator_LUT_coefficients_4096_AGC_at_21.h"
+
+
+static const int window_samp_to_average[SNR_NUM_WINDOWS] = {
+	SNR_WINDOW_0_AVG, SNR_WINDOW_1_AVG, SNR_WINDOW_2_AVG, SNR_WINDOW_3_AVG
+};
+
+static const short *const window_lut[SNR_NUM_WINDOWS] = {
+	SNR_estimator_LUT_coefficients_90,
+	SNR_estimator_LUT_coefficients_512,
+	SNR_estimator_LUT_coefficients,
+	SNR_estimator_LUT_coefficients_4096
+};
+
+
+SnrWindowEngine::SnrWindowEngine()
+{
+	for (int k = 0; k < SNR_NUM_WINDOWS; k++) {
+		win[k].num_samp_to_average = window_samp_to_average[k];
+		win[k].lut = window_lut[k];
+		win[k].delay_line.resize(window_samp_to_average[k] + 1);
+	}
+	reset();
+}
+
+void SnrWindowEngine::reset()
+{
+	sample_cnt = 0;
+	for (int k = 0; k < SNR_NUM_WINDOWS; k++) {
+		Window &w = win[k];
+		std::fill(w.delay_line.begin(), w.delay_line.end(), 0);
+		w.head = 0;
+		w.while_loop_cntr = 0;
+		w.noiseVarSum = 0;
+		w.abs_energy_sum = 0;
+		w.out.clear();
+		w.out_rd = 0;
+	}
+}
+
+unsigned int SnrWindowEngine::dwell_length(int window)
+{
+	return 2*window_samp_to_average[window];
+}
+
+size_t SnrWindowEngine::poll(int window, snr_estimate_t *estimates, size_t max_estimates)
+{
+	Window &w = win[window];
+	size_t n = 0;
+	while (n < max_estimates && w.out_rd < w.out.size())
+		estimates[n++] = w.out[w.out_rd++];
+	if (w.out_rd == w.out.size()) {
+		w.out.clear();
+		w.out_rd = 0;
+	}
+	return n;
+}
+
+// The kernel steps every window on each sample.  The windows are independent,
+// so here each one walks the whole block in turn with its state in registers.
+void SnrWindowEngine::push_mags(const unsigned int *mag, size_t n)
+{
+	for (int k = 0; k < SNR_NUM_WINDOWS; k++) {
+		Window &w = win[k];
+		const int num_samp_to_average = w.num_samp_to_average;
+		unsigned short *delay_line = w.delay_line.data();
+		unsigned int head = w.head;
+		int while_loop_cntr = w.while_loop_cntr;
+		unsigned long abs_energy_sum = w.abs_energy_sum;
+		unsigned long noiseVarSum = w.noiseVarSum;
+
+		for (size_t i = 0; i < n; i++) {
+			int cordic_abs = mag[i];
+
+			if (while_loop_cntr == 2*num_samp_to_average) {
+				while_loop_cntr = 0;
+				noiseVarSum = 0;
+				abs_energy_sum = 0;
+			}
+			while_loop_cntr += 1;
+
+			if (while_loop_cntr > num_samp_to_average+1)
+				abs_energy_sum -= delay_line[head];
+			abs_energy_sum += cordic_abs;
+
+			delay_line[head] = (unsigned short)cordic_abs;
+			head = (head == (unsigned int)num_samp_to_average) ? 0 : head+1;
+
+			if (while_loop_cntr > num_samp_to_average)
+				noiseVarSum += ((cordic_abs*num_samp_to_average) - abs_energy_sum)*((cordic_abs*num_samp_to_average) - abs_energy_sum);
+
+			if (while_loop_cntr == 2*num_samp_to_average) {
+				int carry = (1&(noiseVarSum>>(15-1)));
+				snr_estimate_t est;
+				est.sample_ind = sample_cnt + i;
+				est.noiseVarSum_final = (noiseVarSum>>15) + carry;
+				est.numerator = (abs_energy_sum*num_samp_to_average*num_samp_to_average)>>(8);
+				est.snr_est = w.lut[snr_lut_index(est.numerator, est.noiseVarSum_final)];
+				w.out.push_back(est);
+			}
+		}
+
+		w.head = head;
+		w.while_loop_cntr = while_loop_cntr;
+		w.abs_energy_sum = abs_energy_sum;
+		w.noiseVarSum = noiseVarSum;
+	}
+	sample_cnt += n;
+}
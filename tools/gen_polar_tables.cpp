@@ -0,0 +1,102 @@
+/******************************************************************************
+*  @file    gen_polar_tables.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Generates device/polar_tables_int8.h from the device CORDIC.
+*
+*  @section DESCRIPTION
+*
+*  The estimator input is always char I/Q, so the CORDIC only ever sees
+*  65536 distinct inputs.  This tool runs the 24 iteration CORDIC once for
+*  every first quadrant point and writes the results out as two
+*  129 x 129 tables, indexed [x*POLAR_LUT_DIM + y] with 0 <= x,y <= 128:
+*
+*    mag_table_int8[]    mag_cordic(x<<8, y<<8)
+*    arctan_table_int8[] the 14 bit first quadrant angle arctan_cordic
+*                        computes for x,y > 0
+*
+*  The other three quadrants are folded onto these by mag_lut_int8() and
+*  arctan_lut_int8() (device/polar_lut.h, host/inc/polar_lut_host.h).  Before the
+*  header is written every one of the 65536 char inputs is looked up through
+*  the fold and checked against mag_cordic/arctan_cordic.
+*
+*  Build and run from the repository root:
+*    g++ -O2 -I host/inc tools/gen_polar_tables.cpp host/src/cordic.cpp -o gen_polar_tables
+*    ./gen_polar_tables device/polar_tables_int8.h
+*
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cordic_host.h"
+#include "polar_lut_host.h"
+
+static unsigned short mag_tab[POLAR_LUT_DIM*POLAR_LUT_DIM];
+static unsigned short arctan_tab[POLAR_LUT_DIM*POLAR_LUT_DIM];
+
+
+static void write_table(FILE *f, const char *name, const unsigned short *tab)
+{
+	fprintf(f, "__constant unsigned short %s[%d]={\n", name, POLAR_LUT_DIM*POLAR_LUT_DIM);
+	for (int i = 0; i < POLAR_LUT_DIM*POLAR_LUT_DIM; i++) {
+		fprintf(f, "%u", tab[i]);
+		if (i == POLAR_LUT_DIM*POLAR_LUT_DIM-1)
+			fprintf(f, "};\n\n");
+		else if ((i % 16) == 15)
+			fprintf(f, ",\n");
+		else
+			fprintf(f, ",");
+	}
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 2) {
+		fprintf(stderr, "USAGE: gen_polar_tables <output header>\n");
+		return 1;
+	}
+
+	for (int x = 0; x < POLAR_LUT_DIM; x++) {
+		for (int y = 0; y < POLAR_LUT_DIM; y++) {
+			mag_tab[x*POLAR_LUT_DIM + y] = (unsigned short)mag_cordic(x<<8, y<<8);
+			// First quadrant only; the axes are special cased in arctan_cordic
+			if (x > 0 && y > 0)
+				arctan_tab[x*POLAR_LUT_DIM + y] = arctan_cordic(x, y) & 0x3fff;
+		}
+	}
+
+	// Check the folding against the CORDIC for every char input
+	int num_errors = 0;
+	for (int x = -128; x < 128; x++) {
+		for (int y = -128; y < 128; y++) {
+			char cx = (char)x, cy = (char)y;
+			if (polar_lut_fold_mag(mag_tab, cx, cy) != mag_cordic(x<<8, y<<8) ||
+				polar_lut_fold_arctan(arctan_tab, cx, cy) != arctan_cordic(x, y)) {
+				if (num_errors < 10)
+					fprintf(stderr, "Mismatch at x=%d y=%d\n", x, y);
+				num_errors += 1;
+			}
+		}
+	}
+	if (num_errors) {
+		fprintf(stderr, "%d mismatches, table not written\n", num_errors);
+		return 1;
+	}
+
+	FILE *f = fopen(argv[1], "wt");
+	if (f == NULL) {
+		fprintf(stderr, "File %s could not be opened\n", argv[1]);
+		return 1;
+	}
+	fprintf(f, "// Generated by tools/gen_polar_tables.cpp from device/cordic.h.  Do not edit.\n");
+	fprintf(f, "// Indexed [x*%d + y] for 0 <= x,y <= %d, see device/polar_lut.h\n", POLAR_LUT_DIM, POLAR_LUT_DIM-1);
+	fprintf(f, "#ifndef POLAR_TABLES_INT8_H_\n#define POLAR_TABLES_INT8_H_\n\n");
+	write_table(f, "mag_table_int8", mag_tab);
+	write_table(f, "arctan_table_int8", arctan_tab);
+	fprintf(f, "#endif\n");
+	fclose(f);
+
+	printf("Wrote %s, all 65536 inputs match the CORDIC\n", argv[1]);
+	return 0;
+}
@@ -0,0 +1,316 @@
+/******************************************************************************
+*  @file    gen_snr_lut.cpp
+*  @date    10/15/2026
+*  @version 1.0
+*
+*  @brief Generates SNR_estimator_LUT_coefficients tables by Monte Carlo
+*  simulation of the kernel's estimator.
+*
+*  @section DESCRIPTION
+*
+*  The correction LUT maps the kernel's raw estimate, as lookup_index =
+*  round(snr*100) + SNR_LUT_OFFSET, to the true SNR in tenths of a dB.  It
+*  only holds for the estimator parameters and input level it was made
+*  with.  This tool rebuilds it for any of them:
+*
+*    -w  num_samp_to_average (the delay line is -w+1 long and a dwell 2*w
+*        samples, as in the kernel)
+*    -b  bits_to_shift, log2 of -w unless given.  A -w that is not a power
+*        of two is scaled by multiplying by -w instead, as the fused multi
+*        window kernel does for its 90 symbol window.
+*    -a  signal amplitude at the estimator input, the AGC level
+*    -t  name of the table array, to keep several in one kernel
+*
+*  Every SNR point from -l to -h dB in steps of -s is simulated over -n
+*  dwells: QPSK symbols at amplitude -a plus complex AWGN, rounded and
+*  saturated to char I/Q, magnitudes from the polar LUT (mag_cordic), then
+*  the estimator arithmetic of snr_est_LUT_correction with the chosen
+*  parameters.  The noise variance on each rail is amplitude^2/(4*snr),
+*  the convention the *_21Mag test vectors were made with; at -a 21 the
+*  table comes out within 0.3 dB of SNR_estimator_LUT_coefficients_AGC_at_21.h.
+*
+*  The mean lookup index at each SNR point gives the estimator's response
+*  curve; each LUT entry is that curve inverted at its index and clamped to
+*  the simulated range.  The points are shared out between -j threads.
+*  Each point draws from its own generator, seeded from -r and the point
+*  number, so the table is the same whatever the number of threads.
+*
+*  Before simulating, the estimator arithmetic here is checked bit for bit
+*  against SnrEngine at the kernel's own parameters.
+*
+*  Build and run from the repository root:
+*    g++ -O2 -std=c++17 -I host/inc tools/gen_snr_lut.cpp host/src/snr_engine.cpp \
+*        host/src/cordic.cpp host/src/cordic_batch.cpp host/src/polar_lut.cpp -o gen_snr_lut -lpthread
+*    ./gen_snr_lut -a 21 device/SNR_estimator_LUT_coefficients_AGC_at_21.h
+*
+*******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include "snr_agc.h"
+#include "snr_engine.h"
+
+#define LUT_SNR_MIN     -10.0  // dB, the range of SNR_estimator_LUT_coefficients_AGC_at_21.h
+#define LUT_SNR_MAX      35.0
+#define LUT_SNR_STEP     0.1
+#define LUT_DWELLS       1000  // per SNR point
+#define LUT_SEED         1
+#define LUT_TABLE_NAME   "SNR_estimator_LUT_coefficients"
+
+
+typedef struct lut_params_t {
+	int num_samp_to_average;
+	int bits_to_shift;
+	int scale;           // 1<<bits_to_shift, or num_samp_to_average without one
+	double amplitude;
+	double snr_min, snr_max, snr_step;
+	int dwells;
+	unsigned long long seed;
+} lut_params_t;
+
+
+//**********************************************
+// Estimator
+//**********************************************
+// snr_est_LUT_correction over one dwell of 2*w magnitudes, starting at sof,
+// with num_samp_to_average as a parameter.  The <<bits_to_shift scalings are
+// multiplies by scale, which is the same for scale = 1<<bits_to_shift.
+static void estimate_dwell(const unsigned int *mag, int w, int scale,
+	unsigned long *numerator, unsigned long *noiseVarSum_final)
+{
+	unsigned long abs_energy_sum = 0;
+	unsigned long noiseVarSum = 0;
+	for (int while_loop_cntr = 1; while_loop_cntr <= 2*w; while_loop_cntr++) {
+		int cordic_abs = mag[while_loop_cntr-1];
+		if (while_loop_cntr > w+1)
+			abs_energy_sum -= mag[while_loop_cntr-1 - (w+1)];
+		abs_energy_sum += cordic_abs;
+		if (while_loop_cntr > w)
+			noiseVarSum += ((cordic_abs*scale) - abs_energy_sum)*((cordic_abs*scale) - abs_energy_sum);
+	}
+	int carry = (1&(noiseVarSum>>(15-1)));
+	*noiseVarSum_final = (noiseVarSum>>15) + carry;
+	*numerator = (abs_energy_sum*scale*scale)>>(8);
+}
+
+// Random dwells through SnrEngine and estimate_dwell at the kernel's parameters
+static bool check_against_engine()
+{
+	std::mt19937_64 rng(LUT_SEED);
+	std::vector<char> I(SNR_DWELL_LENGTH), Q(SNR_DWELL_LENGTH);
+	std::vector<unsigned int> mag(SNR_DWELL_LENGTH);
+	SnrEngine engine;
+	for (int trial = 0; trial < 100; trial++) {
+		int range = 1 + trial*127/99;  // quiet through full scale
+		for (int i = 0; i < SNR_DWELL_LENGTH; i++) {
+			I[i] = (char)((int)(rng() % (2*range+1)) - range);
+			Q[i] = (char)((int)(rng() % (2*range+1)) - range);
+			mag[i] = snr_sample_mag(I[i], Q[i]);
+		}
+		engine.reset();
+		engine.push(I.data(), Q.data(), SNR_DWELL_LENGTH);
+		snr_estimate_t est;
+		unsigned long numerator, noiseVarSum_final;
+		estimate_dwell(mag.data(), SNR_NUM_SAMP_TO_AVG, 1 << SNR_BITS_TO_SHIFT, &numerator, &noiseVarSum_final);
+		if (engine.poll(&est, 1) != 1 || est.numerator != numerator || est.noiseVarSum_final != noiseVarSum_final) {
+			fprintf(stderr, "Mismatch with SnrEngine in trial %d\n", trial);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//**********************************************
+// Simulation
+//**********************************************
+static char quantize(double x)
+{
+	long v = lround(x);
+	if (v > 127) v = 127;
+	if (v < -128) v = -128;
+	return (char)v;
+}
+
+// Mean lookup index at one SNR point
+static double simulate_point(const lut_params_t &p, int point)
+{
+	double snr_db = p.snr_min + point*p.snr_step;
+	// Noise variance amplitude^2/(4*snr) on each rail, as in the test vectors
+	double sigma = p.amplitude / (2*sqrt(pow(10.0, snr_db/10)));
+	double rail = p.amplitude / sqrt(2.0);
+
+	std::mt19937_64 rng(p.seed*0x9E3779B97F4A7C15ULL + point);
+	std::normal_distribution<double> noise(0, sigma);
+	int dwell_length = 2*p.num_samp_to_average;
+	std::vector<unsigned int> mag(dwell_length);
+
+	double index_sum = 0;
+	for (int d = 0; d < p.dwells; d++) {
+		for (int i = 0; i < dwell_length; i++) {
+			unsigned long long bits = rng();
+			double si = (bits & 1) ? rail : -rail;
+			double sq = (bits & 2) ? rail : -rail;
+			mag[i] = snr_sample_mag(quantize(si + noise(rng)), quantize(sq + noise(rng)));
+		}
+		unsigned long numerator, noiseVarSum_final;
+		estimate_dwell(mag.data(), p.num_samp_to_average, p.scale, &numerator, &noiseVarSum_final);
+		index_sum += snr_lut_index(numerator, noiseVarSum_final);
+	}
+	return index_sum / p.dwells;
+}
+
+static void simulate(const lut_params_t &p, int num_points, unsigned int num_threads, std::vector<double> &mean_index)
+{
+	std::atomic<int> next_point(0);
+	std::vector<std::thread> workers;
+	for (unsigned int t = 0; t < num_threads; t++) {
+		workers.push_back(std::thread([&] {
+			for (int k = next_point++; k < num_points; k = next_point++)
+				mean_index[k] = simulate_point(p, k);
+		}));
+	}
+	for (size_t t = 0; t < workers.size(); t++)
+		workers[t].join();
+}
+
+// Invert the response curve: the SNR whose mean lookup index is i, in
+// tenths of a dB.  Flat stretches (the index saturates at high SNR) keep
+// the first SNR that reaches them.
+static void invert(const lut_params_t &p, std::vector<double> mean_index, short *lut)
+{
+	int num_points = (int)mean_index.size();
+	for (int k = 1; k < num_points; k++) {
+		if (mean_index[k] < mean_index[k-1])
+			mean_index[k] = mean_index[k-1];
+	}
+
+	int k = 0;
+	for (int i = 0; i < SNR_LUT_LEN; i++) {
+		double snr_db;
+		if (i <= mean_index[0]) {
+			snr_db = p.snr_min;
+		} else if (i >= mean_index[num_points-1]) {
+			snr_db = p.snr_min + (num_points-1)*p.snr_step;
+		} else {
+			while (mean_index[k+1] <= i)
+				k++;
+			double frac = (i - mean_index[k]) / (mean_index[k+1] - mean_index[k]);
+			snr_db = p.snr_min + (k + frac)*p.snr_step;
+		}
+		lut[i] = (short)lround(snr_db*10);
+	}
+}
+
+
+static void usage()
+{
+	fprintf(stderr,
+		"USAGE: gen_snr_lut [options] <output header>\n"
+		"  -w <n>     num_samp_to_average (%d)\n"
+		"  -b <n>     bits_to_shift (log2 of -w, or scale by -w if not a power of two)\n"
+		"  -a <amp>   signal amplitude at the estimator input (%g)\n"
+		"  -t <name>  table array name (%s)\n"
+		"  -l <dB>    lowest SNR simulated (%g)\n"
+		"  -h <dB>    highest SNR simulated (%g)\n"
+		"  -s <dB>    SNR step (%g)\n"
+		"  -n <n>     dwells per SNR point (%d)\n"
+		"  -j <n>     threads (all cores)\n"
+		"  -r <seed>  random seed (%d)\n",
+		SNR_NUM_SAMP_TO_AVG, (double)SNR_AGC_TARGET_RMS, LUT_TABLE_NAME, LUT_SNR_MIN, LUT_SNR_MAX, LUT_SNR_STEP, LUT_DWELLS, LUT_SEED);
+}
+
+int main(int argc, char **argv)
+{
+	lut_params_t p;
+	p.num_samp_to_average = SNR_NUM_SAMP_TO_AVG;
+	p.bits_to_shift = -1;
+	p.amplitude = SNR_AGC_TARGET_RMS;
+	p.snr_min = LUT_SNR_MIN;
+	p.snr_max = LUT_SNR_MAX;
+	p.snr_step = LUT_SNR_STEP;
+	p.dwells = LUT_DWELLS;
+	p.seed = LUT_SEED;
+	const char *table_name = LUT_TABLE_NAME;
+	unsigned int num_threads = std::thread::hardware_concurrency();
+
+	int opt;
+	while ((opt = getopt(argc, argv, "w:b:a:t:l:h:s:n:j:r:")) != -1) {
+		switch (opt) {
+		case 'w': p.num_samp_to_average = atoi(optarg); break;
+		case 'b': p.bits_to_shift = atoi(optarg); break;
+		case 'a': p.amplitude = atof(optarg); break;
+		case 't': table_name = optarg; break;
+		case 'l': p.snr_min = atof(optarg); break;
+		case 'h': p.snr_max = atof(optarg); break;
+		case 's': p.snr_step = atof(optarg); break;
+		case 'n': p.dwells = atoi(optarg); break;
+		case 'j': num_threads = atoi(optarg); break;
+		case 'r': p.seed = strtoull(optarg, NULL, 0); break;
+		default: usage(); return 1;
+		}
+	}
+	if (optind != argc-1) {
+		usage();
+		return 1;
+	}
+
+	int w = p.num_samp_to_average;
+	if (w < 2 || w > 4096) {
+		fprintf(stderr, "-w must be from 2 to 4096\n");
+		return 1;
+	}
+	if (p.bits_to_shift < 0 && (w & (w-1)) == 0) {
+		p.bits_to_shift = 0;
+		while ((1 << p.bits_to_shift) < w)
+			p.bits_to_shift++;
+	}
+	p.scale = (p.bits_to_shift < 0) ? w : 1 << p.bits_to_shift;
+	if (p.amplitude <= 0 || p.snr_step <= 0 || p.snr_max < p.snr_min || p.dwells < 1) {
+		usage();
+		return 1;
+	}
+	if (num_threads == 0)
+		num_threads = 1;
+
+	if (!check_against_engine()) {
+		fprintf(stderr, "Estimator does not match SnrEngine, table not written\n");
+		return 1;
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	int num_points = (int)floor((p.snr_max - p.snr_min)/p.snr_step + 0.5) + 1;
+	std::vector<double> mean_index(num_points);
+	simulate(p, num_points, num_threads, mean_index);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::vector<short> lut(SNR_LUT_LEN);
+	invert(p, mean_index, lut.data());
+
+	FILE *f = fopen(argv[optind], "wt");
+	if (f == NULL) {
+		fprintf(stderr, "File %s could not be opened\n", argv[optind]);
+		return 1;
+	}
+	fprintf(f, "// Generated by tools/gen_snr_lut.cpp.  num_samp_to_average %d, scale %d, amplitude %g,\n",
+		p.num_samp_to_average, p.scale, p.amplitude);
+	fprintf(f, "// %g to %g dB in %g dB steps, %d dwells per step, seed %llu\n",
+		p.snr_min, p.snr_max, p.snr_step, p.dwells, p.seed);
+	fprintf(f, "__constant short %s[%d]={\n", table_name, SNR_LUT_LEN);
+	for (int i = 0; i < SNR_LUT_LEN; i++)
+		fprintf(f, "%d%s\n", lut[i], (i == SNR_LUT_LEN-1) ? "};" : ",");
+	fclose(f);
+
+	printf("Wrote %s: %d SNR points x %d dwells on %u threads in %.1f s\n",
+		argv[optind], num_points, p.dwells, num_threads, seconds);
+	printf("Mean lookup index %.1f at %g dB, %.1f at %g dB\n",
+		mean_index[0], p.snr_min, mean_index[num_points-1], p.snr_min + (num_points-1)*p.snr_step);
+	return 0;
+}